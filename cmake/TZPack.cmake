@@ -5,6 +5,7 @@ install(TARGETS ${PROJECT_NAME} ARCHIVE DESTINATION lib LIBRARY DESTINATION lib)
 install(FILES ${CMAKE_SOURCE_DIR}/include/libdt/dt.h DESTINATION include/libdt)
 install(FILES ${CMAKE_SOURCE_DIR}/include/libdt/dt_posix.h DESTINATION include/libdt)
 install(FILES ${CMAKE_SOURCE_DIR}/include/libdt/dt_convert.h DESTINATION include/libdt)
+install(FILES ${CMAKE_SOURCE_DIR}/include/libdt/dt_inline.h DESTINATION include/libdt)
 install(FILES ${CMAKE_SOURCE_DIR}/include/libdt/dt_types.h DESTINATION include/libdt)
 if(DOXYGEN_FOUND)
     install(DIRECTORY ${CMAKE_SOURCE_DIR}/doc DESTINATION share/doc/libdt)
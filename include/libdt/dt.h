@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include <time.h>
 #include <libdt/dt_types.h>
 #include <libdt/dt_convert.h>
+#include <libdt/dt_inline.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -174,6 +175,270 @@ extern "C" {
      */
     LIBDT_EXPORT dt_status_t dt_mul_interval(const dt_interval_t *lhs, double rhs, dt_interval_t *result);
 
+    //! Multiplies an interval by an integer exactly
+    /*!
+     * \param lhs Interval to multiply
+     * \param rhs Multiplier
+     * \param result Result interval [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if result seconds do not fit
+     */
+    LIBDT_EXPORT dt_status_t dt_mul_interval_int(const dt_interval_t *lhs, unsigned long rhs, dt_interval_t *result);
+
+    //! Multiplies an interval by a ratio of integers exactly
+    /*!
+     * Result is truncated to a nano-second, so dividing an interval by N is multiplying it by 1/N
+     * \param lhs Interval to multiply
+     * \param numerator Numerator of the ratio
+     * \param denominator Denominator of the ratio, must not be 0
+     * \param result Result interval [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if result seconds do not fit
+     */
+    LIBDT_EXPORT dt_status_t dt_mul_interval_ratio(const dt_interval_t *lhs, unsigned long numerator,
+                                                   unsigned long denominator, dt_interval_t *result);
+
+    //! Divides an interval by another one
+    /*!
+     * \param lhs Interval to divide
+     * \param rhs Divisor interval, must not be zero
+     * \param quotient How many whole divisors fit into the interval [OUT]
+     * \param remainder What is left of the interval, could be NULL [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if quotient does not fit
+     */
+    LIBDT_EXPORT dt_status_t dt_div_interval(const dt_interval_t *lhs, const dt_interval_t *rhs, unsigned long *quotient,
+                                             dt_interval_t *remainder);
+
+    /*! @}*/
+
+    /*!
+     * \defgroup Nanoseconds Nano-second scalar time functions
+     * Inline arithmetic on nano-seconds is defined in dt_inline.h.
+     * @{
+     */
+
+    //! Converts a timestamp to nano-seconds from the epoch
+    /*!
+     * \param timestamp Timestamp to convert
+     * \param result Nano-seconds from the epoch [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the timestamp is out of dt_ns_t range
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_to_ns(const dt_timestamp_t *timestamp, dt_ns_t *result);
+
+    //! Converts nano-seconds from the epoch to a timestamp
+    /*!
+     * \param ns Nano-seconds from the epoch
+     * \param result Timestamp [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_ns_to_timestamp(dt_ns_t ns, dt_timestamp_t *result);
+
+    //! Converts an interval to nano-seconds
+    /*!
+     * \param interval Interval to convert
+     * \param result Nano-seconds of the interval [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the interval is out of dt_ns_t range
+     */
+    LIBDT_EXPORT dt_status_t dt_interval_to_ns(const dt_interval_t *interval, dt_ns_t *result);
+
+    //! Converts nano-seconds to an interval
+    /*!
+     * \param ns Nano-seconds, not negative
+     * \param result Interval [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_ns_to_interval(dt_ns_t ns, dt_interval_t *result);
+
+    //! Converts an offset to signed nano-seconds, negative for backward offsets
+    /*!
+     * \param offset Offset to convert
+     * \param result Nano-seconds of the offset [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the offset is out of dt_ns_t range
+     */
+    LIBDT_EXPORT dt_status_t dt_offset_to_ns(const dt_offset_t *offset, dt_ns_t *result);
+
+    //! Converts signed nano-seconds to an offset, backward one for negative nano-seconds
+    /*!
+     * \param ns Nano-seconds
+     * \param result Offset [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_ns_to_offset(dt_ns_t ns, dt_offset_t *result);
+
+    /*! @}*/
+
+    /*!
+     * \defgroup Arrays Timestamp array functions
+     * Functions over arrays of timestamps, either of dt_timestamp_t structures or of separate columns of seconds and
+     * nano-seconds. Arguments are validated once per call, while timestamps are checked in bulk, so contents of
+     * results are unspecified unless DT_OK is returned. Results could be written over the source arrays.
+     * @{
+     */
+
+    //! Applies an offset on every timestamp of an array
+    /*!
+     * \param timestamps Timestamps to apply the offset on
+     * \param count Count of timestamps
+     * \param offset Offset to apply
+     * \param results Result timestamps, count of them [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if any of results overflows
+     * \sa dt_apply_offset
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_apply_offset(const dt_timestamp_t *timestamps, size_t count,
+            const dt_offset_t *offset, dt_timestamp_t *results);
+
+    //! Obtains offsets between timestamps of two arrays pairwise
+    /*!
+     * \param lhs First timestamps
+     * \param rhs Second timestamps
+     * \param count Count of timestamps in every array
+     * \param results Offsets from the first timestamps to the second ones, count of them [OUT]
+     * \return Result status of the operation
+     * \sa dt_offset_between
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_offset_between(const dt_timestamp_t *lhs, const dt_timestamp_t *rhs,
+            size_t count, dt_offset_t *results);
+
+    //! Compares every timestamp of an array with a threshold
+    /*!
+     * \param timestamps Timestamps to compare
+     * \param count Count of timestamps
+     * \param threshold Timestamp to compare with
+     * \param results Compare results of timestamps with the threshold, count of them [OUT]
+     * \return Result status of the operation
+     * \sa dt_compare_timestamps
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_compare(const dt_timestamp_t *timestamps, size_t count,
+            const dt_timestamp_t *threshold, dt_compare_result_t *results);
+
+    //! Finds the lowest and the highest timestamps of an array
+    /*!
+     * \param timestamps Timestamps to search in
+     * \param count Count of timestamps, not zero
+     * \param min The lowest timestamp [OUT]
+     * \param max The highest timestamp [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_min_max(const dt_timestamp_t *timestamps, size_t count, dt_timestamp_t *min,
+            dt_timestamp_t *max);
+
+    //! Applies an offset on every timestamp of columns
+    /*!
+     * \param seconds Seconds of timestamps to apply the offset on
+     * \param nano_seconds Nano-seconds of timestamps to apply the offset on
+     * \param count Count of timestamps
+     * \param offset Offset to apply
+     * \param result_seconds Seconds of result timestamps, count of them [OUT]
+     * \param result_nano_seconds Nano-seconds of result timestamps, count of them [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if any of results overflows
+     * \sa dt_timestamps_apply_offset
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_apply_offset(const long *seconds, const unsigned long *nano_seconds,
+            size_t count, const dt_offset_t *offset, long *result_seconds, unsigned long *result_nano_seconds);
+
+    //! Obtains offsets between timestamps of two columns pairwise
+    /*!
+     * \param lhs_seconds Seconds of first timestamps
+     * \param lhs_nano_seconds Nano-seconds of first timestamps
+     * \param rhs_seconds Seconds of second timestamps
+     * \param rhs_nano_seconds Nano-seconds of second timestamps
+     * \param count Count of timestamps in every column
+     * \param result_seconds Seconds of durations of offsets, count of them [OUT]
+     * \param result_nano_seconds Nano-seconds of durations of offsets, count of them [OUT]
+     * \param result_is_forward Directions of offsets, count of them [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_offset_between
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_offset_between(const long *lhs_seconds,
+            const unsigned long *lhs_nano_seconds, const long *rhs_seconds, const unsigned long *rhs_nano_seconds,
+            size_t count, unsigned long *result_seconds, unsigned long *result_nano_seconds,
+            dt_bool_t *result_is_forward);
+
+    //! Compares every timestamp of columns with a threshold
+    /*!
+     * \param seconds Seconds of timestamps to compare
+     * \param nano_seconds Nano-seconds of timestamps to compare
+     * \param count Count of timestamps
+     * \param threshold Timestamp to compare with
+     * \param results Compare results of timestamps with the threshold, count of them [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_compare
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_compare(const long *seconds, const unsigned long *nano_seconds,
+            size_t count, const dt_timestamp_t *threshold, dt_compare_result_t *results);
+
+    //! Finds the lowest and the highest timestamps of columns
+    /*!
+     * \param seconds Seconds of timestamps to search in
+     * \param nano_seconds Nano-seconds of timestamps to search in
+     * \param count Count of timestamps, not zero
+     * \param min The lowest timestamp [OUT]
+     * \param max The highest timestamp [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_min_max
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_min_max(const long *seconds, const unsigned long *nano_seconds,
+            size_t count, dt_timestamp_t *min, dt_timestamp_t *max);
+
+    //! Sorts timestamps in ascending order
+    /*!
+     * Sort is stable, it is a radix one for large arrays, so it takes a buffer of the array size
+     * \param timestamps Timestamps to sort [IN/OUT]
+     * \param count Count of timestamps
+     * \param permutation Indexes of sorted timestamps in the source array, count of them, could be NULL [OUT]
+     * \return Result status of the operation, DT_SYSTEM_CALL_ERROR if the buffer could not be allocated
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_sort(dt_timestamp_t *timestamps, size_t count, size_t *permutation);
+
+    //! Finds the first timestamp of a sorted array which is not lesser than a value
+    /*!
+     * Search interpolates positions by values, so it takes a few steps for evenly spread timestamps, and falls back to
+     * bisection for uneven ones
+     * \param timestamps Timestamps in ascending order
+     * \param count Count of timestamps
+     * \param value Timestamp to search for
+     * \param index Index of the timestamp, count if all timestamps are lesser [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_lower_bound(const dt_timestamp_t *timestamps, size_t count,
+            const dt_timestamp_t *value, size_t *index);
+
+    //! Finds the first timestamp of a sorted array which is greater than a value
+    /*!
+     * \param timestamps Timestamps in ascending order
+     * \param count Count of timestamps
+     * \param value Timestamp to search for
+     * \param index Index of the timestamp, count if no timestamp is greater [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_lower_bound
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_upper_bound(const dt_timestamp_t *timestamps, size_t count,
+            const dt_timestamp_t *value, size_t *index);
+
+    //! Finds the first timestamp of sorted columns which is not lesser than a value
+    /*!
+     * \param seconds Seconds of timestamps in ascending order
+     * \param nano_seconds Nano-seconds of timestamps
+     * \param count Count of timestamps
+     * \param value Timestamp to search for
+     * \param index Index of the timestamp, count if all timestamps are lesser [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_lower_bound
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_lower_bound(const long *seconds, const unsigned long *nano_seconds,
+            size_t count, const dt_timestamp_t *value, size_t *index);
+
+    //! Finds the first timestamp of sorted columns which is greater than a value
+    /*!
+     * \param seconds Seconds of timestamps in ascending order
+     * \param nano_seconds Nano-seconds of timestamps
+     * \param count Count of timestamps
+     * \param value Timestamp to search for
+     * \param index Index of the timestamp, count if no timestamp is greater [OUT]
+     * \return Result status of the operation
+     * \sa dt_timestamps_lower_bound
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_columns_upper_bound(const long *seconds, const unsigned long *nano_seconds,
+            size_t count, const dt_timestamp_t *value, size_t *index);
+
     /*! @}*/
 
     /*!
@@ -208,6 +473,11 @@ extern "C" {
     //! Lookups timezone object for future usage in corresponding api.
     //! Timezone object must be freed with dt_timezone_cleanup() function on successful operation
     /*!
+     * Loaded timezones are cached process-wide, so repeated lookups of the same timezone are cheap and
+     * share the same immutable timezone data.
+     * Conversions update the transition hint kept in the timezone object (see dt_timezone_hint_stats()) even
+     * when they take a const pointer to it, so the object itself must be writable: it must not be defined
+     * const, e.g. as a static const object. Such updates are atomic, so the object can be shared by threads.
      * \param timezone_name name of timezone for lookup, it can be in olsen database format, or in windows standard time format
      * \param timezone [IN/OUT]pointer to timezone object
      * \return Result status of the operation
@@ -215,13 +485,133 @@ extern "C" {
      */
     LIBDT_EXPORT dt_status_t dt_timezone_lookup(const char *timezone_name, dt_timezone_t *timezone);
 
+    //! Initializes timezone object with a fixed UTC offset and without daylight saving time
+    /*!
+     * Conversions with such timezone objects are plain arithmetic, no timezone data is loaded for them.
+     * The abbreviation is "UTC" for zero offset and "+hh", "+hhmm" or "+hhmmss" (or with '-') for the others.
+     * dt_timezone_lookup() makes the same objects for "UTC", "Z", "GMT", "Etc/GMT+N" and ISO 8601 offsets
+     * like "+05:30" or "UTC-08", "GMT" and its synonyms are abbreviated as "GMT" then.
+     * @attention On Windows the offset is kept by the system timezone information in whole minutes, so offsets
+     * with seconds are rejected there with DT_INVALID_ARGUMENT, while they are accepted on the other platforms.
+     * Names recognized by dt_timezone_lookup() are all of whole minutes, so they are accepted everywhere.
+     * Timezone object must be freed with dt_timezone_cleanup() function on successful operation
+     * \param offset_seconds UTC offset in seconds, positive to the east of Greenwich, less than a day by
+     * absolute value and a whole number of minutes on Windows
+     * \param timezone pointer to timezone object [OUT]
+     * \return Result status of the operation
+     * \sa dt_timezone_cleanup
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_fixed(long offset_seconds, dt_timezone_t *timezone);
+
     //! Frees resources connected with timezone object
     /*!
+     * Timezone data shared with other timezone objects remains valid for them.
      * \param timezone pointer to timezone object
      * \return Result status of the operation
      */
     LIBDT_EXPORT dt_status_t dt_timezone_cleanup(dt_timezone_t *timezone);
 
+    //! Returns statistics of the transition hint of timezone object
+    /*!
+     * Every timezone object remembers the transition interval of the last timestamp converted with it
+     * and does not search timezone transitions for the next timestamp falling into the same interval,
+     * which is the common case for sorted or nearly sorted timestamps. Counters are incremented atomically,
+     * so they are exact even if the object is used by several threads at once.
+     * \param timezone pointer to timezone object
+     * \param hits pointer to store number of conversions answered by the hint [OUT]
+     * \param misses pointer to store number of conversions which had to search for the transition [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_hint_stats(const dt_timezone_t *timezone, unsigned long *hits, unsigned long *misses);
+
+    //! Returns UTC offset, daylight saving time flag and abbreviation of a timezone at a timestamp
+    /*!
+     * Only the local time type in effect at the timestamp is looked up, the timestamp is not broken down,
+     * so it is several times cheaper than dt_timestamp_to_representation().
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param timestamp Timestamp to look the offset up at
+     * \param gmtoff Pointer to store UTC offset in seconds, positive to the east of Greenwich [OUT]
+     * \param is_dst Optional pointer to store whether daylight saving time is in effect (can be NULL) [OUT]
+     * \param abbreviation Optional pointer to store timezone abbreviation like "MSK" or "+0530" (can be NULL), it is
+     * valid while the timezone object is, NULL is stored if the abbreviation is not available [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_offset_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp, long *gmtoff,
+                                                   dt_bool_t *is_dst, const char **abbreviation);
+
+    //! Returns UTC offsets, daylight saving time flags and abbreviations of a timezone at an array of timestamps
+    /*!
+     * Gives the same as dt_timezone_offset_at() called for each timestamp.
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param timestamps Timestamps to look the offsets up at
+     * \param count Number of timestamps
+     * \param gmtoffs Array of count UTC offsets in seconds [OUT]
+     * \param is_dst Optional array of count daylight saving time flags (can be NULL) [OUT]
+     * \param abbreviations Optional array of count timezone abbreviations (can be NULL) [OUT]
+     * \return Result status of the operation, the first error met if offsets are not found for some timestamps
+     * (the rest of the arrays is still filled in this case)
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_offsets_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamps, size_t count,
+                                                    long *gmtoffs, dt_bool_t *is_dst, const char **abbreviations);
+
+    //! Finds the first transition of a timezone later than a timestamp
+    /*!
+     * Transitions are the changes of UTC offset, daylight saving time flag or abbreviation. They are taken from
+     * the timezone database and go on after the last of them as the daylight saving time rule of the timezone gives.
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param timestamp Timestamp to start search from
+     * \param transition Found transition [OUT]
+     * \return Result status of the operation, DT_NO_MORE_ITEMS if there is no such transition
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_next_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                                         dt_transition_t *transition);
+
+    //! Finds the last transition of a timezone not later than a timestamp, which is the one in effect at it
+    /*!
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param timestamp Timestamp to start search from
+     * \param transition Found transition [OUT]
+     * \return Result status of the operation, DT_NO_MORE_ITEMS if there is no such transition
+     * \sa dt_timezone_next_transition
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_prev_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                                         dt_transition_t *transition);
+
+    //! Initializes iterator over transitions of a timezone from a timestamp (inclusive) to another one (exclusive)
+    /*!
+     * Offset of the timezone is constant between the transitions returned, so the range can be split by them into
+     * intervals converted each with one UTC offset.
+     * \param timezone Timezone or NULL if local timezone is considered, it must be valid while the iterator is used
+     * \param from Beginning of the range
+     * \param to End of the range
+     * \param iterator Iterator to initialize [OUT]
+     * \return Result status of the operation
+     * \sa dt_transition_iterate
+     */
+    LIBDT_EXPORT dt_status_t dt_timezone_transitions(const dt_timezone_t *timezone, const dt_timestamp_t *from, const dt_timestamp_t *to,
+                                                     dt_transition_iterator_t *iterator);
+
+    //! Returns the next transition of iterator in ascending order
+    /*!
+     * \param iterator Iterator initialized by dt_timezone_transitions()
+     * \param transition Next transition [OUT]
+     * \return Result status of the operation, DT_NO_MORE_ITEMS if there are no more transitions in the range
+     */
+    LIBDT_EXPORT dt_status_t dt_transition_iterate(dt_transition_iterator_t *iterator, dt_transition_t *transition);
+
+    //! Loads the local timezone used for conversions with NULL timezone again if it has been changed
+    /*!
+     * Local timezone is taken from TZ environment variable, or from /etc/localtime if it is not set, when it is
+     * used at first. Conversions do not check them for changes, this function does: it loads the timezone again
+     * only if the value of TZ or the identity, size or modification time of the file differ from the loaded ones,
+     * so it is cheap to call periodically or right after setting TZ. On Windows the system applies its timezone
+     * settings itself.
+     * @attention Timezone data replaced by a call is freed by the next one, which changes the local timezone, so
+     * conversions with NULL timezone running in other threads must not last over two such calls.
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_local_timezone_reload(void);
+
     //! Represents a timestamp using a timezone name
     /*!
      * \param timestamp Timestamp to represent
@@ -231,19 +621,139 @@ extern "C" {
      */
     LIBDT_EXPORT dt_status_t dt_timestamp_to_representation(const dt_timestamp_t *timestamp, const dt_timezone_t *timezone, dt_representation_t *representation);
 
+    //! Represents an array of timestamps using a timezone
+    /*!
+     * Gives the same representations as dt_timestamp_to_representation() called for each timestamp, but
+     * resolves UTC offsets for the whole array at once and breaks down the dates by a vectorized kernel,
+     * so it is much faster on large arrays.
+     * \param timestamps Timestamps to represent
+     * \param count Number of timestamps
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param representations Array of count timestamp representations [OUT]
+     * \return Result status of the operation, the first error met if some timestamps can not be represented
+     * (the rest of the array is still filled in this case)
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamps_to_representations(const dt_timestamp_t *timestamps, size_t count,
+                                                              const dt_timezone_t *timezone, dt_representation_t *representations);
+
+    //! Represents a timestamp in each of an array of timezones
+    /*!
+     * Gives the same representations as dt_timestamp_to_representation() called for each timezone, but breaks
+     * the timestamp down into UTC dates once and applies UTC offsets of the timezones to them with a day carry.
+     * \param timestamp Timestamp to represent
+     * \param timezones Array of count timezones, an item can be NULL if local timezone is considered
+     * \param count Number of timezones
+     * \param representations Array of count timestamp representations [OUT]
+     * \return Result status of the operation, the first error met if the timestamp can not be represented in some
+     * timezones (the rest of the array is still filled in this case)
+     */
+    LIBDT_EXPORT dt_status_t dt_timestamp_to_representations_multi(const dt_timestamp_t *timestamp,
+                                                                   const dt_timezone_t *const *timezones, size_t count,
+                                                                   dt_representation_t *representations);
+
+    //! Initializes converter of ascending timestamps to representations in a timezone
+    /*!
+     * Converter remembers the local day and the next transition of the timezone for the last timestamp converted,
+     * so a timestamp of the same day is converted by updating time of the day only and the next day is got by
+     * incrementing the date. Timestamps going back or jumping over days are converted fully.
+     * \param timezone Timezone or NULL if local timezone is considered, it must be valid while the converter is used
+     * \param converter Converter to initialize [OUT]
+     * \return Result status of the operation
+     * \sa dt_stream_converter_convert
+     */
+    LIBDT_EXPORT dt_status_t dt_stream_converter_init(const dt_timezone_t *timezone, dt_stream_converter_t *converter);
+
+    //! Represents a timestamp by a converter
+    /*!
+     * Gives the same representations as dt_timestamp_to_representation(), but much faster for ascending timestamps.
+     * Converter is changed by the call, so it must not be used by several threads at once.
+     * \param converter Converter initialized by dt_stream_converter_init()
+     * \param timestamp Timestamp to represent
+     * \param representation Timestamp representation [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_stream_converter_convert(dt_stream_converter_t *converter, const dt_timestamp_t *timestamp,
+                                                         dt_representation_t *representation);
+
     //! Returns a timestamps for a representation in timezone by it's name
     /*!
      * It is possible for the representation to have two timestamps, e.g. when a time is "going back" for
-     * an hour.
+     * an hour. Representations skipped by a transition are invalid.
      * \param representation Representation to fetch a timestamp of
      * \param timezone Timezone or NULL if local timezone is considered
-     * \param first_timestamp First representation's timestamp [OUT]
-     * \param second_timestamp Optional second representation's timestamp (can be NULL, not supported at the moment) [OUT]
+     * \param first_timestamp First (the earlier one if there are two) representation's timestamp [OUT]
+     * \param second_timestamp Optional second representation's timestamp, the same as the first one if there
+     * is only one (can be NULL) [OUT]
      * \return Result status of the operation
      */
     LIBDT_EXPORT dt_status_t dt_representation_to_timestamp(const dt_representation_t *representation, const dt_timezone_t *timezone,
                                                             dt_timestamp_t *first_timestamp, dt_timestamp_t *second_timestamp);
 
+    //! Returns a timestamps for a representation in timezone with a policy for representations skipped by a transition
+    /*!
+     * Both timestamps of an ambiguous representation and the one chosen by the policy for a skipped one are found
+     * in one pass over the timezone transitions. On Windows only the system conversion result is available, so the
+     * second timestamp is always the same as the first one there.
+     * \param representation Representation to fetch a timestamp of
+     * \param timezone Timezone or NULL if local timezone is considered
+     * \param gap_policy Resolution of a representation skipped by a transition
+     * \param first_timestamp First (the earlier one if there are two) representation's timestamp [OUT]
+     * \param second_timestamp Optional second representation's timestamp, the same as the first one if there
+     * is only one (can be NULL) [OUT]
+     * \return Result status of the operation
+     */
+    LIBDT_EXPORT dt_status_t dt_representation_to_timestamp_policy(const dt_representation_t *representation, const dt_timezone_t *timezone,
+                                                                   dt_gap_policy_t gap_policy, dt_timestamp_t *first_timestamp,
+                                                                   dt_timestamp_t *second_timestamp);
+
+    //! Converts a representation in one timezone to the representation of the same time in another timezone
+    /*!
+     * Gives the same representation as dt_representation_to_timestamp() followed by dt_timestamp_to_representation()
+     * with the first timestamp, but works on local seconds without intermediate struct tm. If both timezones are
+     * the same, the offset found for the source is used for the result as well.
+     * \param representation Representation to convert
+     * \param from Timezone of the representation or NULL if local timezone is considered
+     * \param to Timezone to convert to or NULL if local timezone is considered
+     * \param result Representation in the target timezone [OUT]
+     * \return Result status of the operation, representations skipped by a transition are invalid
+     */
+    LIBDT_EXPORT dt_status_t dt_convert_representation(const dt_representation_t *representation, const dt_timezone_t *from,
+                                                       const dt_timezone_t *to, dt_representation_t *result);
+
+    //! Converts an array of representations in one timezone to representations in another timezone
+    /*!
+     * Gives the same results as dt_convert_representation() called for each representation. The range of local
+     * times with a single UTC offset found for one representation and the transition hint of the target timezone
+     * are kept for the next one, so runs of close representations are converted by subtraction mostly.
+     * \param representations Representations to convert
+     * \param count Number of representations
+     * \param from Timezone of the representations or NULL if local timezone is considered
+     * \param to Timezone to convert to or NULL if local timezone is considered
+     * \param results Array of count representations in the target timezone [OUT]
+     * \return Result status of the operation, the first error met if some representations can not be converted
+     * (the rest of the array is still filled in this case)
+     */
+    LIBDT_EXPORT dt_status_t dt_convert_representations(const dt_representation_t *representations, size_t count,
+                                                        const dt_timezone_t *from, const dt_timezone_t *to,
+                                                        dt_representation_t *results);
+
+    //! Adds calendar or time units to a representation in a timezone
+    /*!
+     * Date units move the date with the local time of day kept, so 2014-03-29 12:00 plus a day is 2014-03-30 12:00 in
+     * Europe/Berlin although the day lasts 23 hours. Time units are elapsed time, they are added to the time the
+     * representation is resolved to. A local time which occurs twice is resolved to the earlier time.
+     * \param representation Representation to add to
+     * \param unit Unit to add
+     * \param count Number of units to add, negative to subtract
+     * \param timezone Timezone of the representation, NULL for the local one
+     * \param gap_policy Resolution of a local time skipped by a transition, either the result of date units or the
+     * representation for time units
+     * \param result Result representation [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the result does not fit
+     */
+    LIBDT_EXPORT dt_status_t dt_representation_add(const dt_representation_t *representation, dt_unit_t unit, long count,
+            const dt_timezone_t *timezone, dt_gap_policy_t gap_policy, dt_representation_t *result);
+
     //! Returns representation's week day number
     /*!
      * \param representation Representation object
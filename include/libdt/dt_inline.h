@@ -0,0 +1,264 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef DT_INLINE_H
+#define DT_INLINE_H
+
+/*
+ * Cross-platform date/time handling library for C.
+ * Inline timestamp, interval and nano-second arithmetic, included by dt.h.
+ *
+ * The unchecked functions do not validate their arguments and do not detect overflows, results for invalid arguments or
+ * overflowing ones are undefined. They are meant for tight loops over data validated beforehand, where the checked
+ * functions of dt.h cost more in calls and validation than in arithmetic. The checked functions give the same results
+ * for valid arguments, as they are implemented by these ones.
+ */
+
+#include <libdt/export.h>
+#include <libdt/dt_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*!
+     * \defgroup Unchecked Unchecked inline arithmetic functions
+     * @{
+     */
+
+    //! Compares two valid timestamps
+    /*!
+     * \param lhs First timestamp to compare
+     * \param rhs Second timestamp to compare
+     * \return Compare result
+     * \sa dt_compare_timestamps
+     */
+    LIBDT_INLINE dt_compare_result_t dt_compare_timestamps_unchecked(const dt_timestamp_t *lhs, const dt_timestamp_t *rhs)
+    {
+        // Seconds weigh more than nano-seconds, so the sign of the sum is the result
+        int seconds = (lhs->second > rhs->second) - (lhs->second < rhs->second);
+        int nano_seconds = (lhs->nano_second > rhs->nano_second) - (lhs->nano_second < rhs->nano_second);
+        int sum = 2 * seconds + nano_seconds;
+
+        return (dt_compare_result_t) ((sum > 0) - (sum < 0));
+    }
+
+    //! Obtains an offset between two valid timestamps
+    /*!
+     * \param lhs First timestamp
+     * \param rhs Second timestamp
+     * \return Offset from the first timestamp to the second one, forward one for equal timestamps
+     * \sa dt_offset_between
+     */
+    LIBDT_INLINE dt_offset_t dt_offset_between_unchecked(const dt_timestamp_t *lhs, const dt_timestamp_t *rhs)
+    {
+        dt_offset_t result;
+        int is_forward = dt_compare_timestamps_unchecked(lhs, rhs) != DT_GREATER;
+        const dt_timestamp_t *lower = is_forward ? lhs : rhs;
+        const dt_timestamp_t *higher = is_forward ? rhs : lhs;
+        unsigned long borrow = higher->nano_second < lower->nano_second;
+
+        result.duration.seconds = (unsigned long) higher->second - (unsigned long) lower->second - borrow;
+        result.duration.nano_seconds = higher->nano_second + borrow * 1000000000UL - lower->nano_second;
+        result.is_forward = is_forward ? DT_TRUE : DT_FALSE;
+        return result;
+    }
+
+    //! Applies a valid offset on a valid timestamp, the result must not overflow
+    /*!
+     * \param lhs Timestamp to apply the offset on
+     * \param rhs Offset to apply on timestamp
+     * \return Result timestamp
+     * \sa dt_apply_offset
+     */
+    LIBDT_INLINE dt_timestamp_t dt_apply_offset_unchecked(const dt_timestamp_t *lhs, const dt_offset_t *rhs)
+    {
+        dt_timestamp_t result;
+        unsigned long carry = 0;
+
+        if (rhs->is_forward) {
+            result.nano_second = lhs->nano_second + rhs->duration.nano_seconds;
+            carry = result.nano_second >= 1000000000UL;
+            result.second = (long) ((unsigned long) lhs->second + rhs->duration.seconds + carry);
+            result.nano_second -= carry * 1000000000UL;
+        } else {
+            carry = lhs->nano_second < rhs->duration.nano_seconds;
+            result.second = (long) ((unsigned long) lhs->second - rhs->duration.seconds - carry);
+            result.nano_second = lhs->nano_second + carry * 1000000000UL - rhs->duration.nano_seconds;
+        }
+        return result;
+    }
+
+    //! Compares two valid intervals
+    /*!
+     * \param lhs First interval to compare
+     * \param rhs Second interval to compare
+     * \return Compare result
+     * \sa dt_compare_intervals
+     */
+    LIBDT_INLINE dt_compare_result_t dt_compare_intervals_unchecked(const dt_interval_t *lhs, const dt_interval_t *rhs)
+    {
+        int seconds = (lhs->seconds > rhs->seconds) - (lhs->seconds < rhs->seconds);
+        int nano_seconds = (lhs->nano_seconds > rhs->nano_seconds) - (lhs->nano_seconds < rhs->nano_seconds);
+        int sum = 2 * seconds + nano_seconds;
+
+        return (dt_compare_result_t) ((sum > 0) - (sum < 0));
+    }
+
+    //! Summarizes two valid intervals, the sum must not overflow
+    /*!
+     * \param lhs First interval to summarize
+     * \param rhs Second interval to summarize
+     * \return Result interval
+     * \sa dt_sum_intervals
+     */
+    LIBDT_INLINE dt_interval_t dt_sum_intervals_unchecked(const dt_interval_t *lhs, const dt_interval_t *rhs)
+    {
+        dt_interval_t result;
+        unsigned long carry = 0;
+
+        result.nano_seconds = lhs->nano_seconds + rhs->nano_seconds;
+        carry = result.nano_seconds >= 1000000000UL;
+        result.seconds = lhs->seconds + rhs->seconds + carry;
+        result.nano_seconds -= carry * 1000000000UL;
+        return result;
+    }
+
+    //! Subtracts a valid interval from a valid interval which is not lesser than it
+    /*!
+     * \param lhs Interval to subtract from
+     * \param rhs Interval to subtract
+     * \return Result interval
+     * \sa dt_sub_intervals
+     */
+    LIBDT_INLINE dt_interval_t dt_sub_intervals_unchecked(const dt_interval_t *lhs, const dt_interval_t *rhs)
+    {
+        dt_interval_t result;
+        unsigned long borrow = lhs->nano_seconds < rhs->nano_seconds;
+
+        result.seconds = lhs->seconds - rhs->seconds - borrow;
+        result.nano_seconds = lhs->nano_seconds + borrow * 1000000000UL - rhs->nano_seconds;
+        return result;
+    }
+
+    /*! @}*/
+
+    /*!
+     * \addtogroup Nanoseconds
+     * @{
+     */
+
+    //! Adds nano-seconds with overflow check
+    /*!
+     * \param lhs First addend
+     * \param rhs Second addend
+     * \param result Sum [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the sum is out of dt_ns_t range
+     */
+    LIBDT_INLINE dt_status_t dt_ns_add(dt_ns_t lhs, dt_ns_t rhs, dt_ns_t *result)
+    {
+        if (!result) {
+            return DT_INVALID_ARGUMENT;
+        }
+        if ((rhs > 0 && lhs > DT_NS_MAX - rhs) || (rhs < 0 && lhs < DT_NS_MIN - rhs)) {
+            return DT_OVERFLOW;
+        }
+        *result = lhs + rhs;
+        return DT_OK;
+    }
+
+    //! Subtracts nano-seconds with overflow check
+    /*!
+     * \param lhs Minuend
+     * \param rhs Subtrahend
+     * \param result Difference [OUT]
+     * \return Result status of the operation, DT_OVERFLOW if the difference is out of dt_ns_t range
+     */
+    LIBDT_INLINE dt_status_t dt_ns_sub(dt_ns_t lhs, dt_ns_t rhs, dt_ns_t *result)
+    {
+        if (!result) {
+            return DT_INVALID_ARGUMENT;
+        }
+        if ((rhs < 0 && lhs > DT_NS_MAX + rhs) || (rhs > 0 && lhs < DT_NS_MIN + rhs)) {
+            return DT_OVERFLOW;
+        }
+        *result = lhs - rhs;
+        return DT_OK;
+    }
+
+    //! Adds nano-seconds, the sum is clamped to dt_ns_t range
+    /*!
+     * \param lhs First addend
+     * \param rhs Second addend
+     * \return Sum, DT_NS_MAX or DT_NS_MIN if it is out of dt_ns_t range
+     */
+    LIBDT_INLINE dt_ns_t dt_ns_add_saturated(dt_ns_t lhs, dt_ns_t rhs)
+    {
+        if (rhs > 0 && lhs > DT_NS_MAX - rhs) {
+            return DT_NS_MAX;
+        }
+        if (rhs < 0 && lhs < DT_NS_MIN - rhs) {
+            return DT_NS_MIN;
+        }
+        return lhs + rhs;
+    }
+
+    //! Subtracts nano-seconds, the difference is clamped to dt_ns_t range
+    /*!
+     * \param lhs Minuend
+     * \param rhs Subtrahend
+     * \return Difference, DT_NS_MAX or DT_NS_MIN if it is out of dt_ns_t range
+     */
+    LIBDT_INLINE dt_ns_t dt_ns_sub_saturated(dt_ns_t lhs, dt_ns_t rhs)
+    {
+        if (rhs < 0 && lhs > DT_NS_MAX + rhs) {
+            return DT_NS_MAX;
+        }
+        if (rhs > 0 && lhs < DT_NS_MIN + rhs) {
+            return DT_NS_MIN;
+        }
+        return lhs - rhs;
+    }
+
+    //! Compares nano-seconds
+    /*!
+     * \param lhs First value to compare
+     * \param rhs Second value to compare
+     * \return Compare result
+     */
+    LIBDT_INLINE dt_compare_result_t dt_ns_compare(dt_ns_t lhs, dt_ns_t rhs)
+    {
+        return (dt_compare_result_t) ((lhs > rhs) - (lhs < rhs));
+    }
+
+    /*! @}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DT_INLINE_H
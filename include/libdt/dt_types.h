@@ -59,6 +59,26 @@ typedef enum {
     DT_GREATER = 1
 } dt_compare_result_t;
 
+//! Resolution of a local time skipped by a timezone transition (e.g. 02:30 when clocks go from 02:00 to 03:00)
+typedef enum {
+    DT_GAP_REJECT,                          //!< Time is invalid, DT_INVALID_ARGUMENT is returned
+    DT_GAP_EARLIEST,                        //!< Time is read with the UTC offset after the transition (02:30 becomes 01:30)
+    DT_GAP_LATEST,                          //!< Time is read with the UTC offset before the transition (02:30 becomes 03:30)
+    DT_GAP_SHIFT_FORWARD                    //!< Time is moved to the transition (02:30 becomes 03:00)
+} dt_gap_policy_t;
+
+//! Unit of arithmetic on representations
+typedef enum {
+    DT_UNIT_YEAR,                           //!< Calendar year, the day is clamped to the end of the month (Feb 29 becomes Feb 28)
+    DT_UNIT_MONTH,                          //!< Calendar month, the day is clamped to the end of the month (Jan 31 becomes Feb 28)
+    DT_UNIT_WEEK,                           //!< Seven calendar days
+    DT_UNIT_DAY,                            //!< Calendar day
+    DT_UNIT_BUSINESS_DAY,                   //!< Calendar day from Monday to Friday
+    DT_UNIT_HOUR,                           //!< Hour of elapsed time
+    DT_UNIT_MINUTE,                         //!< Minute of elapsed time
+    DT_UNIT_SECOND                          //!< Second of elapsed time
+} dt_unit_t;
+
 #define DT_SECONDS_PER_DAY 86400
 #define DT_SECONDS_PER_HOUR 3600
 #define DT_SECONDS_PER_MINUTE 60
@@ -86,6 +106,17 @@ typedef struct dt_offset {
     dt_bool_t is_forward;                   //!< Offset direction
 } dt_offset_t;
 
+//! Signed 64-bit number of nano-seconds
+/*!
+ * It holds a timestamp as nano-seconds from the epoch (from 1677-09-21 to 2262-04-11 for POSIX epoch) or an offset
+ * of about 292 years by absolute value, so it can be stored in 8 bytes and added, subtracted and compared in one register.
+ */
+typedef long long dt_ns_t;
+
+#define DT_NS_MAX 9223372036854775807LL
+#define DT_NS_MIN (-DT_NS_MAX - 1LL)
+#define DT_NS_PER_SECOND 1000000000LL
+
 //! Date/time representation object
 typedef struct dt_representation {
     int year;                               //!< Year (any, except 0)
@@ -98,7 +129,8 @@ typedef struct dt_representation {
 } dt_representation_t;
 
 //! Timezone representation
-//! @attention it's internal implementation can be changed from version to version
+//! @attention it's internal implementation can be changed from version to version, conversions update it
+//! through const pointers, so timezone objects must not be defined const
 typedef struct dt_timezone {
     //! @cond Doxygen_Suppress
 #if defined(__CYGWIN__) || defined(WIN32)
@@ -107,8 +139,47 @@ typedef struct dt_timezone {
     size_t reg_tz_data_size;
 #else
     const struct state *state;
+    dt_bool_t is_fixed;                     // Timezone has a fixed UTC offset, state is not used then
+    long gmtoff;                            // UTC offset of fixed offset timezone in seconds
+    char abbreviation[8];                   // Abbreviation of fixed offset timezone like "UTC" or "+0530"
+    int transition_hint;                    // Transition interval of the last conversion
+    unsigned long hint_hits;                // Conversions answered by the transition hint
+    unsigned long hint_misses;              // Conversions which had to search for the transition
 #endif
     //! @endcond
 } dt_timezone_t;
 
+//! Converter of ascending timestamps to representations in a timezone
+//! @attention it's internal implementation can be changed from version to version
+typedef struct dt_stream_converter {
+    //! @cond Doxygen_Suppress
+    const dt_timezone_t *timezone;
+    dt_representation_t representation;     // Representation of the last timestamp converted
+    long last;                              // Last timestamp converted
+    long day_start;                         // Timestamp of the beginning of the local day of the last one
+    long limit;                             // Next transition, the cached offset is in effect till it
+    int transition_hint;                    // Transition interval of the last full conversion
+    dt_bool_t is_cached;                    // Fields above are valid for the next conversion
+    //! @endcond
+} dt_stream_converter_t;
+
+//! Timezone transition, the change of UTC offset, daylight saving time flag or abbreviation of a timezone
+typedef struct dt_transition {
+    dt_timestamp_t timestamp;               //!< Instant of the transition, the new offset is in effect from it
+    long gmtoff_before;                     //!< UTC offset before the transition in seconds
+    long gmtoff_after;                      //!< UTC offset after the transition in seconds
+    dt_bool_t is_dst_before;                //!< Daylight saving time flag before the transition
+    dt_bool_t is_dst_after;                 //!< Daylight saving time flag after the transition
+} dt_transition_t;
+
+//! Iterator over transitions of a timezone in a range of timestamps
+typedef struct dt_transition_iterator {
+    //! @cond Doxygen_Suppress
+    const dt_timezone_t *timezone;
+    long next;                              // Transitions later than it are to be returned
+    long last;                              // Transitions not later than it are to be returned
+    dt_bool_t done;
+    //! @endcond
+} dt_transition_iterator_t;
+
 #endif // _DT_TYPES_H
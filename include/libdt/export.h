@@ -11,4 +11,11 @@
 #define LIBDT_EXPORT
 #endif
 
+// Functions defined in headers, MSVC knows inline for C code as __inline only
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define LIBDT_INLINE static __inline
+#else
+#define LIBDT_INLINE static inline
+#endif
+
 #endif /* _LIBDT_DLLDEFINES_H_ */
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# Creates from a compiled zoneinfo directory (/usr/share/zoneinfo by default) C source file
+# with the timezone database embedded as a read-only table, which is used by libtz when the
+# library is built with LIBDT_EMBED_TZDATA option (see src/unix/libtz/tzdata.h)
+#
+# Only TZif files are taken, the 'posix' and 'right' subtrees are skipped. Files with the same
+# content (links of the same zone) share their data in the blob. Zone names in the index are
+# sorted by byte value, so they can be searched with strcmp() based binary search
+
+import os
+import sys
+
+TZ_MAGIC = b'TZif'
+SKIPPED_DIRS = ('posix', 'right')
+SKIPPED_FILES = ('localtime',)
+BYTES_PER_LINE = 16
+
+def getZoneinfoDir():
+    if len(sys.argv) > 1:
+        return sys.argv[1]
+    return '/usr/share/zoneinfo'
+
+def collectZones(strZoneinfoDir):
+    zones = {}
+    for strDir, dirNames, fileNames in os.walk(strZoneinfoDir, followlinks=True):
+        if strDir == strZoneinfoDir:
+            dirNames[:] = [d for d in dirNames if d not in SKIPPED_DIRS]
+        for strFile in fileNames:
+            strPath = os.path.join(strDir, strFile)
+            strName = os.path.relpath(strPath, strZoneinfoDir).replace(os.sep, '/')
+            if strName in SKIPPED_FILES:
+                continue
+            f = open(strPath, 'rb')
+            data = f.read()
+            f.close()
+            if data[:len(TZ_MAGIC)] == TZ_MAGIC:
+                zones[strName] = data
+    return zones
+
+def byteValues(data):
+    if isinstance(data, str):
+        return [ord(c) for c in data]
+    return list(data)
+
+def main():
+    strZoneinfoDir = getZoneinfoDir()
+    zones = collectZones(strZoneinfoDir)
+    offsets = {}
+    blob = []
+    index = []
+    for strName in sorted(zones.keys()):
+        data = zones[strName]
+        if data not in offsets:
+            offsets[data] = len(blob)
+            blob.extend(byteValues(data))
+        index.append((strName, offsets[data], len(data)))
+
+    out = sys.stdout
+    out.write('//Generated from ' + strZoneinfoDir + ' by embed_tzdata.py, do not edit\n')
+    out.write('#include <stddef.h>\n')
+    out.write('#include "tzdata.h"\n\n')
+    out.write('const unsigned char tzdata_blob[] = {\n')
+    for i in range(0, len(blob), BYTES_PER_LINE):
+        out.write('    ' + ', '.join(['0x%02x' % b for b in blob[i:i + BYTES_PER_LINE]]) + ',\n')
+    out.write('};\n\n')
+    out.write('const struct tzdata_entry tzdata_index[] = {\n')
+    for strName, offset, size in index:
+        out.write('    {"%s", %d, %d},\n' % (strName, offset, size))
+    out.write('};\n\n')
+    out.write('const size_t tzdata_count = %d;\n' % len(index))
+
+main()
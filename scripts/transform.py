@@ -7,10 +7,15 @@
 # pointed as first argument of script, if argument not setted, tryes to find it by relative path
 # '../resources/windowsZones.xml'
 
+from __future__ import print_function
+
 import sys
 import os
-import string
-import urllib2
+try:
+    from urllib.request import urlopen
+    from urllib.error import URLError
+except ImportError:
+    from urllib2 import urlopen, URLError
 from xml.dom.minidom import *
 
 def getXmlFromFile():
@@ -18,21 +23,21 @@ def getXmlFromFile():
     if len(sys.argv) > 2 :
         strXmlFile = sys.argv[2]
     xml = parse(strXmlFile)
-    print '//Obtained from local file'
+    print('//Obtained from local file')
     return xml
 
 def getXmlFromWeb():
     strUrl = 'http://unicode.org/repos/cldr/trunk/common/supplemental/windowsZones.xml' 
     try:
-        response = urllib2.urlopen(strUrl)
+        response = urlopen(strUrl)
         xml = parseString(response.read())
-        print '//Obtained by internet from ', strUrl
-    except urllib2.URLError:
+        print('//Obtained by internet from ', strUrl)
+    except URLError:
         xml = getXmlFromFile()
     return xml
 
 def getXml():
-    print '//Generated from windowsZones.xml'
+    print('//Generated from windowsZones.xml')
     if len(sys.argv) > 1 :
         if sys.argv[1] == "--remote":
             return getXmlFromWeb()
@@ -42,36 +47,151 @@ def parseMapZone(mapZone):
     strType = mapZone._attrs['type'].value 
     strOther = mapZone._attrs['other'].value 
     strTerritory = mapZone._attrs['territory'].value 
-    strTypes = string.split(strType, ' ')
-    strMapZones = []
+    strTypes = strType.split(' ')
+    mapZones = []
     for strZoneType in strTypes :
-        strMapZones.append('{"' + strOther + '", "' + strTerritory + '", "' +\
-        strZoneType + '"}')
-    strTypes
-    strMapZone = string.join(strMapZones, ',\n')   
-    return strMapZone
+        mapZones.append((strOther, strTerritory, strZoneType))
+    return mapZones
 
 def parseMapZones(xml):
-    strMapZones = [] 
-    mapZones = xml.getElementsByTagName('mapZone')
-    for mapZone in mapZones : 
-        strMapZones.append(parseMapZone(mapZone))
-    mapZones
-    strMapZonesJoined = string.join(strMapZones, ',\n')
-    return strMapZonesJoined, len(mapZones)
+    mapZones = []
+    for mapZone in xml.getElementsByTagName('mapZone') :
+        mapZones.extend(parseMapZone(mapZone))
+    return mapZones
+
+# Alias kinds, the same as tz_alias_kind_t values in src/tzmapping.h
+KIND_ABBREVIATION = 'DT_TZMAP_ABBREVIATION'
+KIND_WIN_STANDARD_TIME = 'DT_TZMAP_WIN_STANDARD_TIME'
+KIND_OLSEN_NAME = 'DT_TZMAP_OLSEN_NAME'
+
+def collectAliases(strName, mapZones):
+    # All aliases reachable from the name through windows standard time and olsen names, in order
+    # of discovery (this is the order in which tzmap_map() used to find them at runtime)
+    aliases = []
+    def insertAliases(strMapped):
+        for strOther, strTerritory, strType in mapZones :
+            if strType == strMapped or strOther == strMapped :
+                for alias in ((strOther, KIND_WIN_STANDARD_TIME), (strType, KIND_OLSEN_NAME),
+                              (strTerritory, KIND_ABBREVIATION)) :
+                    if alias not in aliases :
+                        aliases.append(alias)
+    insertAliases(strName)
+    i = 0
+    while i < len(aliases) :
+        strAlias, kind = aliases[i]
+        if kind != KIND_ABBREVIATION and strAlias != strName :
+            insertAliases(strAlias)
+        i += 1
+    return aliases
+
+def leadAliases(aliases):
+    # First windows standard time and first olsen name aliases, these are the ones to be used
+    # for the timezone by the library, so they are iterated first
+    leads = []
+    for kind in (KIND_WIN_STANDARD_TIME, KIND_OLSEN_NAME) :
+        leads.append(min([i for i in range(len(aliases)) if aliases[i][1] == kind]))
+    leads.sort()
+    return leads
+
+def aliasHash(seed, strName):
+    # 32-bit FNV based hash, must be the same as tz_alias_hash() in src/tzmapping.c
+    if seed == 0 :
+        seed = 0x01000193
+    for c in strName :
+        seed = ((seed * 0x01000193) ^ ord(c)) & 0xffffffff
+    return seed
+
+def buildPerfectHash(strNames):
+    # Hash and displace: names are distributed by aliasHash(0, name) to buckets, each bucket gets
+    # a seed placing all of it's names to free slots, buckets of single name point to the slot directly
+    # as -(slot + 1)
+    bucketsCount = len(strNames)
+    buckets = [[] for i in range(bucketsCount)]
+    for strName in strNames :
+        buckets[aliasHash(0, strName) % bucketsCount].append(strName)
+    displacements = [0] * bucketsCount
+    slots = [None] * len(strNames)
+    order = sorted(range(bucketsCount), key = lambda b: -len(buckets[b]))
+    for b in order :
+        if len(buckets[b]) <= 1 :
+            break
+        seed = 1
+        while True :
+            bucketSlots = [aliasHash(seed, strName) % len(slots) for strName in buckets[b]]
+            if len(set(bucketSlots)) == len(bucketSlots) and \
+                    all([slots[slot] is None for slot in bucketSlots]) :
+                break
+            seed += 1
+        displacements[b] = seed
+        for strName, slot in zip(buckets[b], bucketSlots) :
+            slots[slot] = strName
+    freeSlots = [slot for slot in range(len(slots)) if slots[slot] is None]
+    for b in order :
+        if len(buckets[b]) == 1 :
+            slot = freeSlots.pop()
+            displacements[b] = -slot - 1
+            slots[slot] = buckets[b][0]
+    return slots, displacements
+
+def printAliasTables(mapZones):
+    strNames = []
+    for strOther, strTerritory, strType in mapZones :
+        for strName in (strOther, strType) :
+            if strName not in strNames :
+                strNames.append(strName)
+    # Aliases are stored once per group of names mapped to each other
+    groups = []
+    groupByAliases = {}
+    keys = {}
+    for strName in strNames :
+        aliases = collectAliases(strName, mapZones)
+        groupKey = frozenset(aliases)
+        if groupKey not in groupByAliases :
+            groupByAliases[groupKey] = len(groups)
+            groups.append(aliases)
+        group = groups[groupByAliases[groupKey]]
+        leads = [group.index(aliases[i]) for i in leadAliases(aliases)]
+        keys[strName] = (groupByAliases[groupKey], leads)
+
+    print('static const tz_alias_t tz_alias_table[] = {')
+    groupStarts = []
+    start = 0
+    for group in groups :
+        groupStarts.append(start)
+        for strAlias, kind in group :
+            print('    {' + kind + ', "' + strAlias + '"},')
+        start += len(group)
+    print('};\n')
+
+    slots, displacements = buildPerfectHash(strNames)
+    print('static const struct tz_aliases tz_alias_keys[] = {')
+    for strName in slots :
+        groupIndex, leads = keys[strName]
+        begin = groupStarts[groupIndex]
+        print('    {"%s", tz_alias_table + %d, tz_alias_table + %d, {tz_alias_table + %d, tz_alias_table + %d}},' %
+              (strName, begin, begin + len(groups[groupIndex]), begin + leads[0], begin + leads[1]))
+    print('};')
+    print('#define TZ_ALIAS_KEYS_SIZE', len(slots), '\n')
+    print('static const long tz_alias_displacements[] = {')
+    for i in range(0, len(displacements), 16) :
+        print('    ' + ', '.join([str(d) for d in displacements[i:i + 16]]) + ',')
+    print('};')
+    print('#define TZ_ALIAS_DISPLACEMENTS_SIZE', len(displacements), '\n')
 
 def help():
-    print 'usage: ', sys.argv[0], ' [--remote| --local [local xml file]]'
+    print('usage: ', sys.argv[0], ' [--remote| --local [local xml file]]')
 
-print '// --- do not edit it manualy! File generated by scripts/transform.py!'
-print 'struct tz_unicode_mapping {const char *other; const char* territory; const char* type;};'
-print 'const struct tz_unicode_mapping tz_unicode_map[] = {'
-zonesCount = 0
+print('// --- do not edit it manualy! File generated by scripts/transform.py!')
+print('struct tz_unicode_mapping {const char *other; const char* territory; const char* type;};')
+print('const struct tz_unicode_mapping tz_unicode_map[] = {')
+mapZones = []
 try:
-    zonesStr, zonesCount = parseMapZones(getXml())
-    print zonesStr
+    mapZones = parseMapZones(getXml())
+    print(',\n'.join(['{"' + strOther + '", "' + strTerritory + '", "' + strType + '"}'
+                      for strOther, strTerritory, strType in mapZones]))
 except :
-    print '#error Cant generate timezones mapping watch the script ' +\
-            os.path.abspath(sys.argv[0])
-print '};'
-print 'const size_t tz_unicode_map_size = ', zonesCount, ';\n'
+    print('#error Cant generate timezones mapping watch the script ' +
+          os.path.abspath(sys.argv[0]))
+print('};')
+print('const size_t tz_unicode_map_size = ', len(mapZones), ';\n')
+printAliasTables(mapZones)
@@ -27,14 +27,19 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #define LIBDT_EXPORTS
+#if !defined(__CYGWIN__) && !defined(WIN32)
+#define _XOPEN_SOURCE 700   // strptime() declaration
+#endif
 #include <libdt/dt_posix.h>
 #include <libdt/dt.h>
+#include <libdt/dt_inline.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <limits.h>
 #include <stdio.h>
 #include <float.h>
+#include "dt_calendar.h"
 #include <ctype.h>
 
 /*
@@ -48,6 +53,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
  */
 
 static const int month_days[] = { 0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+static const int days_before_month[] = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
 static const unsigned long MAX_NANOSECONDS = 999999999UL;
 
 static dt_bool_t is_unsigned_long_sum_overflows(unsigned long lhs, unsigned long rhs)
@@ -118,67 +124,17 @@ dt_status_t dt_compare_timestamps(const dt_timestamp_t *lhs, const dt_timestamp_
         return DT_INVALID_ARGUMENT;
     }
 
-    if (lhs->second > rhs->second) {
-        *result = DT_GREATER;
-        return DT_OK;
-    }
-    if (lhs->second < rhs->second) {
-        *result = DT_LESSER;
-        return DT_OK;
-    }
-    if (lhs->nano_second > rhs->nano_second) {
-        *result = DT_GREATER;
-        return DT_OK;
-    }
-    if (lhs->nano_second < rhs->nano_second) {
-        *result = DT_LESSER;
-        return DT_OK;
-    }
-    *result = DT_EQUALS;
+    *result = dt_compare_timestamps_unchecked(lhs, rhs);
     return DT_OK;
 }
 
 dt_status_t dt_offset_between(const dt_timestamp_t *lhs, const dt_timestamp_t *rhs, dt_offset_t *result)
 {
-    dt_compare_result_t cr = DT_EQUALS;
-    const dt_timestamp_t *lower_timestamp = NULL;
-    const dt_timestamp_t *higher_timestamp = NULL;
-    dt_bool_t is_forward = DT_FALSE;
-    unsigned long seconds = 0;
-    long nano_seconds = 0;
-    dt_status_t s = DT_UNKNOWN_ERROR;
-
-
     if (dt_validate_timestamp(lhs) != DT_TRUE || dt_validate_timestamp(rhs) != DT_TRUE || !result) {
         return DT_INVALID_ARGUMENT;
     }
 
-    s = dt_compare_timestamps(lhs, rhs, &cr);
-    if (s != DT_OK) {
-        return s;
-    }
-    lower_timestamp = cr < 0 ? lhs : rhs;
-    higher_timestamp = cr < 0 ? rhs : lhs;
-    seconds = higher_timestamp->second - lower_timestamp->second;
-    nano_seconds = (long) higher_timestamp->nano_second - (long) lower_timestamp->nano_second;
-    is_forward = cr < 0 ? DT_TRUE : DT_FALSE;
-
-
-    if (cr == DT_EQUALS) {
-        // Equal timestamps case
-        result->duration.seconds = 0L;
-        result->duration.nano_seconds = 0L;
-        result->is_forward = DT_TRUE;
-        return DT_OK;
-    }
-
-    if (nano_seconds < 0L) {
-        seconds -= 1L;
-        nano_seconds += 1000000000UL;
-    }
-    result->duration.seconds = seconds;
-    result->duration.nano_seconds = nano_seconds;
-    result->is_forward = is_forward;
+    *result = dt_offset_between_unchecked(lhs, rhs);
     return DT_OK;
 }
 
@@ -190,61 +146,36 @@ dt_bool_t dt_validate_offset(const dt_offset_t *offset)
     return DT_TRUE;
 }
 
-static dt_status_t dt_apply_interval_forward(const dt_timestamp_t *lhs, const dt_interval_t *duration, dt_timestamp_t *result)
+// Checks whether the result of applying valid offset on valid timestamp is out of timestamp range
+static dt_bool_t is_apply_offset_overflows(const dt_timestamp_t *lhs, const dt_offset_t *rhs)
 {
+    unsigned long carry = 0;
+    unsigned long distance = 0;
 
-    unsigned long duration_seconds_full_part = 0UL;
-    unsigned long nanoseconds_second_part = 0UL;
-    unsigned long nano_seconds = 0UL;
-    unsigned long max = LONG_MAX;
-
-    nano_seconds = lhs->nano_second + duration->nano_seconds;//cannot be owerflowed
-    nanoseconds_second_part = nano_seconds / 1000000000UL;
-    duration_seconds_full_part = duration->seconds + nanoseconds_second_part;
-    if (is_unsigned_long_sum_overflows(duration->seconds, nanoseconds_second_part) == DT_TRUE ||
-            (duration_seconds_full_part >  max - lhs->second)) {
-        return DT_OVERFLOW;
+    if (rhs->is_forward) {
+        carry = (lhs->nano_second + rhs->duration.nano_seconds) / 1000000000UL;
+        // Distance from the timestamp second to the greatest one
+        distance = (unsigned long) LONG_MAX - (unsigned long) lhs->second;
+        return (is_unsigned_long_sum_overflows(rhs->duration.seconds, carry) == DT_TRUE ||
+                rhs->duration.seconds + carry > distance) ? DT_TRUE : DT_FALSE;
     }
 
-    result->second = duration_seconds_full_part + lhs->second;
-    result->nano_second = nano_seconds % 1000000000UL;
-    return DT_OK;
-}
-
-static dt_status_t dt_apply_interval_backward(const dt_timestamp_t *lhs, const dt_interval_t *duration, dt_timestamp_t *result)
-{
-
-    long min = LONG_MIN;
-    if (lhs->nano_second >= duration->nano_seconds) {
-        if (duration->seconds > (unsigned long)(-min) + lhs->second) {
-            return DT_OVERFLOW;
-        }
-        result->nano_second = lhs->nano_second - duration->nano_seconds;
-        result->second = lhs->second - duration->seconds;
-    } else {
-        if (lhs->second == LONG_MIN || (duration->seconds  > (unsigned long)(-min) + lhs->second - 1)) {
-            return DT_OVERFLOW;
-        }
-        result->nano_second = duration->nano_seconds - lhs->nano_second;
-        result->second = lhs->second - duration->seconds - 1;
-        result->nano_second = 1000000000UL - result->nano_second;
-    }
-    return DT_OK;
+    carry = lhs->nano_second < rhs->duration.nano_seconds;
+    // Distance from the lowest second to the timestamp second
+    distance = (unsigned long) lhs->second - (unsigned long) LONG_MIN;
+    return (distance < carry || rhs->duration.seconds > distance - carry) ? DT_TRUE : DT_FALSE;
 }
 
 dt_status_t dt_apply_offset(const dt_timestamp_t *lhs, const dt_offset_t *rhs, dt_timestamp_t *result)
 {
-
     if (dt_validate_timestamp(lhs) != DT_TRUE || dt_validate_offset(rhs) != DT_TRUE || !result) {
         return DT_INVALID_ARGUMENT;
     }
-
-
-    if (rhs->is_forward) {
-        return dt_apply_interval_forward(lhs, &rhs->duration, result);
-    } else {
-        return dt_apply_interval_backward(lhs, &rhs->duration, result);
+    if (is_apply_offset_overflows(lhs, rhs) == DT_TRUE) {
+        return DT_OVERFLOW;
     }
+
+    *result = dt_apply_offset_unchecked(lhs, rhs);
     return DT_OK;
 }
 
@@ -273,81 +204,38 @@ dt_status_t dt_compare_intervals(const dt_interval_t *lhs, const dt_interval_t *
         return DT_INVALID_ARGUMENT;
     }
 
-    if (lhs->seconds > rhs->seconds) {
-        *result = DT_GREATER;
-        return DT_OK;
-    }
-    if (lhs->seconds < rhs->seconds) {
-        *result = DT_LESSER;
-        return DT_OK;
-    }
-    if (lhs->nano_seconds > rhs->nano_seconds) {
-        *result = DT_GREATER;
-        return DT_OK;
-    }
-    if (lhs->nano_seconds < rhs->nano_seconds) {
-        *result = DT_LESSER;
-        return DT_OK;
-    }
-    *result = DT_EQUALS;
+    *result = dt_compare_intervals_unchecked(lhs, rhs);
     return DT_OK;
 }
 
 dt_status_t dt_sum_intervals(const dt_interval_t *lhs, const dt_interval_t *rhs, dt_interval_t *result)
 {
-    unsigned long seconds = 0;
-    unsigned long nano_seconds = 0;
     unsigned long seconds_nanoseconds_part = 0;
-    unsigned long full_seconds_part  = 0;
 
     if (dt_validate_interval(lhs) == DT_FALSE || dt_validate_interval(rhs) == DT_FALSE || !result) {
         return DT_INVALID_ARGUMENT;
     }
 
     seconds_nanoseconds_part = (lhs->nano_seconds + rhs->nano_seconds) / 1000000000UL;
-    full_seconds_part = rhs->seconds + seconds_nanoseconds_part;
     if (is_unsigned_long_sum_overflows(rhs->seconds, seconds_nanoseconds_part) == DT_TRUE ||
-            is_unsigned_long_sum_overflows(lhs->seconds, full_seconds_part) == DT_TRUE) {
+            is_unsigned_long_sum_overflows(lhs->seconds, rhs->seconds + seconds_nanoseconds_part) == DT_TRUE) {
         return DT_OVERFLOW;
     }
-    seconds = lhs->seconds + full_seconds_part;
-    nano_seconds = (lhs->nano_seconds + rhs->nano_seconds) % 1000000000UL;
 
-    result->seconds = seconds;
-    result->nano_seconds = nano_seconds;
+    *result = dt_sum_intervals_unchecked(lhs, rhs);
     return DT_OK;
 }
 
 dt_status_t dt_sub_intervals(const dt_interval_t *lhs, const dt_interval_t *rhs, dt_interval_t *result)
 {
-    dt_compare_result_t cr = 0;
-    unsigned long seconds = 0;
-    unsigned long nano_seconds = 0;
-    dt_status_t s = DT_UNKNOWN_ERROR;
-
-    if (!lhs || !rhs || !result) {
+    if (dt_validate_interval(lhs) == DT_FALSE || dt_validate_interval(rhs) == DT_FALSE || !result) {
         return DT_INVALID_ARGUMENT;
     }
-
-    s = dt_compare_intervals(lhs, rhs, &cr);
-
-    if (s != DT_OK) {
-        return s;
-    }
-    if (cr == DT_LESSER) {
+    if (dt_compare_intervals_unchecked(lhs, rhs) == DT_LESSER) {
         return DT_OVERFLOW;
     }
 
-    seconds = lhs->seconds - rhs->seconds - (lhs->nano_seconds < rhs->nano_seconds ? 1L : 0L);
-    if (lhs->nano_seconds < rhs->nano_seconds) {
-        nano_seconds = 1000000000UL + lhs->nano_seconds - rhs->nano_seconds;
-    } else {
-        nano_seconds = lhs->nano_seconds - rhs->nano_seconds;
-    }
-
-
-    result->seconds = seconds;
-    result->nano_seconds = nano_seconds;
+    *result = dt_sub_intervals_unchecked(lhs, rhs);
     return DT_OK;
 }
 
@@ -378,6 +266,338 @@ dt_status_t dt_mul_interval(const dt_interval_t *lhs, double rhs, dt_interval_t
     return DT_OK;
 }
 
+// Unsigned 128-bit integer for exact interval arithmetic, intervals of any length hold in it as nano-seconds
+#if defined(__SIZEOF_INT128__)
+typedef unsigned __int128 dt_u128_t;
+
+static dt_u128_t u128_from(unsigned long long value)
+{
+    return value;
+}
+
+static unsigned long long u128_low(dt_u128_t value)
+{
+    return (unsigned long long) value;
+}
+
+static dt_u128_t u128_mul(unsigned long long lhs, unsigned long long rhs)
+{
+    return (dt_u128_t) lhs * rhs;
+}
+
+static dt_u128_t u128_add(dt_u128_t lhs, dt_u128_t rhs)
+{
+    return lhs + rhs;
+}
+
+static dt_u128_t u128_divmod(dt_u128_t lhs, dt_u128_t rhs, dt_u128_t *remainder)
+{
+    *remainder = lhs % rhs;
+    return lhs / rhs;
+}
+
+static dt_bool_t u128_to_ulong(dt_u128_t value, unsigned long *result)
+{
+    *result = (unsigned long) value;
+    return value <= ULONG_MAX ? DT_TRUE : DT_FALSE;
+}
+#else
+typedef struct {
+    unsigned long long high;
+    unsigned long long low;
+} dt_u128_t;
+
+static dt_u128_t u128_from(unsigned long long value)
+{
+    dt_u128_t result;
+
+    result.high = 0;
+    result.low = value;
+    return result;
+}
+
+static unsigned long long u128_low(dt_u128_t value)
+{
+    return value.low;
+}
+
+static dt_u128_t u128_mul(unsigned long long lhs, unsigned long long rhs)
+{
+    // Products of 32-bit halves, the middle sum can not overflow
+    const unsigned long long mask = 0xFFFFFFFFULL;
+    unsigned long long low_low = (lhs & mask) * (rhs & mask);
+    unsigned long long high_low = (lhs >> 32) * (rhs & mask);
+    unsigned long long low_high = (lhs & mask) * (rhs >> 32);
+    unsigned long long middle = (low_low >> 32) + (high_low & mask) + low_high;
+    dt_u128_t result;
+
+    result.low = (middle << 32) | (low_low & mask);
+    result.high = (lhs >> 32) * (rhs >> 32) + (high_low >> 32) + (middle >> 32);
+    return result;
+}
+
+static dt_u128_t u128_add(dt_u128_t lhs, dt_u128_t rhs)
+{
+    dt_u128_t result;
+
+    result.low = lhs.low + rhs.low;
+    result.high = lhs.high + rhs.high + (result.low < lhs.low);
+    return result;
+}
+
+static dt_u128_t u128_divmod(dt_u128_t lhs, dt_u128_t rhs, dt_u128_t *remainder)
+{
+    // Restoring division bit by bit
+    dt_u128_t quotient = u128_from(0);
+    dt_u128_t rest = u128_from(0);
+    int i = 0;
+
+    for (i = 127; i >= 0; i--) {
+        rest.high = (rest.high << 1) | (rest.low >> 63);
+        rest.low = (rest.low << 1) | (((i >= 64 ? lhs.high >> (i - 64) : lhs.low >> i)) & 1ULL);
+        if (rest.high > rhs.high || (rest.high == rhs.high && rest.low >= rhs.low)) {
+            rest.high = rest.high - rhs.high - (rest.low < rhs.low);
+            rest.low -= rhs.low;
+            if (i >= 64) {
+                quotient.high |= 1ULL << (i - 64);
+            } else {
+                quotient.low |= 1ULL << i;
+            }
+        }
+    }
+    *remainder = rest;
+    return quotient;
+}
+
+static dt_bool_t u128_to_ulong(dt_u128_t value, unsigned long *result)
+{
+    *result = (unsigned long) value.low;
+    return (value.high == 0 && value.low <= ULONG_MAX) ? DT_TRUE : DT_FALSE;
+}
+#endif
+
+// Splits nano-seconds into interval, DT_OVERFLOW is returned if its seconds do not fit
+static dt_status_t u128_to_interval(dt_u128_t nano_seconds, dt_interval_t *result)
+{
+    dt_u128_t rest;
+    unsigned long seconds = 0;
+
+    if (u128_to_ulong(u128_divmod(nano_seconds, u128_from(1000000000ULL), &rest), &seconds) != DT_TRUE) {
+        return DT_OVERFLOW;
+    }
+    result->seconds = seconds;
+    result->nano_seconds = (unsigned long) u128_low(rest);
+    return DT_OK;
+}
+
+dt_status_t dt_mul_interval_int(const dt_interval_t *lhs, unsigned long rhs, dt_interval_t *result)
+{
+    dt_u128_t rest;
+    dt_u128_t carry;
+    unsigned long seconds = 0;
+
+    if (dt_validate_interval(lhs) == DT_FALSE || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // Nano-seconds are multiplied apart, so that seconds of any interval do not overflow 128 bits
+    carry = u128_divmod(u128_mul(lhs->nano_seconds, rhs), u128_from(1000000000ULL), &rest);
+    if (u128_to_ulong(u128_add(u128_mul(lhs->seconds, rhs), carry), &seconds) != DT_TRUE) {
+        return DT_OVERFLOW;
+    }
+    result->seconds = seconds;
+    result->nano_seconds = (unsigned long) u128_low(rest);
+    return DT_OK;
+}
+
+dt_status_t dt_mul_interval_ratio(const dt_interval_t *lhs, unsigned long numerator, unsigned long denominator,
+                                  dt_interval_t *result)
+{
+    dt_u128_t seconds_rest;
+    dt_u128_t rest;
+    dt_u128_t seconds;
+    dt_u128_t nano_seconds;
+    dt_interval_t fraction = {0,};
+    unsigned long whole = 0;
+
+    if (dt_validate_interval(lhs) == DT_FALSE || denominator == 0 || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // (seconds * 10^9 + nano_seconds) * numerator / denominator with seconds divided first: the remainder of them
+    // is less than the denominator, so it can be turned to nano-seconds without overflow
+    seconds = u128_divmod(u128_mul(lhs->seconds, numerator), u128_from(denominator), &seconds_rest);
+    nano_seconds = u128_add(u128_mul(u128_low(seconds_rest), 1000000000ULL), u128_mul(lhs->nano_seconds, numerator));
+    if (u128_to_interval(u128_divmod(nano_seconds, u128_from(denominator), &rest), &fraction) != DT_OK ||
+            u128_to_ulong(u128_add(seconds, u128_from(fraction.seconds)), &whole) != DT_TRUE) {
+        return DT_OVERFLOW;
+    }
+    result->seconds = whole;
+    result->nano_seconds = fraction.nano_seconds;
+    return DT_OK;
+}
+
+dt_status_t dt_div_interval(const dt_interval_t *lhs, const dt_interval_t *rhs, unsigned long *quotient,
+                            dt_interval_t *remainder)
+{
+    dt_u128_t rest;
+    dt_u128_t divisor;
+
+    if (dt_validate_interval(lhs) == DT_FALSE || dt_validate_interval(rhs) == DT_FALSE || !quotient ||
+            (rhs->seconds == 0 && rhs->nano_seconds == 0)) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    divisor = u128_add(u128_mul(rhs->seconds, 1000000000ULL), u128_from(rhs->nano_seconds));
+    if (u128_to_ulong(u128_divmod(u128_add(u128_mul(lhs->seconds, 1000000000ULL), u128_from(lhs->nano_seconds)),
+                                  divisor, &rest), quotient) != DT_TRUE) {
+        return DT_OVERFLOW;
+    }
+    // Remainder is less than the divisor, so it always fits
+    return remainder ? u128_to_interval(rest, remainder) : DT_OK;
+}
+
+// Seconds of the greatest interval dt_ns_t holds by absolute value (DT_NS_MIN, 9223372036.854775808 seconds)
+static const unsigned long long NS_MAX_SECONDS = 9223372036ULL;
+
+// Converts interval to nano-seconds as unsigned magnitude, which holds the absolute value of DT_NS_MIN too
+static dt_status_t interval_to_ns_magnitude(const dt_interval_t *interval, unsigned long long *result)
+{
+    if (interval->seconds > NS_MAX_SECONDS) {
+        return DT_OVERFLOW;
+    }
+    *result = (unsigned long long) interval->seconds * DT_NS_PER_SECOND + interval->nano_seconds;
+    return DT_OK;
+}
+
+// Converts unsigned nano-seconds magnitude to interval
+static dt_status_t ns_magnitude_to_interval(unsigned long long magnitude, dt_interval_t *result)
+{
+    if (magnitude / DT_NS_PER_SECOND > ULONG_MAX) {
+        return DT_OVERFLOW;
+    }
+    result->seconds = (unsigned long) (magnitude / DT_NS_PER_SECOND);
+    result->nano_seconds = (unsigned long) (magnitude % DT_NS_PER_SECOND);
+    return DT_OK;
+}
+
+dt_status_t dt_timestamp_to_ns(const dt_timestamp_t *timestamp, dt_ns_t *result)
+{
+    dt_ns_t seconds_part = 0;
+
+    if (dt_validate_timestamp(timestamp) != DT_TRUE || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (timestamp->second > (long long) NS_MAX_SECONDS || timestamp->second < -(long long) NS_MAX_SECONDS - 1) {
+        return DT_OVERFLOW;
+    }
+
+    if (timestamp->second >= 0) {
+        seconds_part = timestamp->second * DT_NS_PER_SECOND;
+        if (seconds_part > DT_NS_MAX - (dt_ns_t) timestamp->nano_second) {
+            return DT_OVERFLOW;
+        }
+        *result = seconds_part + (dt_ns_t) timestamp->nano_second;
+    } else {
+        // Nano-seconds are added to the next second going back, so the lowest second does not overflow
+        seconds_part = (timestamp->second + 1) * DT_NS_PER_SECOND;
+        if (seconds_part < DT_NS_MIN + (DT_NS_PER_SECOND - (dt_ns_t) timestamp->nano_second)) {
+            return DT_OVERFLOW;
+        }
+        *result = seconds_part - (DT_NS_PER_SECOND - (dt_ns_t) timestamp->nano_second);
+    }
+    return DT_OK;
+}
+
+dt_status_t dt_ns_to_timestamp(dt_ns_t ns, dt_timestamp_t *result)
+{
+    dt_ns_t seconds = ns / DT_NS_PER_SECOND;
+    dt_ns_t nano_seconds = ns % DT_NS_PER_SECOND;
+
+    if (!result) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (nano_seconds < 0) {
+        nano_seconds += DT_NS_PER_SECOND;
+        seconds--;
+    }
+    if (seconds > LONG_MAX || seconds < LONG_MIN) {
+        return DT_OVERFLOW;
+    }
+
+    result->second = (long) seconds;
+    result->nano_second = (unsigned long) nano_seconds;
+    return DT_OK;
+}
+
+dt_status_t dt_interval_to_ns(const dt_interval_t *interval, dt_ns_t *result)
+{
+    unsigned long long magnitude = 0;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (dt_validate_interval(interval) != DT_TRUE || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if ((status = interval_to_ns_magnitude(interval, &magnitude)) != DT_OK) {
+        return status;
+    }
+    if (magnitude > (unsigned long long) DT_NS_MAX) {
+        return DT_OVERFLOW;
+    }
+
+    *result = (dt_ns_t) magnitude;
+    return DT_OK;
+}
+
+dt_status_t dt_ns_to_interval(dt_ns_t ns, dt_interval_t *result)
+{
+    if (ns < 0 || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return ns_magnitude_to_interval((unsigned long long) ns, result);
+}
+
+dt_status_t dt_offset_to_ns(const dt_offset_t *offset, dt_ns_t *result)
+{
+    unsigned long long magnitude = 0;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (dt_validate_offset(offset) != DT_TRUE || !result) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if ((status = interval_to_ns_magnitude(&offset->duration, &magnitude)) != DT_OK) {
+        return status;
+    }
+
+    if (offset->is_forward) {
+        if (magnitude > (unsigned long long) DT_NS_MAX) {
+            return DT_OVERFLOW;
+        }
+        *result = (dt_ns_t) magnitude;
+    } else {
+        if (magnitude > (unsigned long long) DT_NS_MAX + 1ULL) {
+            return DT_OVERFLOW;
+        }
+        // Negated by parts, as the magnitude of DT_NS_MIN is not a dt_ns_t
+        *result = magnitude == 0 ? 0 : -(dt_ns_t) (magnitude - 1ULL) - 1;
+    }
+    return DT_OK;
+}
+
+dt_status_t dt_ns_to_offset(dt_ns_t ns, dt_offset_t *result)
+{
+    unsigned long long magnitude = 0;
+
+    if (!result) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // Zero offset is a forward one as dt_offset_between() gives it
+    magnitude = ns >= 0 ? (unsigned long long) ns : (unsigned long long) (-(ns + 1)) + 1ULL;
+    result->is_forward = ns >= 0 ? DT_TRUE : DT_FALSE;
+    return ns_magnitude_to_interval(magnitude, &result->duration);
+}
+
 dt_bool_t dt_validate_representation(const dt_representation_t *representation)
 {
     if (!representation) {
@@ -427,36 +647,26 @@ dt_status_t dt_init_representation(int year, unsigned short month, unsigned shor
 
 dt_status_t dt_representation_day_of_week(const dt_representation_t *representation, int *day_of_week)
 {
-    int year = 0;
-    int month = 0;
-
     // TODO: Julian calendar support - now only Gregorian is supported
     if (!representation || !day_of_week) {
         return DT_INVALID_ARGUMENT;
     }
 
-    year = (representation->month == 1 || representation->month == 2) ? representation->year - 1 : representation->year;
-    month = (representation->month == 1 || representation->month == 2) ? representation->month + 12 : representation->month;
-    // See http://en.wikipedia.org/wiki/Zeller%27s_congruence
-
-    *day_of_week = (representation->day + (month + 1) * 26 / 10 + year + year / 4 + 6 * year / 100 + year / 400) % 7;
-    *day_of_week = *day_of_week == 0 ? 7 : *day_of_week;
+    *day_of_week = dt_calendar_day_of_week(dt_calendar_days_from_civil(representation->year, representation->month,
+                                                                       representation->day)) + 1;
     return DT_OK;
 }
 
 dt_status_t dt_representation_day_of_year(const dt_representation_t *representation, int *day_of_year)
 {
-    unsigned i = 0;
     // TODO: Julian calendar support - now only Gregorian is supported
-    if (!representation || !day_of_year) {
+    if (!representation || !day_of_year || representation->month < 1 || representation->month > 12) {
         return DT_INVALID_ARGUMENT;
     }
-    *day_of_year = 0;
-
-    for (i = 1; i < representation->month; ++i) {
-        *day_of_year += (i == 2 && dt_is_leap_year(representation->year)) ? 29 : month_days[i];
+    *day_of_year = days_before_month[representation->month] + representation->day;
+    if (representation->month > 2 && dt_is_leap_year(representation->year)) {
+        ++*day_of_year;
     }
-    *day_of_year += representation->day;
     return DT_OK;
 }
 
@@ -0,0 +1,550 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include <libdt/dt.h>
+#include <libdt/dt_inline.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Vector kernels keep a second or a nano-second in a 64-bit lane, so that they are built where long is 64-bit and
+// dt_timestamp_t is a pair of such lanes. SSE2 ones are the generic kernels there, AVX2 ones are built alongside them
+// by GCC compatible compilers and are selected at run time on processors which support AVX2.
+#if ULONG_MAX > 0xFFFFFFFFUL && defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+#define DT_ARRAY_SSE2
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define DT_ARRAY_AVX2
+#endif
+#endif
+
+#define NANO_SECONDS_PER_SECOND 1000000000UL
+#define MAX_NANO_SECONDS 999999999UL
+// Shift of the sign bit of unsigned long
+#define SIGN_SHIFT (sizeof(unsigned long) * CHAR_BIT - 1)
+// Fewer timestamps are sorted by insertion, as radix sort passes cost more for them
+#define SORT_INSERTION_COUNT 64
+#define RADIX_BITS 11
+#define RADIX_SIZE (1 << RADIX_BITS)
+// Digits of radix sort key: 30 bits of nano-seconds, then bits of seconds with flipped sign bit, so that they are
+// ordered as unsigned ones
+#define NANO_SECOND_DIGITS ((30 + RADIX_BITS - 1) / RADIX_BITS)
+#define SECOND_DIGITS ((sizeof(unsigned long) * CHAR_BIT + RADIX_BITS - 1) / RADIX_BITS)
+#define RADIX_DIGITS (NANO_SECOND_DIGITS + SECOND_DIGITS)
+
+// Timestamps either of an array of structures or of separate arrays of seconds and nano-seconds
+typedef struct {
+    const dt_timestamp_t *timestamps;
+    const long *seconds;
+    const unsigned long *nano_seconds;
+} source_t;
+
+typedef struct {
+    dt_timestamp_t *timestamps;
+    long *seconds;
+    unsigned long *nano_seconds;
+} sink_t;
+
+// Offsets either of an array of structures or of separate arrays of their fields
+typedef struct {
+    dt_offset_t *offsets;
+    unsigned long *seconds;
+    unsigned long *nano_seconds;
+    dt_bool_t *is_forward;
+} offset_sink_t;
+
+static long source_second(const source_t *source, size_t i)
+{
+    return source->timestamps ? source->timestamps[i].second : source->seconds[i];
+}
+
+static unsigned long source_nano_second(const source_t *source, size_t i)
+{
+    return source->timestamps ? source->timestamps[i].nano_second : source->nano_seconds[i];
+}
+
+static void sink_set(const sink_t *sink, size_t i, long second, unsigned long nano_second)
+{
+    if (sink->timestamps) {
+        sink->timestamps[i].second = second;
+        sink->timestamps[i].nano_second = nano_second;
+    } else {
+        sink->seconds[i] = second;
+        sink->nano_seconds[i] = nano_second;
+    }
+}
+
+static void offset_sink_set(const offset_sink_t *sink, size_t i, unsigned long seconds, unsigned long nano_seconds,
+                            dt_bool_t is_forward)
+{
+    if (sink->offsets) {
+        sink->offsets[i].duration.seconds = seconds;
+        sink->offsets[i].duration.nano_seconds = nano_seconds;
+        sink->offsets[i].is_forward = is_forward;
+    } else {
+        sink->seconds[i] = seconds;
+        sink->nano_seconds[i] = nano_seconds;
+        sink->is_forward[i] = is_forward;
+    }
+}
+
+// Timestamp of a source as a structure
+static dt_timestamp_t source_get(const source_t *source, size_t i)
+{
+    dt_timestamp_t result;
+
+    result.second = source_second(source, i);
+    result.nano_second = source_nano_second(source, i);
+    return result;
+}
+
+// Applies an offset which seconds do not fit long with checked function per timestamp
+static dt_status_t apply_long_offset(const source_t *source, size_t count, const dt_offset_t *offset,
+                                     const sink_t *sink)
+{
+    dt_status_t status = DT_OK;
+    size_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        dt_timestamp_t timestamp = source_get(source, i);
+        dt_timestamp_t result = {0,};
+        dt_status_t s = dt_apply_offset(&timestamp, offset, &result);
+
+        if (s != DT_OK) {
+            status = status == DT_INVALID_ARGUMENT ? status : s;
+        }
+        sink_set(sink, i, result.second, result.nano_second);
+    }
+    return status;
+}
+
+#if defined(DT_ARRAY_SSE2)
+#define VEC_LANES 2
+#endif
+#define KERNEL(name) name##_generic
+#define KERNEL_TARGET
+#include "dt_array_kernels.h"
+
+typedef struct {
+    dt_status_t (*apply_offset)(const source_t *, size_t, const dt_offset_t *, const sink_t *);
+    dt_status_t (*offset_between)(const source_t *, const source_t *, size_t, const offset_sink_t *);
+    dt_status_t (*compare)(const source_t *, size_t, const dt_timestamp_t *, dt_compare_result_t *);
+    dt_status_t (*min_max)(const source_t *, size_t, dt_timestamp_t *, dt_timestamp_t *);
+} array_kernels_t;
+
+static const array_kernels_t generic_kernels = {
+    apply_offset_generic, offset_between_generic, compare_generic, min_max_generic
+};
+
+#if defined(DT_ARRAY_AVX2)
+#define VEC_LANES 4
+#define KERNEL(name) name##_avx2
+#define KERNEL_TARGET __attribute__((target("avx2")))
+#include "dt_array_kernels.h"
+
+static const array_kernels_t avx2_kernels = {
+    apply_offset_avx2, offset_between_avx2, compare_avx2, min_max_avx2
+};
+#endif
+
+static const array_kernels_t *array_kernels(void)
+{
+#if defined(DT_ARRAY_AVX2)
+    // Every thread selects the same kernels, so the race on the first call is harmless
+    static const array_kernels_t *selected_kernels = NULL;
+    const array_kernels_t *kernels = __atomic_load_n(&selected_kernels, __ATOMIC_RELAXED);
+
+    if (kernels == NULL) {
+        __builtin_cpu_init();
+        kernels = __builtin_cpu_supports("avx2") ? &avx2_kernels : &generic_kernels;
+        __atomic_store_n(&selected_kernels, kernels, __ATOMIC_RELAXED);
+    }
+    return kernels;
+#else
+    return &generic_kernels;
+#endif
+}
+
+static size_t radix_digit(const dt_timestamp_t *timestamp, size_t digit)
+{
+    if (digit < NANO_SECOND_DIGITS) {
+        return (timestamp->nano_second >> (digit * RADIX_BITS)) & (RADIX_SIZE - 1);
+    }
+    return (((unsigned long) timestamp->second ^ (1UL << SIGN_SHIFT)) >> ((digit - NANO_SECOND_DIGITS) * RADIX_BITS)) &
+           (RADIX_SIZE - 1);
+}
+
+static void insertion_sort(dt_timestamp_t *timestamps, size_t count, size_t *permutation)
+{
+    size_t i = 0;
+    size_t j = 0;
+
+    for (i = 1; i < count; i++) {
+        dt_timestamp_t timestamp = timestamps[i];
+        size_t index = permutation ? permutation[i] : 0;
+
+        for (j = i; j > 0 && dt_compare_timestamps_unchecked(&timestamps[j - 1], &timestamp) == DT_GREATER; j--) {
+            timestamps[j] = timestamps[j - 1];
+            if (permutation) {
+                permutation[j] = permutation[j - 1];
+            }
+        }
+        timestamps[j] = timestamp;
+        if (permutation) {
+            permutation[j] = index;
+        }
+    }
+}
+
+// Least significant digit first radix sort, counts of all digits are taken in one pass, and passes of digits which
+// are the same for all timestamps, like high bytes of seconds of a day, are skipped
+static dt_status_t radix_sort(dt_timestamp_t *timestamps, size_t count, size_t *permutation)
+{
+    size_t (*counts)[RADIX_SIZE] = calloc(RADIX_DIGITS, sizeof(*counts));
+    dt_timestamp_t *source = timestamps;
+    dt_timestamp_t *destination = malloc(count * sizeof(dt_timestamp_t));
+    size_t *source_permutation = permutation;
+    size_t *destination_permutation = permutation ? malloc(count * sizeof(size_t)) : NULL;
+    size_t digit = 0;
+    size_t i = 0;
+
+    if (!counts || !destination || (permutation && !destination_permutation)) {
+        free(counts);
+        free(destination);
+        free(destination_permutation);
+        return DT_SYSTEM_CALL_ERROR;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (timestamps[i].nano_second > MAX_NANO_SECONDS) {
+            free(counts);
+            free(destination);
+            free(destination_permutation);
+            return DT_INVALID_ARGUMENT;
+        }
+        for (digit = 0; digit < RADIX_DIGITS; digit++) {
+            counts[digit][radix_digit(&timestamps[i], digit)]++;
+        }
+    }
+
+    for (digit = 0; digit < RADIX_DIGITS; digit++) {
+        size_t offset = 0;
+        size_t value = 0;
+        dt_timestamp_t *swap = NULL;
+        size_t *swap_permutation = NULL;
+
+        if (counts[digit][radix_digit(&source[0], digit)] == count) {
+            continue;
+        }
+        for (value = 0; value < RADIX_SIZE; value++) {
+            size_t value_count = counts[digit][value];
+
+            counts[digit][value] = offset;
+            offset += value_count;
+        }
+        for (i = 0; i < count; i++) {
+            size_t position = counts[digit][radix_digit(&source[i], digit)]++;
+
+            destination[position] = source[i];
+            if (permutation) {
+                destination_permutation[position] = source_permutation[i];
+            }
+        }
+        swap = source;
+        source = destination;
+        destination = swap;
+        swap_permutation = source_permutation;
+        source_permutation = destination_permutation;
+        destination_permutation = swap_permutation;
+    }
+
+    free(counts);
+    // Buffers are swapped after every pass, so the sorted data is either in place or in the buffer
+    if (source != timestamps) {
+        memcpy(timestamps, source, count * sizeof(dt_timestamp_t));
+        if (permutation) {
+            memcpy(permutation, source_permutation, count * sizeof(size_t));
+        }
+        free(source);
+        free(source_permutation);
+    } else {
+        free(destination);
+        free(destination_permutation);
+    }
+    return DT_OK;
+}
+
+// Key of a timestamp for interpolation, which does not have to be exact
+static double interpolation_key(const dt_timestamp_t *timestamp)
+{
+    return (double) timestamp->second + (double) timestamp->nano_second / 1e9;
+}
+
+// Whether a timestamp of a source is greater than the value, or not lesser if not is_upper
+static int is_bound(const source_t *source, size_t i, const dt_timestamp_t *value, int is_upper)
+{
+    dt_timestamp_t timestamp = source_get(source, i);
+    dt_compare_result_t result = dt_compare_timestamps_unchecked(&timestamp, value);
+
+    return result == DT_GREATER || (!is_upper && result == DT_EQUALS);
+}
+
+// Lowest index of sorted timestamps which is bound for the value. Every round probes a position interpolated by the
+// value, then gallops from it towards the value with doubling steps, so that the range shrinks to about the error of
+// interpolation. Rounds which do not halve the range are followed by a bisection one, so that uneven timestamps do not
+// take much more steps than binary search.
+static size_t search_bound(const source_t *source, size_t count, const dt_timestamp_t *value, int is_upper)
+{
+    const double key = interpolation_key(value);
+    size_t low = 0;
+    size_t high = count;
+    int is_interpolation = 1;
+
+    // Timestamps before low are not bound, ones from high are bound
+    while (low < high) {
+        size_t size = high - low;
+        size_t probe = low + size / 2;
+        size_t step = 1;
+        size_t rest = 0;
+
+        // Error of interpolation of evenly spread timestamps is about a square root of the range, galloping starts
+        // from a quarter of it
+        for (rest = size; rest > 15; rest >>= 2) {
+            step <<= 1;
+        }
+
+        if (is_interpolation) {
+            dt_timestamp_t first = source_get(source, low);
+            dt_timestamp_t last = source_get(source, high - 1);
+            double first_key = interpolation_key(&first);
+            double last_key = interpolation_key(&last);
+
+            if (key <= first_key) {
+                probe = low;
+            } else if (key >= last_key) {
+                probe = high - 1;
+            } else {
+                probe = low + (size_t) ((key - first_key) / (last_key - first_key) * (double) (size - 1));
+                probe = probe < high ? probe : high - 1;
+            }
+        }
+
+        if (is_bound(source, probe, value, is_upper)) {
+            high = probe;
+            while (high - low >= step && is_bound(source, high - step, value, is_upper)) {
+                high -= step;
+                step *= 2;
+            }
+            low = high - low >= step ? high - step + 1 : low;
+        } else {
+            low = probe + 1;
+            while (high - low >= step && !is_bound(source, low + step - 1, value, is_upper)) {
+                low += step;
+                step *= 2;
+            }
+            high = high - low >= step ? low + step - 1 : high;
+        }
+        is_interpolation = high - low <= size / 2;
+    }
+    return low;
+}
+
+dt_status_t dt_timestamps_apply_offset(const dt_timestamp_t *timestamps, size_t count, const dt_offset_t *offset,
+                                       dt_timestamp_t *results)
+{
+    source_t source = {timestamps, NULL, NULL};
+    sink_t sink = {results, NULL, NULL};
+
+    if (!timestamps || dt_validate_offset(offset) != DT_TRUE || !results) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->apply_offset(&source, count, offset, &sink);
+}
+
+dt_status_t dt_timestamps_offset_between(const dt_timestamp_t *lhs, const dt_timestamp_t *rhs, size_t count,
+        dt_offset_t *results)
+{
+    source_t lhs_source = {lhs, NULL, NULL};
+    source_t rhs_source = {rhs, NULL, NULL};
+    offset_sink_t sink = {results, NULL, NULL, NULL};
+
+    if (!lhs || !rhs || !results) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->offset_between(&lhs_source, &rhs_source, count, &sink);
+}
+
+dt_status_t dt_timestamps_compare(const dt_timestamp_t *timestamps, size_t count, const dt_timestamp_t *threshold,
+                                  dt_compare_result_t *results)
+{
+    source_t source = {timestamps, NULL, NULL};
+
+    if (!timestamps || dt_validate_timestamp(threshold) != DT_TRUE || !results) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->compare(&source, count, threshold, results);
+}
+
+dt_status_t dt_timestamps_min_max(const dt_timestamp_t *timestamps, size_t count, dt_timestamp_t *min,
+                                  dt_timestamp_t *max)
+{
+    source_t source = {timestamps, NULL, NULL};
+
+    if (!timestamps || count == 0 || !min || !max) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->min_max(&source, count, min, max);
+}
+
+dt_status_t dt_timestamp_columns_apply_offset(const long *seconds, const unsigned long *nano_seconds, size_t count,
+        const dt_offset_t *offset, long *result_seconds,
+        unsigned long *result_nano_seconds)
+{
+    source_t source = {NULL, seconds, nano_seconds};
+    sink_t sink = {NULL, result_seconds, result_nano_seconds};
+
+    if (!seconds || !nano_seconds || dt_validate_offset(offset) != DT_TRUE || !result_seconds || !result_nano_seconds) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->apply_offset(&source, count, offset, &sink);
+}
+
+dt_status_t dt_timestamp_columns_offset_between(const long *lhs_seconds, const unsigned long *lhs_nano_seconds,
+        const long *rhs_seconds, const unsigned long *rhs_nano_seconds, size_t count,
+        unsigned long *result_seconds, unsigned long *result_nano_seconds,
+        dt_bool_t *result_is_forward)
+{
+    source_t lhs_source = {NULL, lhs_seconds, lhs_nano_seconds};
+    source_t rhs_source = {NULL, rhs_seconds, rhs_nano_seconds};
+    offset_sink_t sink = {NULL, result_seconds, result_nano_seconds, result_is_forward};
+
+    if (!lhs_seconds || !lhs_nano_seconds || !rhs_seconds || !rhs_nano_seconds || !result_seconds ||
+            !result_nano_seconds || !result_is_forward) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->offset_between(&lhs_source, &rhs_source, count, &sink);
+}
+
+dt_status_t dt_timestamp_columns_compare(const long *seconds, const unsigned long *nano_seconds, size_t count,
+        const dt_timestamp_t *threshold, dt_compare_result_t *results)
+{
+    source_t source = {NULL, seconds, nano_seconds};
+
+    if (!seconds || !nano_seconds || dt_validate_timestamp(threshold) != DT_TRUE || !results) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->compare(&source, count, threshold, results);
+}
+
+dt_status_t dt_timestamp_columns_min_max(const long *seconds, const unsigned long *nano_seconds, size_t count,
+        dt_timestamp_t *min, dt_timestamp_t *max)
+{
+    source_t source = {NULL, seconds, nano_seconds};
+
+    if (!seconds || !nano_seconds || count == 0 || !min || !max) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return array_kernels()->min_max(&source, count, min, max);
+}
+
+dt_status_t dt_timestamps_sort(dt_timestamp_t *timestamps, size_t count, size_t *permutation)
+{
+    size_t i = 0;
+
+    if (!timestamps) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (permutation) {
+        for (i = 0; i < count; i++) {
+            permutation[i] = i;
+        }
+    }
+    if (count >= SORT_INSERTION_COUNT) {
+        return radix_sort(timestamps, count, permutation);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (timestamps[i].nano_second > MAX_NANO_SECONDS) {
+            return DT_INVALID_ARGUMENT;
+        }
+    }
+    insertion_sort(timestamps, count, permutation);
+    return DT_OK;
+}
+
+dt_status_t dt_timestamps_lower_bound(const dt_timestamp_t *timestamps, size_t count, const dt_timestamp_t *value,
+                                      size_t *index)
+{
+    source_t source = {timestamps, NULL, NULL};
+
+    if (!timestamps || dt_validate_timestamp(value) != DT_TRUE || !index) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *index = search_bound(&source, count, value, 0);
+    return DT_OK;
+}
+
+dt_status_t dt_timestamps_upper_bound(const dt_timestamp_t *timestamps, size_t count, const dt_timestamp_t *value,
+                                      size_t *index)
+{
+    source_t source = {timestamps, NULL, NULL};
+
+    if (!timestamps || dt_validate_timestamp(value) != DT_TRUE || !index) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *index = search_bound(&source, count, value, 1);
+    return DT_OK;
+}
+
+dt_status_t dt_timestamp_columns_lower_bound(const long *seconds, const unsigned long *nano_seconds, size_t count,
+        const dt_timestamp_t *value, size_t *index)
+{
+    source_t source = {NULL, seconds, nano_seconds};
+
+    if (!seconds || !nano_seconds || dt_validate_timestamp(value) != DT_TRUE || !index) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *index = search_bound(&source, count, value, 0);
+    return DT_OK;
+}
+
+dt_status_t dt_timestamp_columns_upper_bound(const long *seconds, const unsigned long *nano_seconds, size_t count,
+        const dt_timestamp_t *value, size_t *index)
+{
+    source_t source = {NULL, seconds, nano_seconds};
+
+    if (!seconds || !nano_seconds || dt_validate_timestamp(value) != DT_TRUE || !index) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *index = search_bound(&source, count, value, 1);
+    return DT_OK;
+}
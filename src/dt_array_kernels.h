@@ -0,0 +1,507 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+// Timestamp array kernels, included by dt_array.c once per instruction set, so there is no include guard. The includer
+// defines VEC_LANES as 4 for AVX2 kernels, as 2 for SSE2 ones or leaves it undefined for scalar ones, KERNEL(name) to
+// give names of the instance and KERNEL_TARGET to attribute its functions; all of them are undefined at the end.
+
+#define vec_t KERNEL(vec_t)
+#define vec_load KERNEL(vec_load)
+#define vec_store KERNEL(vec_store)
+#define vec_load_timestamps KERNEL(vec_load_timestamps)
+#define vec_store_timestamps KERNEL(vec_store_timestamps)
+#define source_load KERNEL(source_load)
+#define sink_store KERNEL(sink_store)
+#define vec_invalid_nano_seconds KERNEL(vec_invalid_nano_seconds)
+#define vec_timestamp_greater KERNEL(vec_timestamp_greater)
+#define vec_select KERNEL(vec_select)
+#define apply_offset KERNEL(apply_offset)
+#define offset_between KERNEL(offset_between)
+#define compare KERNEL(compare)
+#define min_max KERNEL(min_max)
+
+#if defined(VEC_LANES)
+#if VEC_LANES == 4
+typedef __m256i vec_t;
+
+#define vec_set(value) _mm256_set1_epi64x((long long) (value))
+#define vec_add _mm256_add_epi64
+#define vec_sub _mm256_sub_epi64
+#define vec_and _mm256_and_si256
+#define vec_andnot _mm256_andnot_si256
+#define vec_or _mm256_or_si256
+#define vec_xor _mm256_xor_si256
+#define vec_cmpgt32 _mm256_cmpgt_epi32
+#define vec_cmpeq32 _mm256_cmpeq_epi32
+#define vec_cmpgt64 _mm256_cmpgt_epi64
+#define vec_cmpeq64 _mm256_cmpeq_epi64
+// Copies low halves of 64-bit lanes to their high halves
+#define vec_spread_low(value) _mm256_shuffle_epi32((value), _MM_SHUFFLE(2, 2, 0, 0))
+// Bits of lanes, which have the sign bit set
+#define vec_signs(value) _mm256_movemask_pd(_mm256_castsi256_pd(value))
+
+KERNEL_TARGET
+static vec_t vec_load(const void *values)
+{
+    return _mm256_loadu_si256((const __m256i *) values);
+}
+
+KERNEL_TARGET
+static void vec_store(void *values, vec_t value)
+{
+    _mm256_storeu_si256((__m256i *) values, value);
+}
+
+KERNEL_TARGET
+static void vec_load_timestamps(const dt_timestamp_t *timestamps, vec_t *second, vec_t *nano_second)
+{
+    // {s0, n0, s1, n1} and {s2, n2, s3, n3} to {s0, s1, n0, n1} and {s2, s3, n2, n3} to the columns
+    vec_t low = _mm256_permute4x64_epi64(vec_load(timestamps), _MM_SHUFFLE(3, 1, 2, 0));
+    vec_t high = _mm256_permute4x64_epi64(vec_load(timestamps + 2), _MM_SHUFFLE(3, 1, 2, 0));
+
+    *second = _mm256_permute2x128_si256(low, high, 0x20);
+    *nano_second = _mm256_permute2x128_si256(low, high, 0x31);
+}
+
+KERNEL_TARGET
+static void vec_store_timestamps(dt_timestamp_t *timestamps, vec_t second, vec_t nano_second)
+{
+    vec_store(timestamps, _mm256_permute4x64_epi64(_mm256_permute2x128_si256(second, nano_second, 0x20),
+              _MM_SHUFFLE(3, 1, 2, 0)));
+    vec_store(timestamps + 2, _mm256_permute4x64_epi64(_mm256_permute2x128_si256(second, nano_second, 0x31),
+              _MM_SHUFFLE(3, 1, 2, 0)));
+}
+#else
+typedef __m128i vec_t;
+
+#define vec_set(value) _mm_set1_epi64x((long long) (value))
+#define vec_add _mm_add_epi64
+#define vec_sub _mm_sub_epi64
+#define vec_and _mm_and_si128
+#define vec_andnot _mm_andnot_si128
+#define vec_or _mm_or_si128
+#define vec_xor _mm_xor_si128
+#define vec_cmpgt32 _mm_cmpgt_epi32
+#define vec_cmpeq32 _mm_cmpeq_epi32
+#define vec_spread_low(value) _mm_shuffle_epi32((value), _MM_SHUFFLE(2, 2, 0, 0))
+#define vec_signs(value) _mm_movemask_pd(_mm_castsi128_pd(value))
+
+KERNEL_TARGET
+static vec_t vec_cmpeq64(vec_t lhs, vec_t rhs)
+{
+    vec_t equal = _mm_cmpeq_epi32(lhs, rhs);
+
+    return _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+KERNEL_TARGET
+static vec_t vec_cmpgt64(vec_t lhs, vec_t rhs)
+{
+#if defined(__SSE4_2__)
+    return _mm_cmpgt_epi64(lhs, rhs);
+#else
+    // Signed high halves decide unless they are equal, then low halves do as unsigned ones, which are compared as
+    // signed ones with flipped sign bits
+    const vec_t flip = _mm_set_epi32(0, (int) 0x80000000, 0, (int) 0x80000000);
+    vec_t greater = _mm_cmpgt_epi32(_mm_xor_si128(lhs, flip), _mm_xor_si128(rhs, flip));
+    vec_t equal = _mm_cmpeq_epi32(lhs, rhs);
+
+    return _mm_or_si128(_mm_shuffle_epi32(greater, _MM_SHUFFLE(3, 3, 1, 1)),
+                        _mm_and_si128(_mm_shuffle_epi32(equal, _MM_SHUFFLE(3, 3, 1, 1)),
+                                      _mm_shuffle_epi32(greater, _MM_SHUFFLE(2, 2, 0, 0))));
+#endif
+}
+
+KERNEL_TARGET
+static vec_t vec_load(const void *values)
+{
+    return _mm_loadu_si128((const __m128i *) values);
+}
+
+KERNEL_TARGET
+static void vec_store(void *values, vec_t value)
+{
+    _mm_storeu_si128((__m128i *) values, value);
+}
+
+KERNEL_TARGET
+static void vec_load_timestamps(const dt_timestamp_t *timestamps, vec_t *second, vec_t *nano_second)
+{
+    vec_t first = vec_load(timestamps);
+    vec_t next = vec_load(timestamps + 1);
+
+    *second = _mm_unpacklo_epi64(first, next);
+    *nano_second = _mm_unpackhi_epi64(first, next);
+}
+
+KERNEL_TARGET
+static void vec_store_timestamps(dt_timestamp_t *timestamps, vec_t second, vec_t nano_second)
+{
+    vec_store(timestamps, _mm_unpacklo_epi64(second, nano_second));
+    vec_store(timestamps + 1, _mm_unpackhi_epi64(second, nano_second));
+}
+#endif
+
+KERNEL_TARGET
+static void source_load(const source_t *source, size_t i, vec_t *second, vec_t *nano_second)
+{
+    if (source->timestamps) {
+        vec_load_timestamps(source->timestamps + i, second, nano_second);
+    } else {
+        *second = vec_load(source->seconds + i);
+        *nano_second = vec_load(source->nano_seconds + i);
+    }
+}
+
+KERNEL_TARGET
+static void sink_store(const sink_t *sink, size_t i, vec_t second, vec_t nano_second)
+{
+    if (sink->timestamps) {
+        vec_store_timestamps(sink->timestamps + i, second, nano_second);
+    } else {
+        vec_store(sink->seconds + i, second);
+        vec_store(sink->nano_seconds + i, nano_second);
+    }
+}
+
+// Lanes of nano-seconds which are greater than MAX_NANO_SECONDS: the high half is not zero or the low half is greater
+// as an unsigned one, which is compared as a signed one with flipped sign bit
+KERNEL_TARGET
+static vec_t vec_invalid_nano_seconds(vec_t nano_second)
+{
+    const vec_t flip = vec_set(0x80000000UL);
+    const vec_t limit = vec_set(0x7FFFFFFF00000000UL | (MAX_NANO_SECONDS ^ 0x80000000UL));
+    const vec_t high = vec_set(0xFFFFFFFF00000000UL);
+
+    return vec_or(vec_spread_low(vec_cmpgt32(vec_xor(nano_second, flip), limit)),
+                  vec_andnot(vec_cmpeq32(nano_second, vec_set(0)), high));
+}
+
+// Lanes where the first timestamp is greater than the second one, valid nano-seconds fit low halves of lanes
+KERNEL_TARGET
+static vec_t vec_timestamp_greater(vec_t lhs_second, vec_t lhs_nano_second, vec_t rhs_second, vec_t rhs_nano_second)
+{
+    return vec_or(vec_cmpgt64(lhs_second, rhs_second),
+                  vec_and(vec_cmpeq64(lhs_second, rhs_second),
+                          vec_spread_low(vec_cmpgt32(lhs_nano_second, rhs_nano_second))));
+}
+
+// Lanes of the first value where mask is set, of the second one otherwise
+KERNEL_TARGET
+static vec_t vec_select(vec_t mask, vec_t lhs, vec_t rhs)
+{
+    return vec_or(vec_and(mask, lhs), vec_andnot(mask, rhs));
+}
+#endif
+
+KERNEL_TARGET
+static dt_status_t apply_offset(const source_t *source, size_t count, const dt_offset_t *offset, const sink_t *sink)
+{
+    // Backward offset is applied as forward one of -(seconds + 1) seconds and 10^9 - nano_seconds nano-seconds, so
+    // both of them add a carry of nano-seconds to seconds. Addend fits long, so the sum overflows if and only if its
+    // sign changes from positive to negative for a forward offset, from negative to positive for a backward one.
+    const unsigned long seconds = offset->is_forward ? offset->duration.seconds : ~offset->duration.seconds;
+    const unsigned long nano_seconds = offset->is_forward ? offset->duration.nano_seconds :
+                                       NANO_SECONDS_PER_SECOND - offset->duration.nano_seconds;
+    const unsigned long direction = offset->is_forward ? 0UL : ~0UL;
+    unsigned long invalid = 0;
+    unsigned long overflow = 0;
+    size_t i = 0;
+
+    if (offset->duration.seconds >= (unsigned long) LONG_MAX) {
+        return apply_long_offset(source, count, offset, sink);
+    }
+
+#if defined(VEC_LANES)
+    {
+        const vec_t add_seconds = vec_set(seconds);
+        const vec_t add_nano_seconds = vec_set(nano_seconds);
+        const vec_t max_nano_seconds = vec_set(MAX_NANO_SECONDS);
+        const vec_t billion = vec_set(NANO_SECONDS_PER_SECOND);
+        const vec_t one = vec_set(1);
+        const vec_t sign_direction = vec_set(direction);
+        const vec_t sign_direction_not = vec_set(~direction);
+        vec_t invalid_lanes = vec_set(0);
+        vec_t overflow_lanes = vec_set(0);
+
+        for (; i + VEC_LANES <= count; i += VEC_LANES) {
+            vec_t second;
+            vec_t nano_second;
+            vec_t sum;
+            vec_t carry;
+            vec_t result;
+
+            source_load(source, i, &second, &nano_second);
+            invalid_lanes = vec_or(invalid_lanes, vec_invalid_nano_seconds(nano_second));
+            sum = vec_add(nano_second, add_nano_seconds);
+            carry = vec_spread_low(vec_cmpgt32(sum, max_nano_seconds));
+            result = vec_add(vec_add(second, add_seconds), vec_and(carry, one));
+            overflow_lanes = vec_or(overflow_lanes, vec_and(vec_xor(second, sign_direction_not),
+                                    vec_xor(result, sign_direction)));
+            sink_store(sink, i, result, vec_sub(sum, vec_and(carry, billion)));
+        }
+        invalid = vec_signs(invalid_lanes);
+        overflow = vec_signs(overflow_lanes);
+    }
+#endif
+
+    for (; i < count; i++) {
+        unsigned long second = (unsigned long) source_second(source, i);
+        unsigned long nano_second = source_nano_second(source, i);
+        unsigned long sum = nano_second + nano_seconds;
+        unsigned long carry = sum >= NANO_SECONDS_PER_SECOND;
+        unsigned long result = second + seconds + carry;
+
+        invalid |= nano_second > MAX_NANO_SECONDS;
+        overflow |= ((second ^ ~direction) & (result ^ direction)) >> SIGN_SHIFT;
+        sink_set(sink, i, (long) result, sum - carry * NANO_SECONDS_PER_SECOND);
+    }
+
+    if (invalid) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return overflow ? DT_OVERFLOW : DT_OK;
+}
+
+KERNEL_TARGET
+static dt_status_t offset_between(const source_t *lhs, const source_t *rhs, size_t count, const offset_sink_t *sink)
+{
+    unsigned long invalid = 0;
+    size_t i = 0;
+
+#if defined(VEC_LANES)
+    {
+        const vec_t billion = vec_set(NANO_SECONDS_PER_SECOND);
+        const vec_t one = vec_set(1);
+        vec_t invalid_lanes = vec_set(0);
+
+        for (; i + VEC_LANES <= count; i += VEC_LANES) {
+            unsigned long seconds[VEC_LANES];
+            unsigned long nano_seconds[VEC_LANES];
+            vec_t lhs_second;
+            vec_t lhs_nano_second;
+            vec_t rhs_second;
+            vec_t rhs_nano_second;
+            vec_t backward;
+            vec_t borrow;
+            vec_t higher_nano_second;
+            vec_t lower_nano_second;
+            int backward_bits = 0;
+            int k = 0;
+
+            source_load(lhs, i, &lhs_second, &lhs_nano_second);
+            source_load(rhs, i, &rhs_second, &rhs_nano_second);
+            invalid_lanes = vec_or(invalid_lanes, vec_or(vec_invalid_nano_seconds(lhs_nano_second),
+                                   vec_invalid_nano_seconds(rhs_nano_second)));
+            backward = vec_timestamp_greater(lhs_second, lhs_nano_second, rhs_second, rhs_nano_second);
+            higher_nano_second = vec_select(backward, lhs_nano_second, rhs_nano_second);
+            lower_nano_second = vec_select(backward, rhs_nano_second, lhs_nano_second);
+            borrow = vec_spread_low(vec_cmpgt32(lower_nano_second, higher_nano_second));
+            vec_store(seconds, vec_sub(vec_sub(vec_select(backward, lhs_second, rhs_second),
+                                               vec_select(backward, rhs_second, lhs_second)), vec_and(borrow, one)));
+            vec_store(nano_seconds, vec_sub(vec_add(higher_nano_second, vec_and(borrow, billion)), lower_nano_second));
+            backward_bits = vec_signs(backward);
+            if (sink->offsets) {
+                for (k = 0; k < VEC_LANES; k++) {
+                    offset_sink_set(sink, i + k, seconds[k], nano_seconds[k],
+                                    ((backward_bits >> k) & 1) ? DT_FALSE : DT_TRUE);
+                }
+            } else {
+                vec_store(sink->seconds + i, vec_load(seconds));
+                vec_store(sink->nano_seconds + i, vec_load(nano_seconds));
+                for (k = 0; k < VEC_LANES; k++) {
+                    sink->is_forward[i + k] = ((backward_bits >> k) & 1) ? DT_FALSE : DT_TRUE;
+                }
+            }
+        }
+        invalid = vec_signs(invalid_lanes);
+    }
+#endif
+
+    for (; i < count; i++) {
+        dt_timestamp_t lhs_timestamp = source_get(lhs, i);
+        dt_timestamp_t rhs_timestamp = source_get(rhs, i);
+        dt_offset_t result = dt_offset_between_unchecked(&lhs_timestamp, &rhs_timestamp);
+
+        invalid |= (lhs_timestamp.nano_second > MAX_NANO_SECONDS) | (rhs_timestamp.nano_second > MAX_NANO_SECONDS);
+        offset_sink_set(sink, i, result.duration.seconds, result.duration.nano_seconds, result.is_forward);
+    }
+
+    return invalid ? DT_INVALID_ARGUMENT : DT_OK;
+}
+
+KERNEL_TARGET
+static dt_status_t compare(const source_t *source, size_t count, const dt_timestamp_t *threshold,
+                           dt_compare_result_t *results)
+{
+    unsigned long invalid = 0;
+    size_t i = 0;
+
+#if defined(VEC_LANES)
+    {
+        const vec_t threshold_second = vec_set(threshold->second);
+        const vec_t threshold_nano_second = vec_set(threshold->nano_second);
+        vec_t invalid_lanes = vec_set(0);
+
+        for (; i + VEC_LANES <= count; i += VEC_LANES) {
+            vec_t second;
+            vec_t nano_second;
+            int greater = 0;
+            int lesser = 0;
+            int k = 0;
+
+            source_load(source, i, &second, &nano_second);
+            invalid_lanes = vec_or(invalid_lanes, vec_invalid_nano_seconds(nano_second));
+            greater = vec_signs(vec_timestamp_greater(second, nano_second, threshold_second, threshold_nano_second));
+            lesser = vec_signs(vec_timestamp_greater(threshold_second, threshold_nano_second, second, nano_second));
+            for (k = 0; k < VEC_LANES; k++) {
+                results[i + k] = (dt_compare_result_t) (((greater >> k) & 1) - ((lesser >> k) & 1));
+            }
+        }
+        invalid = vec_signs(invalid_lanes);
+    }
+#endif
+
+    for (; i < count; i++) {
+        dt_timestamp_t timestamp = source_get(source, i);
+
+        invalid |= timestamp.nano_second > MAX_NANO_SECONDS;
+        results[i] = dt_compare_timestamps_unchecked(&timestamp, threshold);
+    }
+
+    return invalid ? DT_INVALID_ARGUMENT : DT_OK;
+}
+
+KERNEL_TARGET
+static dt_status_t min_max(const source_t *source, size_t count, dt_timestamp_t *min, dt_timestamp_t *max)
+{
+    dt_timestamp_t lowest = source_get(source, 0);
+    dt_timestamp_t highest = lowest;
+    unsigned long invalid = 0;
+    size_t i = 0;
+
+#if defined(VEC_LANES)
+    if (count >= VEC_LANES) {
+        long seconds[VEC_LANES];
+        unsigned long nano_seconds[VEC_LANES];
+        vec_t lowest_second;
+        vec_t lowest_nano_second;
+        vec_t highest_second;
+        vec_t highest_nano_second;
+        vec_t invalid_lanes;
+        int k = 0;
+
+        // Every lane keeps extremes of its own subsequence, they are reduced after the loop
+        source_load(source, 0, &lowest_second, &lowest_nano_second);
+        highest_second = lowest_second;
+        highest_nano_second = lowest_nano_second;
+        invalid_lanes = vec_invalid_nano_seconds(lowest_nano_second);
+        for (i = VEC_LANES; i + VEC_LANES <= count; i += VEC_LANES) {
+            vec_t second;
+            vec_t nano_second;
+            vec_t lesser;
+            vec_t greater;
+
+            source_load(source, i, &second, &nano_second);
+            invalid_lanes = vec_or(invalid_lanes, vec_invalid_nano_seconds(nano_second));
+            lesser = vec_timestamp_greater(lowest_second, lowest_nano_second, second, nano_second);
+            greater = vec_timestamp_greater(second, nano_second, highest_second, highest_nano_second);
+            lowest_second = vec_select(lesser, second, lowest_second);
+            lowest_nano_second = vec_select(lesser, nano_second, lowest_nano_second);
+            highest_second = vec_select(greater, second, highest_second);
+            highest_nano_second = vec_select(greater, nano_second, highest_nano_second);
+        }
+        invalid = vec_signs(invalid_lanes);
+
+        vec_store(seconds, lowest_second);
+        vec_store(nano_seconds, lowest_nano_second);
+        for (k = 0; k < VEC_LANES; k++) {
+            dt_timestamp_t timestamp;
+
+            timestamp.second = seconds[k];
+            timestamp.nano_second = nano_seconds[k];
+            lowest = dt_compare_timestamps_unchecked(&timestamp, &lowest) == DT_LESSER ? timestamp : lowest;
+        }
+        vec_store(seconds, highest_second);
+        vec_store(nano_seconds, highest_nano_second);
+        for (k = 0; k < VEC_LANES; k++) {
+            dt_timestamp_t timestamp;
+
+            timestamp.second = seconds[k];
+            timestamp.nano_second = nano_seconds[k];
+            highest = dt_compare_timestamps_unchecked(&timestamp, &highest) == DT_GREATER ? timestamp : highest;
+        }
+    }
+#endif
+
+    for (; i < count; i++) {
+        dt_timestamp_t timestamp = source_get(source, i);
+
+        invalid |= timestamp.nano_second > MAX_NANO_SECONDS;
+        lowest = dt_compare_timestamps_unchecked(&timestamp, &lowest) == DT_LESSER ? timestamp : lowest;
+        highest = dt_compare_timestamps_unchecked(&timestamp, &highest) == DT_GREATER ? timestamp : highest;
+    }
+
+    if (invalid) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *min = lowest;
+    *max = highest;
+    return DT_OK;
+}
+
+#undef vec_t
+#undef vec_load
+#undef vec_store
+#undef vec_load_timestamps
+#undef vec_store_timestamps
+#undef source_load
+#undef sink_store
+#undef vec_invalid_nano_seconds
+#undef vec_timestamp_greater
+#undef vec_select
+#undef apply_offset
+#undef offset_between
+#undef compare
+#undef min_max
+#undef vec_set
+#undef vec_add
+#undef vec_sub
+#undef vec_and
+#undef vec_andnot
+#undef vec_or
+#undef vec_xor
+#undef vec_cmpgt32
+#undef vec_cmpeq32
+#undef vec_spread_low
+#undef vec_signs
+#undef vec_cmpgt64
+#undef vec_cmpeq64
+#undef VEC_LANES
+#undef KERNEL
+#undef KERNEL_TARGET
@@ -0,0 +1,233 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include "dt_calendar.h"
+#include <stdint.h>
+#include <limits.h>
+
+// Days from 0000-03-01 to 1970-01-01
+#define DAYS_TO_EPOCH 719468
+// Whole 400-year eras added to day numbers to keep them non-negative in DT_CALENDAR_MAX_SECONDS range
+#define ERAS_BIAS 3670
+#define DAYS_PER_ERA 146097
+#define SECONDS_PER_DAY 86400L
+// Greatest count of units dt_calendar_add_date() takes, any greater one overflows the year
+#define MAX_ADD_COUNT (1LL << 45)
+
+// Splits seconds to days and seconds of day, then converts days to civil dates by the algorithm of
+// C. Neri and L. Schneider, "Euclidean affine functions and their application to calendar algorithms"
+// (2022), where years start in March so that the leap day is the last one. Second loop is branch free
+// unsigned 32-bit arithmetic with one division by a constant and multiplications by constants otherwise,
+// so that compilers vectorize it.
+static inline void calendar_split(const time_t *seconds, size_t count, int *years, int *months, int *days,
+                                  int *seconds_of_day)
+{
+    size_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        time_t day = seconds[i] / SECONDS_PER_DAY;
+        time_t rem = seconds[i] % SECONDS_PER_DAY;
+        time_t borrow = rem < 0;
+        days[i] = (int)(day - borrow);
+        seconds_of_day[i] = (int)(rem + borrow * SECONDS_PER_DAY);
+    }
+
+    for (i = 0; i < count; i++) {
+        uint32_t n = (uint32_t)(days[i] + DAYS_TO_EPOCH + ERAS_BIAS * DAYS_PER_ERA) * 4 + 3;
+        uint32_t century = n / DAYS_PER_ERA;
+        uint64_t year_of_century = (uint64_t) 2939745 * ((n % DAYS_PER_ERA) | 3);
+        uint32_t day_of_year = (uint32_t) year_of_century / 11758980;                 // [0, 365] from March 1
+        uint32_t month_day = 2141 * day_of_year + 197913;
+        uint32_t next_year = day_of_year >= 306;                                       // January or February
+        days[i] = (int)((month_day & 0xffff) / 2141 + 1);
+        months[i] = (int)((month_day >> 16) - 12 * next_year);
+        years[i] = (int)(100 * century + (uint32_t)(year_of_century >> 32) + next_year) - ERAS_BIAS * 400;
+    }
+}
+
+static void calendar_split_generic(const time_t *seconds, size_t count, int *years, int *months, int *days,
+                                   int *seconds_of_day)
+{
+    calendar_split(seconds, count, years, months, days, seconds_of_day);
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DT_CALENDAR_AVX2
+
+__attribute__((target("avx2")))
+static void calendar_split_avx2(const time_t *seconds, size_t count, int *years, int *months, int *days,
+                                int *seconds_of_day)
+{
+    calendar_split(seconds, count, years, months, days, seconds_of_day);
+}
+
+typedef void (*calendar_split_t)(const time_t *, size_t, int *, int *, int *, int *);
+#endif
+
+void dt_calendar_split(const time_t *seconds, size_t count, int *years, int *months, int *days, int *seconds_of_day)
+{
+#ifdef DT_CALENDAR_AVX2
+    // Every thread selects the same kernel, so the race on the first call is harmless
+    static calendar_split_t calendar_split_kernel = NULL;
+    calendar_split_t kernel = __atomic_load_n(&calendar_split_kernel, __ATOMIC_RELAXED);
+
+    if (kernel == NULL) {
+        __builtin_cpu_init();
+        kernel = __builtin_cpu_supports("avx2") ? calendar_split_avx2 : calendar_split_generic;
+        __atomic_store_n(&calendar_split_kernel, kernel, __ATOMIC_RELAXED);
+    }
+    kernel(seconds, count, years, months, days, seconds_of_day);
+#else
+    calendar_split_generic(seconds, count, years, months, days, seconds_of_day);
+#endif
+}
+
+// Scalar conversions below use the era based algorithms of H. Hinnant
+// (see http://howardhinnant.github.io/date_algorithms.html) on 64-bit signed day numbers,
+// with floor division done by biasing the dividend
+
+long long dt_calendar_days_from_civil(long long year, int month, int day)
+{
+    long long march_year = year - (month <= 2);
+    long long era = (march_year >= 0 ? march_year : march_year - 399) / 400;
+    long long yoe = march_year - era * 400;                                         // [0, 399]
+    long long doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * DAYS_PER_ERA + doe - DAYS_TO_EPOCH;
+}
+
+void dt_calendar_civil_from_days(long long days, long long *year, int *month, int *day, int *day_of_year)
+{
+    long long z = days + DAYS_TO_EPOCH;
+    long long era = (z >= 0 ? z : z - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
+    long long doe = z - era * DAYS_PER_ERA;                                         // [0, 146096]
+    long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;         // [0, 399]
+    int doy = (int)(doe - (365 * yoe + yoe / 4 - yoe / 100));                       // [0, 365] from March 1
+    int mp = (5 * doy + 2) / 153;                                                   // [0, 11] from March
+    int next_year = mp >= 10;                                                       // January or February
+    // January and February of the year of March 1 hold 59 days and one more in leap years
+    int leap = (yoe % 4 == 0 && (yoe % 100 != 0 || yoe == 0));
+
+    *year = yoe + era * 400 + next_year;
+    *month = next_year ? mp - 9 : mp + 3;
+    *day = doy - (153 * mp + 2) / 5 + 1;
+    *day_of_year = next_year ? doy - 306 : doy + 59 + leap;
+}
+
+int dt_calendar_day_of_week(long long days)
+{
+    // 1970-01-01 is Thursday
+    int day_of_week = (int)((days + 4) % 7);
+
+    return day_of_week < 0 ? day_of_week + 7 : day_of_week;
+}
+
+static int days_in_month(long long year, int month)
+{
+    int is_leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+
+    // Months of 30 days alternate with ones of 31 days from January to July and from August to December
+    return month == 2 ? 28 + is_leap : 31 - (month - 1) % 7 % 2;
+}
+
+// Business day of days of a weekend is the Friday before them for a positive count, the Monday after them otherwise,
+// then whole weeks are five business days and the rest skips a weekend if it crosses one
+static long long add_business_days(long long days, long long count)
+{
+    // Day of week from Monday (0) to Sunday (6)
+    int day_of_week = (dt_calendar_day_of_week(days) + 6) % 7;
+    long long rest = 0;
+
+    if (count > 0) {
+        if (day_of_week > 4) {
+            days -= day_of_week - 4;
+            day_of_week = 4;
+        }
+        rest = count % 5;
+        return days + count / 5 * 7 + rest + (day_of_week + rest > 4 ? 2 : 0);
+    }
+    if (count < 0) {
+        if (day_of_week > 4) {
+            days += 7 - day_of_week;
+            day_of_week = 0;
+        }
+        count = -count;
+        rest = count % 5;
+        return days - count / 5 * 7 - rest - (day_of_week - rest < 0 ? 2 : 0);
+    }
+    return days;
+}
+
+dt_status_t dt_calendar_add_date(const dt_representation_t *representation, dt_unit_t unit, long count,
+                                 dt_representation_t *result)
+{
+    long long year = representation->year;
+    int month = representation->month;
+    int day = representation->day;
+    int day_of_year = 0;
+    long long days = 0;
+
+    if (count > MAX_ADD_COUNT || count < -MAX_ADD_COUNT) {
+        return DT_OVERFLOW;
+    }
+
+    switch (unit) {
+        case DT_UNIT_YEAR:
+        case DT_UNIT_MONTH: {
+            long long months = year * 12 + month - 1 + (unit == DT_UNIT_YEAR ? count * 12LL : count);
+            long long month_of_year = months % 12;
+
+            // Floor division of months by 12
+            year = months / 12 - (month_of_year < 0);
+            month = (int)(month_of_year < 0 ? month_of_year + 12 : month_of_year) + 1;
+            day = day < days_in_month(year, month) ? day : days_in_month(year, month);
+            break;
+        }
+        case DT_UNIT_WEEK:
+        case DT_UNIT_DAY:
+        case DT_UNIT_BUSINESS_DAY:
+            days = dt_calendar_days_from_civil(year, month, day);
+            days = unit == DT_UNIT_BUSINESS_DAY ? add_business_days(days, count) :
+                   days + (unit == DT_UNIT_WEEK ? count * 7LL : count);
+            dt_calendar_civil_from_days(days, &year, &month, &day, &day_of_year);
+            break;
+        default:
+            return DT_INVALID_ARGUMENT;
+    }
+
+    // Years which do not fit struct tm are rejected as conversions do
+    if (year > INT_MAX || year < (long long) INT_MIN + 1900) {
+        return DT_OVERFLOW;
+    }
+    *result = *representation;
+    result->year = (int) year;
+    result->month = (unsigned short) month;
+    result->day = (unsigned short) day;
+    return DT_OK;
+}
@@ -0,0 +1,107 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef DT_CALENDAR_H
+#define DT_CALENDAR_H
+
+#include <stddef.h>
+#include <time.h>
+#include <libdt/dt_types.h>
+
+/*!
+ * \defgroup Calendar Calendar core
+ * Closed-form proleptic Gregorian calendar arithmetic shared by all conversions
+ * @{
+ */
+
+//! Greatest absolute number of seconds from the epoch dt_calendar_split() accepts (about +/-1.3 million years)
+#define DT_CALENDAR_MAX_SECONDS (500000000LL * 86400)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    //! Breaks down seconds from 1970-01-01 00:00:00 of some local time into dates and seconds of day
+    //! Kernel is selected at first call by the CPU features available (AVX2 or generic one)
+    /*!
+     * @param seconds seconds to break down, each within +/-DT_CALENDAR_MAX_SECONDS
+     * @param count number of elements in all arrays
+     * @param years pointer to store years (astronomical, year 0 is 1 BC) [OUT]
+     * @param months pointer to store months (1-12) [OUT]
+     * @param days pointer to store days of month (1-31) [OUT]
+     * @param seconds_of_day pointer to store seconds from the beginning of the day (0-86399) [OUT]
+     */
+    void dt_calendar_split(const time_t *seconds, size_t count, int *years, int *months, int *days, int *seconds_of_day);
+
+    //! Returns number of days from 1970-01-01 to a date
+    /*!
+     * @param year year (astronomical, year 0 is 1 BC)
+     * @param month month (1-12)
+     * @param day day of month, values out of the month range are counted from the first day of it
+     * @return number of days, negative ones for dates before 1970-01-01
+     */
+    long long dt_calendar_days_from_civil(long long year, int month, int day);
+
+    //! Converts number of days from 1970-01-01 to a date
+    /*!
+     * @param days number of days, within +/-2^60
+     * @param year pointer to store year (astronomical, year 0 is 1 BC) [OUT]
+     * @param month pointer to store month (1-12) [OUT]
+     * @param day pointer to store day of month (1-31) [OUT]
+     * @param day_of_year pointer to store number of days since January 1 (0-365) [OUT]
+     */
+    void dt_calendar_civil_from_days(long long days, long long *year, int *month, int *day, int *day_of_year);
+
+    //! Returns day of week of a day counted from 1970-01-01
+    /*!
+     * @param days number of days
+     * @return day of week (0-6, 0 is Sunday)
+     */
+    int dt_calendar_day_of_week(long long days);
+
+    //! Moves the date of a representation by calendar units, the time of day is kept
+    /*!
+     * Years and months are added to the month with the day clamped to the end of the result month. Business days are
+     * counted from Monday to Friday, a day of a weekend is moved as the Friday before it for a positive count and as
+     * the Monday after it for a negative one.
+     * @param representation representation to move, its year is astronomical
+     * @param unit DT_UNIT_YEAR, DT_UNIT_MONTH, DT_UNIT_WEEK, DT_UNIT_DAY or DT_UNIT_BUSINESS_DAY
+     * @param count number of units to add, negative to subtract
+     * @param result moved representation [OUT]
+     * @return DT_OVERFLOW if the result year does not fit struct tm, DT_INVALID_ARGUMENT for other units
+     */
+    dt_status_t dt_calendar_add_date(const dt_representation_t *representation, dt_unit_t unit, long count,
+                                     dt_representation_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @}*/
+
+#endif // DT_CALENDAR_H
@@ -0,0 +1,2086 @@
+// --- do not edit it manualy! File generated by scripts/transform.py!
+struct tz_unicode_mapping {const char *other; const char* territory; const char* type;};
+const struct tz_unicode_mapping tz_unicode_map[] = {
+//Generated from windowsZones.xml
+//Obtained from local file
+{"Dateline Standard Time", "001", "Etc/GMT+12"},
+{"Dateline Standard Time", "ZZ", "Etc/GMT+12"},
+{"UTC-11", "001", "Etc/GMT+11"},
+{"UTC-11", "AS", "Pacific/Pago_Pago"},
+{"UTC-11", "NU", "Pacific/Niue"},
+{"UTC-11", "UM", "Pacific/Midway"},
+{"UTC-11", "ZZ", "Etc/GMT+11"},
+{"Hawaiian Standard Time", "001", "Pacific/Honolulu"},
+{"Hawaiian Standard Time", "CK", "Pacific/Rarotonga"},
+{"Hawaiian Standard Time", "PF", "Pacific/Tahiti"},
+{"Hawaiian Standard Time", "UM", "Pacific/Johnston"},
+{"Hawaiian Standard Time", "US", "Pacific/Honolulu"},
+{"Hawaiian Standard Time", "ZZ", "Etc/GMT+10"},
+{"Alaskan Standard Time", "001", "America/Anchorage"},
+{"Alaskan Standard Time", "US", "America/Anchorage"},
+{"Alaskan Standard Time", "US", "America/Juneau"},
+{"Alaskan Standard Time", "US", "America/Nome"},
+{"Alaskan Standard Time", "US", "America/Sitka"},
+{"Alaskan Standard Time", "US", "America/Yakutat"},
+{"Pacific Standard Time (Mexico)", "001", "America/Santa_Isabel"},
+{"Pacific Standard Time (Mexico)", "MX", "America/Santa_Isabel"},
+{"Pacific Standard Time", "001", "America/Los_Angeles"},
+{"Pacific Standard Time", "CA", "America/Vancouver"},
+{"Pacific Standard Time", "CA", "America/Dawson"},
+{"Pacific Standard Time", "CA", "America/Whitehorse"},
+{"Pacific Standard Time", "MX", "America/Tijuana"},
+{"Pacific Standard Time", "US", "America/Los_Angeles"},
+{"Pacific Standard Time", "ZZ", "PST8PDT"},
+{"US Mountain Standard Time", "001", "America/Phoenix"},
+{"US Mountain Standard Time", "CA", "America/Dawson_Creek"},
+{"US Mountain Standard Time", "CA", "America/Creston"},
+{"US Mountain Standard Time", "MX", "America/Hermosillo"},
+{"US Mountain Standard Time", "US", "America/Phoenix"},
+{"US Mountain Standard Time", "ZZ", "Etc/GMT+7"},
+{"Mountain Standard Time (Mexico)", "001", "America/Chihuahua"},
+{"Mountain Standard Time (Mexico)", "MX", "America/Chihuahua"},
+{"Mountain Standard Time (Mexico)", "MX", "America/Mazatlan"},
+{"Mountain Standard Time", "001", "America/Denver"},
+{"Mountain Standard Time", "CA", "America/Edmonton"},
+{"Mountain Standard Time", "CA", "America/Cambridge_Bay"},
+{"Mountain Standard Time", "CA", "America/Inuvik"},
+{"Mountain Standard Time", "CA", "America/Yellowknife"},
+{"Mountain Standard Time", "MX", "America/Ojinaga"},
+{"Mountain Standard Time", "US", "America/Denver"},
+{"Mountain Standard Time", "US", "America/Boise"},
+{"Mountain Standard Time", "US", "America/Shiprock"},
+{"Mountain Standard Time", "ZZ", "MST7MDT"},
+{"Central America Standard Time", "001", "America/Guatemala"},
+{"Central America Standard Time", "BZ", "America/Belize"},
+{"Central America Standard Time", "CR", "America/Costa_Rica"},
+{"Central America Standard Time", "EC", "Pacific/Galapagos"},
+{"Central America Standard Time", "GT", "America/Guatemala"},
+{"Central America Standard Time", "HN", "America/Tegucigalpa"},
+{"Central America Standard Time", "NI", "America/Managua"},
+{"Central America Standard Time", "SV", "America/El_Salvador"},
+{"Central America Standard Time", "ZZ", "Etc/GMT+6"},
+{"Central Standard Time", "001", "America/Chicago"},
+{"Central Standard Time", "CA", "America/Winnipeg"},
+{"Central Standard Time", "CA", "America/Rainy_River"},
+{"Central Standard Time", "CA", "America/Rankin_Inlet"},
+{"Central Standard Time", "CA", "America/Resolute"},
+{"Central Standard Time", "MX", "America/Matamoros"},
+{"Central Standard Time", "US", "America/Chicago"},
+{"Central Standard Time", "US", "America/Indiana/Knox"},
+{"Central Standard Time", "US", "America/Indiana/Tell_City"},
+{"Central Standard Time", "US", "America/Menominee"},
+{"Central Standard Time", "US", "America/North_Dakota/Beulah"},
+{"Central Standard Time", "US", "America/North_Dakota/Center"},
+{"Central Standard Time", "US", "America/North_Dakota/New_Salem"},
+{"Central Standard Time", "ZZ", "CST6CDT"},
+{"Central Standard Time (Mexico)", "001", "America/Mexico_City"},
+{"Central Standard Time (Mexico)", "MX", "America/Mexico_City"},
+{"Central Standard Time (Mexico)", "MX", "America/Bahia_Banderas"},
+{"Central Standard Time (Mexico)", "MX", "America/Cancun"},
+{"Central Standard Time (Mexico)", "MX", "America/Merida"},
+{"Central Standard Time (Mexico)", "MX", "America/Monterrey"},
+{"Canada Central Standard Time", "001", "America/Regina"},
+{"Canada Central Standard Time", "CA", "America/Regina"},
+{"Canada Central Standard Time", "CA", "America/Swift_Current"},
+{"SA Pacific Standard Time", "001", "America/Bogota"},
+{"SA Pacific Standard Time", "CA", "America/Coral_Harbour"},
+{"SA Pacific Standard Time", "CO", "America/Bogota"},
+{"SA Pacific Standard Time", "EC", "America/Guayaquil"},
+{"SA Pacific Standard Time", "HT", "America/Port-au-Prince"},
+{"SA Pacific Standard Time", "JM", "America/Jamaica"},
+{"SA Pacific Standard Time", "KY", "America/Cayman"},
+{"SA Pacific Standard Time", "PA", "America/Panama"},
+{"SA Pacific Standard Time", "PE", "America/Lima"},
+{"SA Pacific Standard Time", "ZZ", "Etc/GMT+5"},
+{"Eastern Standard Time", "001", "America/New_York"},
+{"Eastern Standard Time", "BS", "America/Nassau"},
+{"Eastern Standard Time", "CA", "America/Toronto"},
+{"Eastern Standard Time", "CA", "America/Iqaluit"},
+{"Eastern Standard Time", "CA", "America/Montreal"},
+{"Eastern Standard Time", "CA", "America/Nipigon"},
+{"Eastern Standard Time", "CA", "America/Pangnirtung"},
+{"Eastern Standard Time", "CA", "America/Thunder_Bay"},
+{"Eastern Standard Time", "TC", "America/Grand_Turk"},
+{"Eastern Standard Time", "US", "America/New_York"},
+{"Eastern Standard Time", "US", "America/Detroit"},
+{"Eastern Standard Time", "US", "America/Indiana/Petersburg"},
+{"Eastern Standard Time", "US", "America/Indiana/Vincennes"},
+{"Eastern Standard Time", "US", "America/Indiana/Winamac"},
+{"Eastern Standard Time", "US", "America/Kentucky/Monticello"},
+{"Eastern Standard Time", "US", "America/Louisville"},
+{"Eastern Standard Time", "ZZ", "EST5EDT"},
+{"US Eastern Standard Time", "001", "America/Indianapolis"},
+{"US Eastern Standard Time", "US", "America/Indianapolis"},
+{"US Eastern Standard Time", "US", "America/Indiana/Marengo"},
+{"US Eastern Standard Time", "US", "America/Indiana/Vevay"},
+{"Venezuela Standard Time", "001", "America/Caracas"},
+{"Venezuela Standard Time", "VE", "America/Caracas"},
+{"Paraguay Standard Time", "001", "America/Asuncion"},
+{"Paraguay Standard Time", "PY", "America/Asuncion"},
+{"Atlantic Standard Time", "001", "America/Halifax"},
+{"Atlantic Standard Time", "BM", "Atlantic/Bermuda"},
+{"Atlantic Standard Time", "CA", "America/Halifax"},
+{"Atlantic Standard Time", "CA", "America/Glace_Bay"},
+{"Atlantic Standard Time", "CA", "America/Goose_Bay"},
+{"Atlantic Standard Time", "CA", "America/Moncton"},
+{"Atlantic Standard Time", "GL", "America/Thule"},
+{"Central Brazilian Standard Time", "001", "America/Cuiaba"},
+{"Central Brazilian Standard Time", "BR", "America/Cuiaba"},
+{"Central Brazilian Standard Time", "BR", "America/Campo_Grande"},
+{"SA Western Standard Time", "001", "America/La_Paz"},
+{"SA Western Standard Time", "AG", "America/Antigua"},
+{"SA Western Standard Time", "AI", "America/Anguilla"},
+{"SA Western Standard Time", "AW", "America/Aruba"},
+{"SA Western Standard Time", "BB", "America/Barbados"},
+{"SA Western Standard Time", "BL", "America/St_Barthelemy"},
+{"SA Western Standard Time", "BO", "America/La_Paz"},
+{"SA Western Standard Time", "BQ", "America/Kralendijk"},
+{"SA Western Standard Time", "BR", "America/Manaus"},
+{"SA Western Standard Time", "BR", "America/Boa_Vista"},
+{"SA Western Standard Time", "BR", "America/Eirunepe"},
+{"SA Western Standard Time", "BR", "America/Porto_Velho"},
+{"SA Western Standard Time", "BR", "America/Rio_Branco"},
+{"SA Western Standard Time", "CA", "America/Blanc-Sablon"},
+{"SA Western Standard Time", "CW", "America/Curacao"},
+{"SA Western Standard Time", "DM", "America/Dominica"},
+{"SA Western Standard Time", "DO", "America/Santo_Domingo"},
+{"SA Western Standard Time", "GD", "America/Grenada"},
+{"SA Western Standard Time", "GP", "America/Guadeloupe"},
+{"SA Western Standard Time", "GY", "America/Guyana"},
+{"SA Western Standard Time", "KN", "America/St_Kitts"},
+{"SA Western Standard Time", "LC", "America/St_Lucia"},
+{"SA Western Standard Time", "MF", "America/Marigot"},
+{"SA Western Standard Time", "MQ", "America/Martinique"},
+{"SA Western Standard Time", "MS", "America/Montserrat"},
+{"SA Western Standard Time", "PR", "America/Puerto_Rico"},
+{"SA Western Standard Time", "SX", "America/Lower_Princes"},
+{"SA Western Standard Time", "TT", "America/Port_of_Spain"},
+{"SA Western Standard Time", "VC", "America/St_Vincent"},
+{"SA Western Standard Time", "VG", "America/Tortola"},
+{"SA Western Standard Time", "VI", "America/St_Thomas"},
+{"SA Western Standard Time", "ZZ", "Etc/GMT+4"},
+{"Pacific SA Standard Time", "001", "America/Santiago"},
+{"Pacific SA Standard Time", "AQ", "Antarctica/Palmer"},
+{"Pacific SA Standard Time", "CL", "America/Santiago"},
+{"Newfoundland Standard Time", "001", "America/St_Johns"},
+{"Newfoundland Standard Time", "CA", "America/St_Johns"},
+{"E. South America Standard Time", "001", "America/Sao_Paulo"},
+{"E. South America Standard Time", "BR", "America/Sao_Paulo"},
+{"E. South America Standard Time", "BR", "America/Araguaina"},
+{"Argentina Standard Time", "001", "America/Buenos_Aires"},
+{"Argentina Standard Time", "AR", "America/Buenos_Aires"},
+{"Argentina Standard Time", "AR", "America/Argentina/La_Rioja"},
+{"Argentina Standard Time", "AR", "America/Argentina/Rio_Gallegos"},
+{"Argentina Standard Time", "AR", "America/Argentina/Salta"},
+{"Argentina Standard Time", "AR", "America/Argentina/San_Juan"},
+{"Argentina Standard Time", "AR", "America/Argentina/San_Luis"},
+{"Argentina Standard Time", "AR", "America/Argentina/Tucuman"},
+{"Argentina Standard Time", "AR", "America/Argentina/Ushuaia"},
+{"Argentina Standard Time", "AR", "America/Catamarca"},
+{"Argentina Standard Time", "AR", "America/Cordoba"},
+{"Argentina Standard Time", "AR", "America/Jujuy"},
+{"Argentina Standard Time", "AR", "America/Mendoza"},
+{"SA Eastern Standard Time", "001", "America/Cayenne"},
+{"SA Eastern Standard Time", "AQ", "Antarctica/Rothera"},
+{"SA Eastern Standard Time", "BR", "America/Fortaleza"},
+{"SA Eastern Standard Time", "BR", "America/Belem"},
+{"SA Eastern Standard Time", "BR", "America/Maceio"},
+{"SA Eastern Standard Time", "BR", "America/Recife"},
+{"SA Eastern Standard Time", "BR", "America/Santarem"},
+{"SA Eastern Standard Time", "FK", "Atlantic/Stanley"},
+{"SA Eastern Standard Time", "GF", "America/Cayenne"},
+{"SA Eastern Standard Time", "SR", "America/Paramaribo"},
+{"SA Eastern Standard Time", "ZZ", "Etc/GMT+3"},
+{"Greenland Standard Time", "001", "America/Godthab"},
+{"Greenland Standard Time", "GL", "America/Godthab"},
+{"Montevideo Standard Time", "001", "America/Montevideo"},
+{"Montevideo Standard Time", "UY", "America/Montevideo"},
+{"Bahia Standard Time", "001", "America/Bahia"},
+{"Bahia Standard Time", "BR", "America/Bahia"},
+{"UTC-02", "001", "Etc/GMT+2"},
+{"UTC-02", "BR", "America/Noronha"},
+{"UTC-02", "GS", "Atlantic/South_Georgia"},
+{"UTC-02", "ZZ", "Etc/GMT+2"},
+{"Azores Standard Time", "001", "Atlantic/Azores"},
+{"Azores Standard Time", "GL", "America/Scoresbysund"},
+{"Azores Standard Time", "PT", "Atlantic/Azores"},
+{"Cape Verde Standard Time", "001", "Atlantic/Cape_Verde"},
+{"Cape Verde Standard Time", "CV", "Atlantic/Cape_Verde"},
+{"Cape Verde Standard Time", "ZZ", "Etc/GMT+1"},
+{"Morocco Standard Time", "001", "Africa/Casablanca"},
+{"Morocco Standard Time", "MA", "Africa/Casablanca"},
+{"UTC", "001", "Etc/GMT"},
+{"UTC", "001", "Etc/UTC"},
+{"UTC", "GL", "America/Danmarkshavn"},
+{"UTC", "ZZ", "Etc/GMT"},
+{"GMT Standard Time", "001", "Europe/London"},
+{"GMT Standard Time", "ES", "Atlantic/Canary"},
+{"GMT Standard Time", "FO", "Atlantic/Faeroe"},
+{"GMT Standard Time", "GB", "Europe/London"},
+{"GMT Standard Time", "GG", "Europe/Guernsey"},
+{"GMT Standard Time", "IE", "Europe/Dublin"},
+{"GMT Standard Time", "IM", "Europe/Isle_of_Man"},
+{"GMT Standard Time", "JE", "Europe/Jersey"},
+{"GMT Standard Time", "PT", "Europe/Lisbon"},
+{"GMT Standard Time", "PT", "Atlantic/Madeira"},
+{"Greenwich Standard Time", "001", "Atlantic/Reykjavik"},
+{"Greenwich Standard Time", "BF", "Africa/Ouagadougou"},
+{"Greenwich Standard Time", "CI", "Africa/Abidjan"},
+{"Greenwich Standard Time", "EH", "Africa/El_Aaiun"},
+{"Greenwich Standard Time", "GH", "Africa/Accra"},
+{"Greenwich Standard Time", "GM", "Africa/Banjul"},
+{"Greenwich Standard Time", "GN", "Africa/Conakry"},
+{"Greenwich Standard Time", "GW", "Africa/Bissau"},
+{"Greenwich Standard Time", "IS", "Atlantic/Reykjavik"},
+{"Greenwich Standard Time", "LR", "Africa/Monrovia"},
+{"Greenwich Standard Time", "ML", "Africa/Bamako"},
+{"Greenwich Standard Time", "MR", "Africa/Nouakchott"},
+{"Greenwich Standard Time", "SH", "Atlantic/St_Helena"},
+{"Greenwich Standard Time", "SL", "Africa/Freetown"},
+{"Greenwich Standard Time", "SN", "Africa/Dakar"},
+{"Greenwich Standard Time", "ST", "Africa/Sao_Tome"},
+{"Greenwich Standard Time", "TG", "Africa/Lome"},
+{"W. Europe Standard Time", "001", "Europe/Berlin"},
+{"W. Europe Standard Time", "AD", "Europe/Andorra"},
+{"W. Europe Standard Time", "AT", "Europe/Vienna"},
+{"W. Europe Standard Time", "CH", "Europe/Zurich"},
+{"W. Europe Standard Time", "DE", "Europe/Berlin"},
+{"W. Europe Standard Time", "DE", "Europe/Busingen"},
+{"W. Europe Standard Time", "GI", "Europe/Gibraltar"},
+{"W. Europe Standard Time", "IT", "Europe/Rome"},
+{"W. Europe Standard Time", "LI", "Europe/Vaduz"},
+{"W. Europe Standard Time", "LU", "Europe/Luxembourg"},
+{"W. Europe Standard Time", "LY", "Africa/Tripoli"},
+{"W. Europe Standard Time", "MC", "Europe/Monaco"},
+{"W. Europe Standard Time", "MT", "Europe/Malta"},
+{"W. Europe Standard Time", "NL", "Europe/Amsterdam"},
+{"W. Europe Standard Time", "NO", "Europe/Oslo"},
+{"W. Europe Standard Time", "SE", "Europe/Stockholm"},
+{"W. Europe Standard Time", "SJ", "Arctic/Longyearbyen"},
+{"W. Europe Standard Time", "SM", "Europe/San_Marino"},
+{"W. Europe Standard Time", "VA", "Europe/Vatican"},
+{"Central Europe Standard Time", "001", "Europe/Budapest"},
+{"Central Europe Standard Time", "AL", "Europe/Tirane"},
+{"Central Europe Standard Time", "CZ", "Europe/Prague"},
+{"Central Europe Standard Time", "HU", "Europe/Budapest"},
+{"Central Europe Standard Time", "ME", "Europe/Podgorica"},
+{"Central Europe Standard Time", "RS", "Europe/Belgrade"},
+{"Central Europe Standard Time", "SI", "Europe/Ljubljana"},
+{"Central Europe Standard Time", "SK", "Europe/Bratislava"},
+{"Romance Standard Time", "001", "Europe/Paris"},
+{"Romance Standard Time", "BE", "Europe/Brussels"},
+{"Romance Standard Time", "DK", "Europe/Copenhagen"},
+{"Romance Standard Time", "ES", "Europe/Madrid"},
+{"Romance Standard Time", "ES", "Africa/Ceuta"},
+{"Romance Standard Time", "FR", "Europe/Paris"},
+{"Central European Standard Time", "001", "Europe/Warsaw"},
+{"Central European Standard Time", "BA", "Europe/Sarajevo"},
+{"Central European Standard Time", "HR", "Europe/Zagreb"},
+{"Central European Standard Time", "MK", "Europe/Skopje"},
+{"Central European Standard Time", "PL", "Europe/Warsaw"},
+{"W. Central Africa Standard Time", "001", "Africa/Lagos"},
+{"W. Central Africa Standard Time", "AO", "Africa/Luanda"},
+{"W. Central Africa Standard Time", "BJ", "Africa/Porto-Novo"},
+{"W. Central Africa Standard Time", "CD", "Africa/Kinshasa"},
+{"W. Central Africa Standard Time", "CF", "Africa/Bangui"},
+{"W. Central Africa Standard Time", "CG", "Africa/Brazzaville"},
+{"W. Central Africa Standard Time", "CM", "Africa/Douala"},
+{"W. Central Africa Standard Time", "DZ", "Africa/Algiers"},
+{"W. Central Africa Standard Time", "GA", "Africa/Libreville"},
+{"W. Central Africa Standard Time", "GQ", "Africa/Malabo"},
+{"W. Central Africa Standard Time", "NE", "Africa/Niamey"},
+{"W. Central Africa Standard Time", "NG", "Africa/Lagos"},
+{"W. Central Africa Standard Time", "TD", "Africa/Ndjamena"},
+{"W. Central Africa Standard Time", "TN", "Africa/Tunis"},
+{"W. Central Africa Standard Time", "ZZ", "Etc/GMT-1"},
+{"Namibia Standard Time", "001", "Africa/Windhoek"},
+{"Namibia Standard Time", "NA", "Africa/Windhoek"},
+{"GTB Standard Time", "001", "Europe/Bucharest"},
+{"GTB Standard Time", "GR", "Europe/Athens"},
+{"GTB Standard Time", "MD", "Europe/Chisinau"},
+{"GTB Standard Time", "RO", "Europe/Bucharest"},
+{"Middle East Standard Time", "001", "Asia/Beirut"},
+{"Middle East Standard Time", "LB", "Asia/Beirut"},
+{"Egypt Standard Time", "001", "Africa/Cairo"},
+{"Egypt Standard Time", "EG", "Africa/Cairo"},
+{"Egypt Standard Time", "PS", "Asia/Gaza"},
+{"Egypt Standard Time", "PS", "Asia/Hebron"},
+{"Syria Standard Time", "001", "Asia/Damascus"},
+{"Syria Standard Time", "SY", "Asia/Damascus"},
+{"E. Europe Standard Time", "001", "Asia/Nicosia"},
+{"E. Europe Standard Time", "CY", "Asia/Nicosia"},
+{"South Africa Standard Time", "001", "Africa/Johannesburg"},
+{"South Africa Standard Time", "BI", "Africa/Bujumbura"},
+{"South Africa Standard Time", "BW", "Africa/Gaborone"},
+{"South Africa Standard Time", "CD", "Africa/Lubumbashi"},
+{"South Africa Standard Time", "LS", "Africa/Maseru"},
+{"South Africa Standard Time", "MW", "Africa/Blantyre"},
+{"South Africa Standard Time", "MZ", "Africa/Maputo"},
+{"South Africa Standard Time", "RW", "Africa/Kigali"},
+{"South Africa Standard Time", "SZ", "Africa/Mbabane"},
+{"South Africa Standard Time", "ZA", "Africa/Johannesburg"},
+{"South Africa Standard Time", "ZM", "Africa/Lusaka"},
+{"South Africa Standard Time", "ZW", "Africa/Harare"},
+{"South Africa Standard Time", "ZZ", "Etc/GMT-2"},
+{"FLE Standard Time", "001", "Europe/Kiev"},
+{"FLE Standard Time", "AX", "Europe/Mariehamn"},
+{"FLE Standard Time", "BG", "Europe/Sofia"},
+{"FLE Standard Time", "EE", "Europe/Tallinn"},
+{"FLE Standard Time", "FI", "Europe/Helsinki"},
+{"FLE Standard Time", "LT", "Europe/Vilnius"},
+{"FLE Standard Time", "LV", "Europe/Riga"},
+{"FLE Standard Time", "UA", "Europe/Kiev"},
+{"FLE Standard Time", "UA", "Europe/Simferopol"},
+{"FLE Standard Time", "UA", "Europe/Uzhgorod"},
+{"FLE Standard Time", "UA", "Europe/Zaporozhye"},
+{"Turkey Standard Time", "001", "Europe/Istanbul"},
+{"Turkey Standard Time", "TR", "Europe/Istanbul"},
+{"Israel Standard Time", "001", "Asia/Jerusalem"},
+{"Israel Standard Time", "IL", "Asia/Jerusalem"},
+{"Jordan Standard Time", "001", "Asia/Amman"},
+{"Jordan Standard Time", "JO", "Asia/Amman"},
+{"Arabic Standard Time", "001", "Asia/Baghdad"},
+{"Arabic Standard Time", "IQ", "Asia/Baghdad"},
+{"Kaliningrad Standard Time", "001", "Europe/Kaliningrad"},
+{"Kaliningrad Standard Time", "BY", "Europe/Minsk"},
+{"Kaliningrad Standard Time", "RU", "Europe/Kaliningrad"},
+{"Arab Standard Time", "001", "Asia/Riyadh"},
+{"Arab Standard Time", "BH", "Asia/Bahrain"},
+{"Arab Standard Time", "KW", "Asia/Kuwait"},
+{"Arab Standard Time", "QA", "Asia/Qatar"},
+{"Arab Standard Time", "SA", "Asia/Riyadh"},
+{"Arab Standard Time", "YE", "Asia/Aden"},
+{"E. Africa Standard Time", "001", "Africa/Nairobi"},
+{"E. Africa Standard Time", "AQ", "Antarctica/Syowa"},
+{"E. Africa Standard Time", "DJ", "Africa/Djibouti"},
+{"E. Africa Standard Time", "ER", "Africa/Asmera"},
+{"E. Africa Standard Time", "ET", "Africa/Addis_Ababa"},
+{"E. Africa Standard Time", "KE", "Africa/Nairobi"},
+{"E. Africa Standard Time", "KM", "Indian/Comoro"},
+{"E. Africa Standard Time", "MG", "Indian/Antananarivo"},
+{"E. Africa Standard Time", "SD", "Africa/Khartoum"},
+{"E. Africa Standard Time", "SO", "Africa/Mogadishu"},
+{"E. Africa Standard Time", "SS", "Africa/Juba"},
+{"E. Africa Standard Time", "TZ", "Africa/Dar_es_Salaam"},
+{"E. Africa Standard Time", "UG", "Africa/Kampala"},
+{"E. Africa Standard Time", "YT", "Indian/Mayotte"},
+{"E. Africa Standard Time", "ZZ", "Etc/GMT-3"},
+{"Iran Standard Time", "001", "Asia/Tehran"},
+{"Iran Standard Time", "IR", "Asia/Tehran"},
+{"Arabian Standard Time", "001", "Asia/Dubai"},
+{"Arabian Standard Time", "AE", "Asia/Dubai"},
+{"Arabian Standard Time", "OM", "Asia/Muscat"},
+{"Arabian Standard Time", "ZZ", "Etc/GMT-4"},
+{"Azerbaijan Standard Time", "001", "Asia/Baku"},
+{"Azerbaijan Standard Time", "AZ", "Asia/Baku"},
+{"Russian Standard Time", "001", "Europe/Moscow"},
+{"Russian Standard Time", "RU", "Europe/Moscow"},
+{"Russian Standard Time", "RU", "Europe/Samara"},
+{"Russian Standard Time", "RU", "Europe/Volgograd"},
+{"Mauritius Standard Time", "001", "Indian/Mauritius"},
+{"Mauritius Standard Time", "MU", "Indian/Mauritius"},
+{"Mauritius Standard Time", "RE", "Indian/Reunion"},
+{"Mauritius Standard Time", "SC", "Indian/Mahe"},
+{"Georgian Standard Time", "001", "Asia/Tbilisi"},
+{"Georgian Standard Time", "GE", "Asia/Tbilisi"},
+{"Caucasus Standard Time", "001", "Asia/Yerevan"},
+{"Caucasus Standard Time", "AM", "Asia/Yerevan"},
+{"Afghanistan Standard Time", "001", "Asia/Kabul"},
+{"Afghanistan Standard Time", "AF", "Asia/Kabul"},
+{"Pakistan Standard Time", "001", "Asia/Karachi"},
+{"Pakistan Standard Time", "PK", "Asia/Karachi"},
+{"West Asia Standard Time", "001", "Asia/Tashkent"},
+{"West Asia Standard Time", "AQ", "Antarctica/Mawson"},
+{"West Asia Standard Time", "KZ", "Asia/Oral"},
+{"West Asia Standard Time", "KZ", "Asia/Aqtau"},
+{"West Asia Standard Time", "KZ", "Asia/Aqtobe"},
+{"West Asia Standard Time", "MV", "Indian/Maldives"},
+{"West Asia Standard Time", "TF", "Indian/Kerguelen"},
+{"West Asia Standard Time", "TJ", "Asia/Dushanbe"},
+{"West Asia Standard Time", "TM", "Asia/Ashgabat"},
+{"West Asia Standard Time", "UZ", "Asia/Tashkent"},
+{"West Asia Standard Time", "UZ", "Asia/Samarkand"},
+{"West Asia Standard Time", "ZZ", "Etc/GMT-5"},
+{"India Standard Time", "001", "Asia/Calcutta"},
+{"India Standard Time", "IN", "Asia/Calcutta"},
+{"Sri Lanka Standard Time", "001", "Asia/Colombo"},
+{"Sri Lanka Standard Time", "LK", "Asia/Colombo"},
+{"Nepal Standard Time", "001", "Asia/Katmandu"},
+{"Nepal Standard Time", "NP", "Asia/Katmandu"},
+{"Central Asia Standard Time", "001", "Asia/Almaty"},
+{"Central Asia Standard Time", "AQ", "Antarctica/Vostok"},
+{"Central Asia Standard Time", "IO", "Indian/Chagos"},
+{"Central Asia Standard Time", "KG", "Asia/Bishkek"},
+{"Central Asia Standard Time", "KZ", "Asia/Almaty"},
+{"Central Asia Standard Time", "KZ", "Asia/Qyzylorda"},
+{"Central Asia Standard Time", "ZZ", "Etc/GMT-6"},
+{"Bangladesh Standard Time", "001", "Asia/Dhaka"},
+{"Bangladesh Standard Time", "BD", "Asia/Dhaka"},
+{"Bangladesh Standard Time", "BT", "Asia/Thimphu"},
+{"Ekaterinburg Standard Time", "001", "Asia/Yekaterinburg"},
+{"Ekaterinburg Standard Time", "RU", "Asia/Yekaterinburg"},
+{"Myanmar Standard Time", "001", "Asia/Rangoon"},
+{"Myanmar Standard Time", "CC", "Indian/Cocos"},
+{"Myanmar Standard Time", "MM", "Asia/Rangoon"},
+{"SE Asia Standard Time", "001", "Asia/Bangkok"},
+{"SE Asia Standard Time", "AQ", "Antarctica/Davis"},
+{"SE Asia Standard Time", "CX", "Indian/Christmas"},
+{"SE Asia Standard Time", "ID", "Asia/Jakarta"},
+{"SE Asia Standard Time", "ID", "Asia/Pontianak"},
+{"SE Asia Standard Time", "KH", "Asia/Phnom_Penh"},
+{"SE Asia Standard Time", "LA", "Asia/Vientiane"},
+{"SE Asia Standard Time", "MN", "Asia/Hovd"},
+{"SE Asia Standard Time", "TH", "Asia/Bangkok"},
+{"SE Asia Standard Time", "VN", "Asia/Saigon"},
+{"SE Asia Standard Time", "ZZ", "Etc/GMT-7"},
+{"N. Central Asia Standard Time", "001", "Asia/Novosibirsk"},
+{"N. Central Asia Standard Time", "RU", "Asia/Novosibirsk"},
+{"N. Central Asia Standard Time", "RU", "Asia/Novokuznetsk"},
+{"N. Central Asia Standard Time", "RU", "Asia/Omsk"},
+{"China Standard Time", "001", "Asia/Shanghai"},
+{"China Standard Time", "CN", "Asia/Shanghai"},
+{"China Standard Time", "CN", "Asia/Chongqing"},
+{"China Standard Time", "CN", "Asia/Harbin"},
+{"China Standard Time", "CN", "Asia/Kashgar"},
+{"China Standard Time", "CN", "Asia/Urumqi"},
+{"China Standard Time", "HK", "Asia/Hong_Kong"},
+{"China Standard Time", "MO", "Asia/Macau"},
+{"North Asia Standard Time", "001", "Asia/Krasnoyarsk"},
+{"North Asia Standard Time", "RU", "Asia/Krasnoyarsk"},
+{"Singapore Standard Time", "001", "Asia/Singapore"},
+{"Singapore Standard Time", "BN", "Asia/Brunei"},
+{"Singapore Standard Time", "ID", "Asia/Makassar"},
+{"Singapore Standard Time", "MY", "Asia/Kuala_Lumpur"},
+{"Singapore Standard Time", "MY", "Asia/Kuching"},
+{"Singapore Standard Time", "PH", "Asia/Manila"},
+{"Singapore Standard Time", "SG", "Asia/Singapore"},
+{"Singapore Standard Time", "ZZ", "Etc/GMT-8"},
+{"W. Australia Standard Time", "001", "Australia/Perth"},
+{"W. Australia Standard Time", "AQ", "Antarctica/Casey"},
+{"W. Australia Standard Time", "AU", "Australia/Perth"},
+{"Taipei Standard Time", "001", "Asia/Taipei"},
+{"Taipei Standard Time", "TW", "Asia/Taipei"},
+{"Ulaanbaatar Standard Time", "001", "Asia/Ulaanbaatar"},
+{"Ulaanbaatar Standard Time", "MN", "Asia/Ulaanbaatar"},
+{"Ulaanbaatar Standard Time", "MN", "Asia/Choibalsan"},
+{"North Asia East Standard Time", "001", "Asia/Irkutsk"},
+{"North Asia East Standard Time", "RU", "Asia/Irkutsk"},
+{"Tokyo Standard Time", "001", "Asia/Tokyo"},
+{"Tokyo Standard Time", "ID", "Asia/Jayapura"},
+{"Tokyo Standard Time", "JP", "Asia/Tokyo"},
+{"Tokyo Standard Time", "PW", "Pacific/Palau"},
+{"Tokyo Standard Time", "TL", "Asia/Dili"},
+{"Tokyo Standard Time", "ZZ", "Etc/GMT-9"},
+{"Korea Standard Time", "001", "Asia/Seoul"},
+{"Korea Standard Time", "KP", "Asia/Pyongyang"},
+{"Korea Standard Time", "KR", "Asia/Seoul"},
+{"Cen. Australia Standard Time", "001", "Australia/Adelaide"},
+{"Cen. Australia Standard Time", "AU", "Australia/Adelaide"},
+{"Cen. Australia Standard Time", "AU", "Australia/Broken_Hill"},
+{"AUS Central Standard Time", "001", "Australia/Darwin"},
+{"AUS Central Standard Time", "AU", "Australia/Darwin"},
+{"E. Australia Standard Time", "001", "Australia/Brisbane"},
+{"E. Australia Standard Time", "AU", "Australia/Brisbane"},
+{"E. Australia Standard Time", "AU", "Australia/Lindeman"},
+{"AUS Eastern Standard Time", "001", "Australia/Sydney"},
+{"AUS Eastern Standard Time", "AU", "Australia/Sydney"},
+{"AUS Eastern Standard Time", "AU", "Australia/Melbourne"},
+{"West Pacific Standard Time", "001", "Pacific/Port_Moresby"},
+{"West Pacific Standard Time", "AQ", "Antarctica/DumontDUrville"},
+{"West Pacific Standard Time", "FM", "Pacific/Truk"},
+{"West Pacific Standard Time", "GU", "Pacific/Guam"},
+{"West Pacific Standard Time", "MP", "Pacific/Saipan"},
+{"West Pacific Standard Time", "PG", "Pacific/Port_Moresby"},
+{"West Pacific Standard Time", "ZZ", "Etc/GMT-10"},
+{"Tasmania Standard Time", "001", "Australia/Hobart"},
+{"Tasmania Standard Time", "AU", "Australia/Hobart"},
+{"Tasmania Standard Time", "AU", "Australia/Currie"},
+{"Yakutsk Standard Time", "001", "Asia/Yakutsk"},
+{"Yakutsk Standard Time", "RU", "Asia/Yakutsk"},
+{"Yakutsk Standard Time", "RU", "Asia/Khandyga"},
+{"Central Pacific Standard Time", "001", "Pacific/Guadalcanal"},
+{"Central Pacific Standard Time", "AQ", "Antarctica/Macquarie"},
+{"Central Pacific Standard Time", "FM", "Pacific/Ponape"},
+{"Central Pacific Standard Time", "FM", "Pacific/Kosrae"},
+{"Central Pacific Standard Time", "NC", "Pacific/Noumea"},
+{"Central Pacific Standard Time", "SB", "Pacific/Guadalcanal"},
+{"Central Pacific Standard Time", "VU", "Pacific/Efate"},
+{"Central Pacific Standard Time", "ZZ", "Etc/GMT-11"},
+{"Vladivostok Standard Time", "001", "Asia/Vladivostok"},
+{"Vladivostok Standard Time", "RU", "Asia/Vladivostok"},
+{"Vladivostok Standard Time", "RU", "Asia/Sakhalin"},
+{"Vladivostok Standard Time", "RU", "Asia/Ust-Nera"},
+{"New Zealand Standard Time", "001", "Pacific/Auckland"},
+{"New Zealand Standard Time", "AQ", "Antarctica/South_Pole"},
+{"New Zealand Standard Time", "AQ", "Antarctica/McMurdo"},
+{"New Zealand Standard Time", "NZ", "Pacific/Auckland"},
+{"UTC+12", "001", "Etc/GMT-12"},
+{"UTC+12", "KI", "Pacific/Tarawa"},
+{"UTC+12", "MH", "Pacific/Majuro"},
+{"UTC+12", "MH", "Pacific/Kwajalein"},
+{"UTC+12", "NR", "Pacific/Nauru"},
+{"UTC+12", "TV", "Pacific/Funafuti"},
+{"UTC+12", "UM", "Pacific/Wake"},
+{"UTC+12", "WF", "Pacific/Wallis"},
+{"UTC+12", "ZZ", "Etc/GMT-12"},
+{"Fiji Standard Time", "001", "Pacific/Fiji"},
+{"Fiji Standard Time", "FJ", "Pacific/Fiji"},
+{"Magadan Standard Time", "001", "Asia/Magadan"},
+{"Magadan Standard Time", "RU", "Asia/Magadan"},
+{"Magadan Standard Time", "RU", "Asia/Anadyr"},
+{"Magadan Standard Time", "RU", "Asia/Kamchatka"},
+{"Tonga Standard Time", "001", "Pacific/Tongatapu"},
+{"Tonga Standard Time", "KI", "Pacific/Enderbury"},
+{"Tonga Standard Time", "TK", "Pacific/Fakaofo"},
+{"Tonga Standard Time", "TO", "Pacific/Tongatapu"},
+{"Tonga Standard Time", "ZZ", "Etc/GMT-13"},
+{"Samoa Standard Time", "001", "Pacific/Apia"},
+{"Samoa Standard Time", "WS", "Pacific/Apia"}
+};
+const size_t tz_unicode_map_size =  533 ;
+
+static const tz_alias_t tz_alias_table[] = {
+    {DT_TZMAP_WIN_STANDARD_TIME, "Dateline Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+12"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "UTC-11"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+11"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Pago_Pago"},
+    {DT_TZMAP_ABBREVIATION, "AS"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Niue"},
+    {DT_TZMAP_ABBREVIATION, "NU"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Midway"},
+    {DT_TZMAP_ABBREVIATION, "UM"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Hawaiian Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Honolulu"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Rarotonga"},
+    {DT_TZMAP_ABBREVIATION, "CK"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Tahiti"},
+    {DT_TZMAP_ABBREVIATION, "PF"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Johnston"},
+    {DT_TZMAP_ABBREVIATION, "UM"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+10"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Alaskan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Anchorage"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "America/Juneau"},
+    {DT_TZMAP_OLSEN_NAME, "America/Nome"},
+    {DT_TZMAP_OLSEN_NAME, "America/Sitka"},
+    {DT_TZMAP_OLSEN_NAME, "America/Yakutat"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Pacific Standard Time (Mexico)"},
+    {DT_TZMAP_OLSEN_NAME, "America/Santa_Isabel"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Pacific Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Los_Angeles"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Vancouver"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Dawson"},
+    {DT_TZMAP_OLSEN_NAME, "America/Whitehorse"},
+    {DT_TZMAP_OLSEN_NAME, "America/Tijuana"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "PST8PDT"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "US Mountain Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Phoenix"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Dawson_Creek"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Creston"},
+    {DT_TZMAP_OLSEN_NAME, "America/Hermosillo"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+7"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Mountain Standard Time (Mexico)"},
+    {DT_TZMAP_OLSEN_NAME, "America/Chihuahua"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_OLSEN_NAME, "America/Mazatlan"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Mountain Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Denver"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Edmonton"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cambridge_Bay"},
+    {DT_TZMAP_OLSEN_NAME, "America/Inuvik"},
+    {DT_TZMAP_OLSEN_NAME, "America/Yellowknife"},
+    {DT_TZMAP_OLSEN_NAME, "America/Ojinaga"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "America/Boise"},
+    {DT_TZMAP_OLSEN_NAME, "America/Shiprock"},
+    {DT_TZMAP_OLSEN_NAME, "MST7MDT"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central America Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Guatemala"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Belize"},
+    {DT_TZMAP_ABBREVIATION, "BZ"},
+    {DT_TZMAP_OLSEN_NAME, "America/Costa_Rica"},
+    {DT_TZMAP_ABBREVIATION, "CR"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Galapagos"},
+    {DT_TZMAP_ABBREVIATION, "EC"},
+    {DT_TZMAP_ABBREVIATION, "GT"},
+    {DT_TZMAP_OLSEN_NAME, "America/Tegucigalpa"},
+    {DT_TZMAP_ABBREVIATION, "HN"},
+    {DT_TZMAP_OLSEN_NAME, "America/Managua"},
+    {DT_TZMAP_ABBREVIATION, "NI"},
+    {DT_TZMAP_OLSEN_NAME, "America/El_Salvador"},
+    {DT_TZMAP_ABBREVIATION, "SV"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+6"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Chicago"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Winnipeg"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Rainy_River"},
+    {DT_TZMAP_OLSEN_NAME, "America/Rankin_Inlet"},
+    {DT_TZMAP_OLSEN_NAME, "America/Resolute"},
+    {DT_TZMAP_OLSEN_NAME, "America/Matamoros"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Knox"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Tell_City"},
+    {DT_TZMAP_OLSEN_NAME, "America/Menominee"},
+    {DT_TZMAP_OLSEN_NAME, "America/North_Dakota/Beulah"},
+    {DT_TZMAP_OLSEN_NAME, "America/North_Dakota/Center"},
+    {DT_TZMAP_OLSEN_NAME, "America/North_Dakota/New_Salem"},
+    {DT_TZMAP_OLSEN_NAME, "CST6CDT"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Standard Time (Mexico)"},
+    {DT_TZMAP_OLSEN_NAME, "America/Mexico_City"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MX"},
+    {DT_TZMAP_OLSEN_NAME, "America/Bahia_Banderas"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cancun"},
+    {DT_TZMAP_OLSEN_NAME, "America/Merida"},
+    {DT_TZMAP_OLSEN_NAME, "America/Monterrey"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Canada Central Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Regina"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Swift_Current"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "SA Pacific Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Bogota"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Coral_Harbour"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_ABBREVIATION, "CO"},
+    {DT_TZMAP_OLSEN_NAME, "America/Guayaquil"},
+    {DT_TZMAP_ABBREVIATION, "EC"},
+    {DT_TZMAP_OLSEN_NAME, "America/Port-au-Prince"},
+    {DT_TZMAP_ABBREVIATION, "HT"},
+    {DT_TZMAP_OLSEN_NAME, "America/Jamaica"},
+    {DT_TZMAP_ABBREVIATION, "JM"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cayman"},
+    {DT_TZMAP_ABBREVIATION, "KY"},
+    {DT_TZMAP_OLSEN_NAME, "America/Panama"},
+    {DT_TZMAP_ABBREVIATION, "PA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Lima"},
+    {DT_TZMAP_ABBREVIATION, "PE"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+5"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Eastern Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/New_York"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Nassau"},
+    {DT_TZMAP_ABBREVIATION, "BS"},
+    {DT_TZMAP_OLSEN_NAME, "America/Toronto"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Iqaluit"},
+    {DT_TZMAP_OLSEN_NAME, "America/Montreal"},
+    {DT_TZMAP_OLSEN_NAME, "America/Nipigon"},
+    {DT_TZMAP_OLSEN_NAME, "America/Pangnirtung"},
+    {DT_TZMAP_OLSEN_NAME, "America/Thunder_Bay"},
+    {DT_TZMAP_OLSEN_NAME, "America/Grand_Turk"},
+    {DT_TZMAP_ABBREVIATION, "TC"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "America/Detroit"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Petersburg"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Vincennes"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Winamac"},
+    {DT_TZMAP_OLSEN_NAME, "America/Kentucky/Monticello"},
+    {DT_TZMAP_OLSEN_NAME, "America/Louisville"},
+    {DT_TZMAP_OLSEN_NAME, "EST5EDT"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "US Eastern Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indianapolis"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "US"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Marengo"},
+    {DT_TZMAP_OLSEN_NAME, "America/Indiana/Vevay"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Venezuela Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Caracas"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "VE"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Paraguay Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Asuncion"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "PY"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Atlantic Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Halifax"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Bermuda"},
+    {DT_TZMAP_ABBREVIATION, "BM"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Glace_Bay"},
+    {DT_TZMAP_OLSEN_NAME, "America/Goose_Bay"},
+    {DT_TZMAP_OLSEN_NAME, "America/Moncton"},
+    {DT_TZMAP_OLSEN_NAME, "America/Thule"},
+    {DT_TZMAP_ABBREVIATION, "GL"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Brazilian Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cuiaba"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Campo_Grande"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "SA Western Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/La_Paz"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Antigua"},
+    {DT_TZMAP_ABBREVIATION, "AG"},
+    {DT_TZMAP_OLSEN_NAME, "America/Anguilla"},
+    {DT_TZMAP_ABBREVIATION, "AI"},
+    {DT_TZMAP_OLSEN_NAME, "America/Aruba"},
+    {DT_TZMAP_ABBREVIATION, "AW"},
+    {DT_TZMAP_OLSEN_NAME, "America/Barbados"},
+    {DT_TZMAP_ABBREVIATION, "BB"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Barthelemy"},
+    {DT_TZMAP_ABBREVIATION, "BL"},
+    {DT_TZMAP_ABBREVIATION, "BO"},
+    {DT_TZMAP_OLSEN_NAME, "America/Kralendijk"},
+    {DT_TZMAP_ABBREVIATION, "BQ"},
+    {DT_TZMAP_OLSEN_NAME, "America/Manaus"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Boa_Vista"},
+    {DT_TZMAP_OLSEN_NAME, "America/Eirunepe"},
+    {DT_TZMAP_OLSEN_NAME, "America/Porto_Velho"},
+    {DT_TZMAP_OLSEN_NAME, "America/Rio_Branco"},
+    {DT_TZMAP_OLSEN_NAME, "America/Blanc-Sablon"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_OLSEN_NAME, "America/Curacao"},
+    {DT_TZMAP_ABBREVIATION, "CW"},
+    {DT_TZMAP_OLSEN_NAME, "America/Dominica"},
+    {DT_TZMAP_ABBREVIATION, "DM"},
+    {DT_TZMAP_OLSEN_NAME, "America/Santo_Domingo"},
+    {DT_TZMAP_ABBREVIATION, "DO"},
+    {DT_TZMAP_OLSEN_NAME, "America/Grenada"},
+    {DT_TZMAP_ABBREVIATION, "GD"},
+    {DT_TZMAP_OLSEN_NAME, "America/Guadeloupe"},
+    {DT_TZMAP_ABBREVIATION, "GP"},
+    {DT_TZMAP_OLSEN_NAME, "America/Guyana"},
+    {DT_TZMAP_ABBREVIATION, "GY"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Kitts"},
+    {DT_TZMAP_ABBREVIATION, "KN"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Lucia"},
+    {DT_TZMAP_ABBREVIATION, "LC"},
+    {DT_TZMAP_OLSEN_NAME, "America/Marigot"},
+    {DT_TZMAP_ABBREVIATION, "MF"},
+    {DT_TZMAP_OLSEN_NAME, "America/Martinique"},
+    {DT_TZMAP_ABBREVIATION, "MQ"},
+    {DT_TZMAP_OLSEN_NAME, "America/Montserrat"},
+    {DT_TZMAP_ABBREVIATION, "MS"},
+    {DT_TZMAP_OLSEN_NAME, "America/Puerto_Rico"},
+    {DT_TZMAP_ABBREVIATION, "PR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Lower_Princes"},
+    {DT_TZMAP_ABBREVIATION, "SX"},
+    {DT_TZMAP_OLSEN_NAME, "America/Port_of_Spain"},
+    {DT_TZMAP_ABBREVIATION, "TT"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Vincent"},
+    {DT_TZMAP_ABBREVIATION, "VC"},
+    {DT_TZMAP_OLSEN_NAME, "America/Tortola"},
+    {DT_TZMAP_ABBREVIATION, "VG"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Thomas"},
+    {DT_TZMAP_ABBREVIATION, "VI"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+4"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Pacific SA Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Santiago"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Palmer"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_ABBREVIATION, "CL"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Newfoundland Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/St_Johns"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "CA"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "E. South America Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Sao_Paulo"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Araguaina"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Argentina Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Buenos_Aires"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/La_Rioja"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/Rio_Gallegos"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/Salta"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/San_Juan"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/San_Luis"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/Tucuman"},
+    {DT_TZMAP_OLSEN_NAME, "America/Argentina/Ushuaia"},
+    {DT_TZMAP_OLSEN_NAME, "America/Catamarca"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cordoba"},
+    {DT_TZMAP_OLSEN_NAME, "America/Jujuy"},
+    {DT_TZMAP_OLSEN_NAME, "America/Mendoza"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "SA Eastern Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Cayenne"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Rothera"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "America/Fortaleza"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_OLSEN_NAME, "America/Belem"},
+    {DT_TZMAP_OLSEN_NAME, "America/Maceio"},
+    {DT_TZMAP_OLSEN_NAME, "America/Recife"},
+    {DT_TZMAP_OLSEN_NAME, "America/Santarem"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Stanley"},
+    {DT_TZMAP_ABBREVIATION, "FK"},
+    {DT_TZMAP_ABBREVIATION, "GF"},
+    {DT_TZMAP_OLSEN_NAME, "America/Paramaribo"},
+    {DT_TZMAP_ABBREVIATION, "SR"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+3"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Greenland Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Godthab"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "GL"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Montevideo Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Montevideo"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "UY"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Bahia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "America/Bahia"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "UTC-02"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+2"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Noronha"},
+    {DT_TZMAP_ABBREVIATION, "BR"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/South_Georgia"},
+    {DT_TZMAP_ABBREVIATION, "GS"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Azores Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Azores"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "America/Scoresbysund"},
+    {DT_TZMAP_ABBREVIATION, "GL"},
+    {DT_TZMAP_ABBREVIATION, "PT"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Cape Verde Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Cape_Verde"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "CV"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT+1"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Morocco Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Casablanca"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MA"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "UTC"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/UTC"},
+    {DT_TZMAP_OLSEN_NAME, "America/Danmarkshavn"},
+    {DT_TZMAP_ABBREVIATION, "GL"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "GMT Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/London"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Canary"},
+    {DT_TZMAP_ABBREVIATION, "ES"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Faeroe"},
+    {DT_TZMAP_ABBREVIATION, "FO"},
+    {DT_TZMAP_ABBREVIATION, "GB"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Guernsey"},
+    {DT_TZMAP_ABBREVIATION, "GG"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Dublin"},
+    {DT_TZMAP_ABBREVIATION, "IE"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Isle_of_Man"},
+    {DT_TZMAP_ABBREVIATION, "IM"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Jersey"},
+    {DT_TZMAP_ABBREVIATION, "JE"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Lisbon"},
+    {DT_TZMAP_ABBREVIATION, "PT"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Madeira"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Greenwich Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/Reykjavik"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Ouagadougou"},
+    {DT_TZMAP_ABBREVIATION, "BF"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Abidjan"},
+    {DT_TZMAP_ABBREVIATION, "CI"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/El_Aaiun"},
+    {DT_TZMAP_ABBREVIATION, "EH"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Accra"},
+    {DT_TZMAP_ABBREVIATION, "GH"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Banjul"},
+    {DT_TZMAP_ABBREVIATION, "GM"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Conakry"},
+    {DT_TZMAP_ABBREVIATION, "GN"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Bissau"},
+    {DT_TZMAP_ABBREVIATION, "GW"},
+    {DT_TZMAP_ABBREVIATION, "IS"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Monrovia"},
+    {DT_TZMAP_ABBREVIATION, "LR"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Bamako"},
+    {DT_TZMAP_ABBREVIATION, "ML"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Nouakchott"},
+    {DT_TZMAP_ABBREVIATION, "MR"},
+    {DT_TZMAP_OLSEN_NAME, "Atlantic/St_Helena"},
+    {DT_TZMAP_ABBREVIATION, "SH"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Freetown"},
+    {DT_TZMAP_ABBREVIATION, "SL"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Dakar"},
+    {DT_TZMAP_ABBREVIATION, "SN"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Sao_Tome"},
+    {DT_TZMAP_ABBREVIATION, "ST"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Lome"},
+    {DT_TZMAP_ABBREVIATION, "TG"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "W. Europe Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Berlin"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Andorra"},
+    {DT_TZMAP_ABBREVIATION, "AD"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Vienna"},
+    {DT_TZMAP_ABBREVIATION, "AT"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Zurich"},
+    {DT_TZMAP_ABBREVIATION, "CH"},
+    {DT_TZMAP_ABBREVIATION, "DE"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Busingen"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Gibraltar"},
+    {DT_TZMAP_ABBREVIATION, "GI"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Rome"},
+    {DT_TZMAP_ABBREVIATION, "IT"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Vaduz"},
+    {DT_TZMAP_ABBREVIATION, "LI"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Luxembourg"},
+    {DT_TZMAP_ABBREVIATION, "LU"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Tripoli"},
+    {DT_TZMAP_ABBREVIATION, "LY"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Monaco"},
+    {DT_TZMAP_ABBREVIATION, "MC"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Malta"},
+    {DT_TZMAP_ABBREVIATION, "MT"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Amsterdam"},
+    {DT_TZMAP_ABBREVIATION, "NL"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Oslo"},
+    {DT_TZMAP_ABBREVIATION, "NO"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Stockholm"},
+    {DT_TZMAP_ABBREVIATION, "SE"},
+    {DT_TZMAP_OLSEN_NAME, "Arctic/Longyearbyen"},
+    {DT_TZMAP_ABBREVIATION, "SJ"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/San_Marino"},
+    {DT_TZMAP_ABBREVIATION, "SM"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Vatican"},
+    {DT_TZMAP_ABBREVIATION, "VA"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Europe Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Budapest"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Tirane"},
+    {DT_TZMAP_ABBREVIATION, "AL"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Prague"},
+    {DT_TZMAP_ABBREVIATION, "CZ"},
+    {DT_TZMAP_ABBREVIATION, "HU"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Podgorica"},
+    {DT_TZMAP_ABBREVIATION, "ME"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Belgrade"},
+    {DT_TZMAP_ABBREVIATION, "RS"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Ljubljana"},
+    {DT_TZMAP_ABBREVIATION, "SI"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Bratislava"},
+    {DT_TZMAP_ABBREVIATION, "SK"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Romance Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Paris"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Brussels"},
+    {DT_TZMAP_ABBREVIATION, "BE"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Copenhagen"},
+    {DT_TZMAP_ABBREVIATION, "DK"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Madrid"},
+    {DT_TZMAP_ABBREVIATION, "ES"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Ceuta"},
+    {DT_TZMAP_ABBREVIATION, "FR"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central European Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Warsaw"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Sarajevo"},
+    {DT_TZMAP_ABBREVIATION, "BA"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Zagreb"},
+    {DT_TZMAP_ABBREVIATION, "HR"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Skopje"},
+    {DT_TZMAP_ABBREVIATION, "MK"},
+    {DT_TZMAP_ABBREVIATION, "PL"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "W. Central Africa Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Lagos"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Luanda"},
+    {DT_TZMAP_ABBREVIATION, "AO"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Porto-Novo"},
+    {DT_TZMAP_ABBREVIATION, "BJ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Kinshasa"},
+    {DT_TZMAP_ABBREVIATION, "CD"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Bangui"},
+    {DT_TZMAP_ABBREVIATION, "CF"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Brazzaville"},
+    {DT_TZMAP_ABBREVIATION, "CG"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Douala"},
+    {DT_TZMAP_ABBREVIATION, "CM"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Algiers"},
+    {DT_TZMAP_ABBREVIATION, "DZ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Libreville"},
+    {DT_TZMAP_ABBREVIATION, "GA"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Malabo"},
+    {DT_TZMAP_ABBREVIATION, "GQ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Niamey"},
+    {DT_TZMAP_ABBREVIATION, "NE"},
+    {DT_TZMAP_ABBREVIATION, "NG"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Ndjamena"},
+    {DT_TZMAP_ABBREVIATION, "TD"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Tunis"},
+    {DT_TZMAP_ABBREVIATION, "TN"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-1"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Namibia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Windhoek"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "NA"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "GTB Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Bucharest"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Athens"},
+    {DT_TZMAP_ABBREVIATION, "GR"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Chisinau"},
+    {DT_TZMAP_ABBREVIATION, "MD"},
+    {DT_TZMAP_ABBREVIATION, "RO"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Middle East Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Beirut"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "LB"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Egypt Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Cairo"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "EG"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Gaza"},
+    {DT_TZMAP_ABBREVIATION, "PS"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Hebron"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Syria Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Damascus"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "SY"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "E. Europe Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Nicosia"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "CY"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "South Africa Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Johannesburg"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Bujumbura"},
+    {DT_TZMAP_ABBREVIATION, "BI"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Gaborone"},
+    {DT_TZMAP_ABBREVIATION, "BW"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Lubumbashi"},
+    {DT_TZMAP_ABBREVIATION, "CD"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Maseru"},
+    {DT_TZMAP_ABBREVIATION, "LS"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Blantyre"},
+    {DT_TZMAP_ABBREVIATION, "MW"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Maputo"},
+    {DT_TZMAP_ABBREVIATION, "MZ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Kigali"},
+    {DT_TZMAP_ABBREVIATION, "RW"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Mbabane"},
+    {DT_TZMAP_ABBREVIATION, "SZ"},
+    {DT_TZMAP_ABBREVIATION, "ZA"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Lusaka"},
+    {DT_TZMAP_ABBREVIATION, "ZM"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Harare"},
+    {DT_TZMAP_ABBREVIATION, "ZW"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-2"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "FLE Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Kiev"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Mariehamn"},
+    {DT_TZMAP_ABBREVIATION, "AX"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Sofia"},
+    {DT_TZMAP_ABBREVIATION, "BG"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Tallinn"},
+    {DT_TZMAP_ABBREVIATION, "EE"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Helsinki"},
+    {DT_TZMAP_ABBREVIATION, "FI"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Vilnius"},
+    {DT_TZMAP_ABBREVIATION, "LT"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Riga"},
+    {DT_TZMAP_ABBREVIATION, "LV"},
+    {DT_TZMAP_ABBREVIATION, "UA"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Simferopol"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Uzhgorod"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Zaporozhye"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Turkey Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Istanbul"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "TR"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Israel Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Jerusalem"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "IL"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Jordan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Amman"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "JO"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Arabic Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Baghdad"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "IQ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Kaliningrad Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Kaliningrad"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Minsk"},
+    {DT_TZMAP_ABBREVIATION, "BY"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Arab Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Riyadh"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Bahrain"},
+    {DT_TZMAP_ABBREVIATION, "BH"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kuwait"},
+    {DT_TZMAP_ABBREVIATION, "KW"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Qatar"},
+    {DT_TZMAP_ABBREVIATION, "QA"},
+    {DT_TZMAP_ABBREVIATION, "SA"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Aden"},
+    {DT_TZMAP_ABBREVIATION, "YE"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "E. Africa Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Nairobi"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Syowa"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Djibouti"},
+    {DT_TZMAP_ABBREVIATION, "DJ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Asmera"},
+    {DT_TZMAP_ABBREVIATION, "ER"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Addis_Ababa"},
+    {DT_TZMAP_ABBREVIATION, "ET"},
+    {DT_TZMAP_ABBREVIATION, "KE"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Comoro"},
+    {DT_TZMAP_ABBREVIATION, "KM"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Antananarivo"},
+    {DT_TZMAP_ABBREVIATION, "MG"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Khartoum"},
+    {DT_TZMAP_ABBREVIATION, "SD"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Mogadishu"},
+    {DT_TZMAP_ABBREVIATION, "SO"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Juba"},
+    {DT_TZMAP_ABBREVIATION, "SS"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Dar_es_Salaam"},
+    {DT_TZMAP_ABBREVIATION, "TZ"},
+    {DT_TZMAP_OLSEN_NAME, "Africa/Kampala"},
+    {DT_TZMAP_ABBREVIATION, "UG"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Mayotte"},
+    {DT_TZMAP_ABBREVIATION, "YT"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-3"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Iran Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Tehran"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "IR"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Arabian Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Dubai"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AE"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Muscat"},
+    {DT_TZMAP_ABBREVIATION, "OM"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-4"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Azerbaijan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Baku"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Russian Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Moscow"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Samara"},
+    {DT_TZMAP_OLSEN_NAME, "Europe/Volgograd"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Mauritius Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Mauritius"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MU"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Reunion"},
+    {DT_TZMAP_ABBREVIATION, "RE"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Mahe"},
+    {DT_TZMAP_ABBREVIATION, "SC"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Georgian Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Tbilisi"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "GE"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Caucasus Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Yerevan"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AM"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Afghanistan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kabul"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AF"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Pakistan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Karachi"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "PK"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "West Asia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Tashkent"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Mawson"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Oral"},
+    {DT_TZMAP_ABBREVIATION, "KZ"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Aqtau"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Aqtobe"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Maldives"},
+    {DT_TZMAP_ABBREVIATION, "MV"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Kerguelen"},
+    {DT_TZMAP_ABBREVIATION, "TF"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Dushanbe"},
+    {DT_TZMAP_ABBREVIATION, "TJ"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Ashgabat"},
+    {DT_TZMAP_ABBREVIATION, "TM"},
+    {DT_TZMAP_ABBREVIATION, "UZ"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Samarkand"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-5"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "India Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Calcutta"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "IN"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Sri Lanka Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Colombo"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "LK"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Nepal Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Katmandu"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "NP"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Asia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Almaty"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Vostok"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Chagos"},
+    {DT_TZMAP_ABBREVIATION, "IO"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Bishkek"},
+    {DT_TZMAP_ABBREVIATION, "KG"},
+    {DT_TZMAP_ABBREVIATION, "KZ"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Qyzylorda"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-6"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Bangladesh Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Dhaka"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "BD"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Thimphu"},
+    {DT_TZMAP_ABBREVIATION, "BT"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Ekaterinburg Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Yekaterinburg"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Myanmar Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Rangoon"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Cocos"},
+    {DT_TZMAP_ABBREVIATION, "CC"},
+    {DT_TZMAP_ABBREVIATION, "MM"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "SE Asia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Bangkok"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Davis"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Indian/Christmas"},
+    {DT_TZMAP_ABBREVIATION, "CX"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Jakarta"},
+    {DT_TZMAP_ABBREVIATION, "ID"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Pontianak"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Phnom_Penh"},
+    {DT_TZMAP_ABBREVIATION, "KH"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Vientiane"},
+    {DT_TZMAP_ABBREVIATION, "LA"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Hovd"},
+    {DT_TZMAP_ABBREVIATION, "MN"},
+    {DT_TZMAP_ABBREVIATION, "TH"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Saigon"},
+    {DT_TZMAP_ABBREVIATION, "VN"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-7"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "N. Central Asia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Novosibirsk"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Novokuznetsk"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Omsk"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "China Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Shanghai"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "CN"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Chongqing"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Harbin"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kashgar"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Urumqi"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Hong_Kong"},
+    {DT_TZMAP_ABBREVIATION, "HK"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Macau"},
+    {DT_TZMAP_ABBREVIATION, "MO"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "North Asia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Krasnoyarsk"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Singapore Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Singapore"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Brunei"},
+    {DT_TZMAP_ABBREVIATION, "BN"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Makassar"},
+    {DT_TZMAP_ABBREVIATION, "ID"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kuala_Lumpur"},
+    {DT_TZMAP_ABBREVIATION, "MY"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kuching"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Manila"},
+    {DT_TZMAP_ABBREVIATION, "PH"},
+    {DT_TZMAP_ABBREVIATION, "SG"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-8"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "W. Australia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Perth"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Casey"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Taipei Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Taipei"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "TW"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Ulaanbaatar Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Ulaanbaatar"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "MN"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Choibalsan"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "North Asia East Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Irkutsk"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Tokyo Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Tokyo"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Jayapura"},
+    {DT_TZMAP_ABBREVIATION, "ID"},
+    {DT_TZMAP_ABBREVIATION, "JP"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Palau"},
+    {DT_TZMAP_ABBREVIATION, "PW"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Dili"},
+    {DT_TZMAP_ABBREVIATION, "TL"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-9"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Korea Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Seoul"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Pyongyang"},
+    {DT_TZMAP_ABBREVIATION, "KP"},
+    {DT_TZMAP_ABBREVIATION, "KR"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Cen. Australia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Adelaide"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Broken_Hill"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "AUS Central Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Darwin"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "E. Australia Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Brisbane"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Lindeman"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "AUS Eastern Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Sydney"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Melbourne"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "West Pacific Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Port_Moresby"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/DumontDUrville"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Truk"},
+    {DT_TZMAP_ABBREVIATION, "FM"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Guam"},
+    {DT_TZMAP_ABBREVIATION, "GU"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Saipan"},
+    {DT_TZMAP_ABBREVIATION, "MP"},
+    {DT_TZMAP_ABBREVIATION, "PG"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-10"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Tasmania Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Hobart"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "AU"},
+    {DT_TZMAP_OLSEN_NAME, "Australia/Currie"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Yakutsk Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Yakutsk"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Khandyga"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Central Pacific Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Guadalcanal"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/Macquarie"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Ponape"},
+    {DT_TZMAP_ABBREVIATION, "FM"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Kosrae"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Noumea"},
+    {DT_TZMAP_ABBREVIATION, "NC"},
+    {DT_TZMAP_ABBREVIATION, "SB"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Efate"},
+    {DT_TZMAP_ABBREVIATION, "VU"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-11"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Vladivostok Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Vladivostok"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Sakhalin"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Ust-Nera"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "New Zealand Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Auckland"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/South_Pole"},
+    {DT_TZMAP_ABBREVIATION, "AQ"},
+    {DT_TZMAP_OLSEN_NAME, "Antarctica/McMurdo"},
+    {DT_TZMAP_ABBREVIATION, "NZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "UTC+12"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-12"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Tarawa"},
+    {DT_TZMAP_ABBREVIATION, "KI"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Majuro"},
+    {DT_TZMAP_ABBREVIATION, "MH"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Kwajalein"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Nauru"},
+    {DT_TZMAP_ABBREVIATION, "NR"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Funafuti"},
+    {DT_TZMAP_ABBREVIATION, "TV"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Wake"},
+    {DT_TZMAP_ABBREVIATION, "UM"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Wallis"},
+    {DT_TZMAP_ABBREVIATION, "WF"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Fiji Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Fiji"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "FJ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Magadan Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Magadan"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "RU"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Anadyr"},
+    {DT_TZMAP_OLSEN_NAME, "Asia/Kamchatka"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Tonga Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Tongatapu"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Enderbury"},
+    {DT_TZMAP_ABBREVIATION, "KI"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Fakaofo"},
+    {DT_TZMAP_ABBREVIATION, "TK"},
+    {DT_TZMAP_ABBREVIATION, "TO"},
+    {DT_TZMAP_OLSEN_NAME, "Etc/GMT-13"},
+    {DT_TZMAP_ABBREVIATION, "ZZ"},
+    {DT_TZMAP_WIN_STANDARD_TIME, "Samoa Standard Time"},
+    {DT_TZMAP_OLSEN_NAME, "Pacific/Apia"},
+    {DT_TZMAP_ABBREVIATION, "001"},
+    {DT_TZMAP_ABBREVIATION, "WS"},
+};
+
+static const struct tz_aliases tz_alias_keys[] = {
+    {"Samoa Standard Time", tz_alias_table + 963, tz_alias_table + 967, {tz_alias_table + 963, tz_alias_table + 964}},
+    {"Pacific/Efate", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 909}},
+    {"Africa/Algiers", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 497}},
+    {"Atlantic/South_Georgia", tz_alias_table + 324, tz_alias_table + 332, {tz_alias_table + 324, tz_alias_table + 329}},
+    {"Africa/Tunis", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 508}},
+    {"SA Eastern Standard Time", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 295}},
+    {"Etc/GMT-11", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 911}},
+    {"Singapore Standard Time", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 804}},
+    {"Europe/Vatican", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 443}},
+    {"Indian/Cocos", tz_alias_table + 754, tz_alias_table + 760, {tz_alias_table + 754, tz_alias_table + 757}},
+    {"America/Maceio", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 302}},
+    {"Antarctica/Casey", tz_alias_table + 818, tz_alias_table + 824, {tz_alias_table + 818, tz_alias_table + 821}},
+    {"Africa/Freetown", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 400}},
+    {"Etc/GMT+4", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 262}},
+    {"America/Yakutat", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 33}},
+    {"Indian/Maldives", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 707}},
+    {"America/St_Lucia", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 242}},
+    {"America/Tegucigalpa", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 91}},
+    {"Asia/Khandyga", tz_alias_table + 893, tz_alias_table + 898, {tz_alias_table + 893, tz_alias_table + 897}},
+    {"Australia/Hobart", tz_alias_table + 888, tz_alias_table + 893, {tz_alias_table + 888, tz_alias_table + 889}},
+    {"Europe/Stockholm", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 437}},
+    {"America/Indianapolis", tz_alias_table + 174, tz_alias_table + 180, {tz_alias_table + 174, tz_alias_table + 175}},
+    {"America/Anguilla", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 209}},
+    {"Africa/Lusaka", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 563}},
+    {"Pacific/Truk", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 879}},
+    {"Europe/Gibraltar", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 419}},
+    {"America/Guadeloupe", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 236}},
+    {"W. Europe Standard Time", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 409}},
+    {"Pacific/Tahiti", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 19}},
+    {"GMT Standard Time", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 356}},
+    {"America/Chicago", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 100}},
+    {"America/Montreal", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 159}},
+    {"Mountain Standard Time", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 67}},
+    {"Antarctica/DumontDUrville", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 877}},
+    {"Asia/Bahrain", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 613}},
+    {"Montevideo Standard Time", tz_alias_table + 316, tz_alias_table + 320, {tz_alias_table + 316, tz_alias_table + 317}},
+    {"America/Creston", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 55}},
+    {"Australia/Currie", tz_alias_table + 888, tz_alias_table + 893, {tz_alias_table + 888, tz_alias_table + 892}},
+    {"Canada Central Standard Time", tz_alias_table + 126, tz_alias_table + 131, {tz_alias_table + 126, tz_alias_table + 127}},
+    {"America/Montserrat", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 248}},
+    {"Etc/GMT-13", tz_alias_table + 953, tz_alias_table + 963, {tz_alias_table + 953, tz_alias_table + 961}},
+    {"Europe/Brussels", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 464}},
+    {"Asia/Krasnoyarsk", tz_alias_table + 799, tz_alias_table + 803, {tz_alias_table + 799, tz_alias_table + 800}},
+    {"America/Argentina/San_Luis", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 287}},
+    {"America/Buenos_Aires", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 280}},
+    {"Asia/Taipei", tz_alias_table + 824, tz_alias_table + 828, {tz_alias_table + 824, tz_alias_table + 825}},
+    {"Pacific SA Standard Time", tz_alias_table + 264, tz_alias_table + 270, {tz_alias_table + 264, tz_alias_table + 265}},
+    {"America/St_Johns", tz_alias_table + 270, tz_alias_table + 274, {tz_alias_table + 270, tz_alias_table + 271}},
+    {"Cape Verde Standard Time", tz_alias_table + 338, tz_alias_table + 344, {tz_alias_table + 338, tz_alias_table + 339}},
+    {"Europe/Belgrade", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 455}},
+    {"Africa/Maseru", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 552}},
+    {"Pacific/Apia", tz_alias_table + 963, tz_alias_table + 967, {tz_alias_table + 963, tz_alias_table + 964}},
+    {"Newfoundland Standard Time", tz_alias_table + 270, tz_alias_table + 274, {tz_alias_table + 270, tz_alias_table + 271}},
+    {"America/Tijuana", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 45}},
+    {"Arabic Standard Time", tz_alias_table + 600, tz_alias_table + 604, {tz_alias_table + 600, tz_alias_table + 601}},
+    {"America/Thunder_Bay", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 162}},
+    {"Bangladesh Standard Time", tz_alias_table + 744, tz_alias_table + 750, {tz_alias_table + 744, tz_alias_table + 745}},
+    {"America/Thule", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 197}},
+    {"Etc/GMT+1", tz_alias_table + 338, tz_alias_table + 344, {tz_alias_table + 338, tz_alias_table + 342}},
+    {"America/Indiana/Tell_City", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 111}},
+    {"Europe/Isle_of_Man", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 367}},
+    {"Etc/GMT+3", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 310}},
+    {"Etc/GMT+7", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 59}},
+    {"Etc/GMT+10", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 24}},
+    {"Indian/Mayotte", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 648}},
+    {"Etc/GMT+12", tz_alias_table + 0, tz_alias_table + 4, {tz_alias_table + 0, tz_alias_table + 1}},
+    {"America/Yellowknife", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 73}},
+    {"America/Curacao", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 228}},
+    {"America/Lower_Princes", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 252}},
+    {"America/Indiana/Vincennes", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 168}},
+    {"Africa/Asmera", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 629}},
+    {"America/Goose_Bay", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 195}},
+    {"Etc/GMT-8", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 816}},
+    {"Africa/Gaborone", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 548}},
+    {"Etc/GMT-6", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 742}},
+    {"America/Louisville", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 171}},
+    {"America/Argentina/La_Rioja", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 283}},
+    {"Etc/GMT-3", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 650}},
+    {"Asia/Rangoon", tz_alias_table + 754, tz_alias_table + 760, {tz_alias_table + 754, tz_alias_table + 755}},
+    {"Asia/Kashgar", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 793}},
+    {"EST5EDT", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 172}},
+    {"Atlantic/Cape_Verde", tz_alias_table + 338, tz_alias_table + 344, {tz_alias_table + 338, tz_alias_table + 339}},
+    {"E. Australia Standard Time", tz_alias_table + 864, tz_alias_table + 869, {tz_alias_table + 864, tz_alias_table + 865}},
+    {"Asia/Choibalsan", tz_alias_table + 828, tz_alias_table + 833, {tz_alias_table + 828, tz_alias_table + 832}},
+    {"Asia/Urumqi", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 794}},
+    {"Pacific/Kosrae", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 905}},
+    {"America/Mendoza", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 293}},
+    {"Indian/Kerguelen", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 709}},
+    {"Asia/Damascus", tz_alias_table + 535, tz_alias_table + 539, {tz_alias_table + 535, tz_alias_table + 536}},
+    {"Asia/Jayapura", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 840}},
+    {"Indian/Chagos", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 736}},
+    {"Africa/Juba", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 642}},
+    {"Atlantic/Bermuda", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 191}},
+    {"Asia/Tehran", tz_alias_table + 652, tz_alias_table + 656, {tz_alias_table + 652, tz_alias_table + 653}},
+    {"Asia/Tashkent", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 699}},
+    {"Europe/Uzhgorod", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 586}},
+    {"Atlantic/Azores", tz_alias_table + 332, tz_alias_table + 338, {tz_alias_table + 332, tz_alias_table + 333}},
+    {"America/Grand_Turk", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 163}},
+    {"Europe/Zagreb", tz_alias_table + 472, tz_alias_table + 482, {tz_alias_table + 472, tz_alias_table + 477}},
+    {"Europe/Paris", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 462}},
+    {"Asia/Makassar", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 808}},
+    {"Europe/Copenhagen", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 466}},
+    {"Australia/Adelaide", tz_alias_table + 855, tz_alias_table + 860, {tz_alias_table + 855, tz_alias_table + 856}},
+    {"America/Lima", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 147}},
+    {"America/Montevideo", tz_alias_table + 316, tz_alias_table + 320, {tz_alias_table + 316, tz_alias_table + 317}},
+    {"Asia/Chongqing", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 791}},
+    {"Europe/Kiev", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 570}},
+    {"Asia/Aqtobe", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 706}},
+    {"America/Martinique", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 246}},
+    {"Europe/Lisbon", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 371}},
+    {"Asia/Vladivostok", tz_alias_table + 913, tz_alias_table + 919, {tz_alias_table + 913, tz_alias_table + 914}},
+    {"Europe/Madrid", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 468}},
+    {"Africa/Lubumbashi", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 550}},
+    {"Europe/Busingen", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 418}},
+    {"Etc/GMT+6", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 97}},
+    {"Etc/GMT+5", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 149}},
+    {"Arctic/Longyearbyen", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 439}},
+    {"America/Bahia_Banderas", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 122}},
+    {"America/New_York", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 152}},
+    {"Europe/Jersey", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 369}},
+    {"E. Africa Standard Time", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 623}},
+    {"Asia/Yekaterinburg", tz_alias_table + 750, tz_alias_table + 754, {tz_alias_table + 750, tz_alias_table + 751}},
+    {"America/Port-au-Prince", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 139}},
+    {"Dateline Standard Time", tz_alias_table + 0, tz_alias_table + 4, {tz_alias_table + 0, tz_alias_table + 1}},
+    {"Asia/Thimphu", tz_alias_table + 744, tz_alias_table + 750, {tz_alias_table + 744, tz_alias_table + 748}},
+    {"America/Bahia", tz_alias_table + 320, tz_alias_table + 324, {tz_alias_table + 320, tz_alias_table + 321}},
+    {"Europe/Helsinki", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 578}},
+    {"Asia/Phnom_Penh", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 770}},
+    {"GTB Standard Time", tz_alias_table + 516, tz_alias_table + 524, {tz_alias_table + 516, tz_alias_table + 517}},
+    {"America/Argentina/Salta", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 285}},
+    {"America/Asuncion", tz_alias_table + 184, tz_alias_table + 188, {tz_alias_table + 184, tz_alias_table + 185}},
+    {"America/Belize", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 84}},
+    {"Asia/Baghdad", tz_alias_table + 600, tz_alias_table + 604, {tz_alias_table + 600, tz_alias_table + 601}},
+    {"Asia/Almaty", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 732}},
+    {"Africa/Accra", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 383}},
+    {"Asia/Irkutsk", tz_alias_table + 833, tz_alias_table + 837, {tz_alias_table + 833, tz_alias_table + 834}},
+    {"America/Nome", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 31}},
+    {"Asia/Magadan", tz_alias_table + 947, tz_alias_table + 953, {tz_alias_table + 947, tz_alias_table + 948}},
+    {"America/Boa_Vista", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 222}},
+    {"Georgian Standard Time", tz_alias_table + 682, tz_alias_table + 686, {tz_alias_table + 682, tz_alias_table + 683}},
+    {"Asia/Dhaka", tz_alias_table + 744, tz_alias_table + 750, {tz_alias_table + 744, tz_alias_table + 745}},
+    {"Greenwich Standard Time", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 375}},
+    {"America/Costa_Rica", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 86}},
+    {"Iran Standard Time", tz_alias_table + 652, tz_alias_table + 656, {tz_alias_table + 652, tz_alias_table + 653}},
+    {"Africa/Nairobi", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 623}},
+    {"Asia/Sakhalin", tz_alias_table + 913, tz_alias_table + 919, {tz_alias_table + 913, tz_alias_table + 917}},
+    {"America/Mexico_City", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 119}},
+    {"Syria Standard Time", tz_alias_table + 535, tz_alias_table + 539, {tz_alias_table + 535, tz_alias_table + 536}},
+    {"Pacific/Saipan", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 883}},
+    {"Tasmania Standard Time", tz_alias_table + 888, tz_alias_table + 893, {tz_alias_table + 888, tz_alias_table + 889}},
+    {"America/Detroit", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 166}},
+    {"America/Indiana/Vevay", tz_alias_table + 174, tz_alias_table + 180, {tz_alias_table + 174, tz_alias_table + 179}},
+    {"America/Resolute", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 106}},
+    {"Caucasus Standard Time", tz_alias_table + 686, tz_alias_table + 690, {tz_alias_table + 686, tz_alias_table + 687}},
+    {"Pacific/Port_Moresby", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 875}},
+    {"America/Godthab", tz_alias_table + 312, tz_alias_table + 316, {tz_alias_table + 312, tz_alias_table + 313}},
+    {"Pacific/Tongatapu", tz_alias_table + 953, tz_alias_table + 963, {tz_alias_table + 953, tz_alias_table + 954}},
+    {"Afghanistan Standard Time", tz_alias_table + 690, tz_alias_table + 694, {tz_alias_table + 690, tz_alias_table + 691}},
+    {"Africa/Bamako", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 394}},
+    {"Indian/Christmas", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 765}},
+    {"Europe/Zaporozhye", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 587}},
+    {"Europe/Mariehamn", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 572}},
+    {"Asia/Jakarta", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 767}},
+    {"Europe/Rome", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 421}},
+    {"India Standard Time", tz_alias_table + 719, tz_alias_table + 723, {tz_alias_table + 719, tz_alias_table + 720}},
+    {"Ekaterinburg Standard Time", tz_alias_table + 750, tz_alias_table + 754, {tz_alias_table + 750, tz_alias_table + 751}},
+    {"America/Blanc-Sablon", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 226}},
+    {"North Asia Standard Time", tz_alias_table + 799, tz_alias_table + 803, {tz_alias_table + 799, tz_alias_table + 800}},
+    {"Antarctica/South_Pole", tz_alias_table + 919, tz_alias_table + 926, {tz_alias_table + 919, tz_alias_table + 922}},
+    {"Asia/Qyzylorda", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 741}},
+    {"Asia/Gaza", tz_alias_table + 528, tz_alias_table + 535, {tz_alias_table + 528, tz_alias_table + 532}},
+    {"America/Mazatlan", tz_alias_table + 61, tz_alias_table + 66, {tz_alias_table + 61, tz_alias_table + 65}},
+    {"Mountain Standard Time (Mexico)", tz_alias_table + 61, tz_alias_table + 66, {tz_alias_table + 61, tz_alias_table + 62}},
+    {"America/Marigot", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 244}},
+    {"America/Cordoba", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 291}},
+    {"America/Tortola", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 258}},
+    {"Europe/Sofia", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 574}},
+    {"Africa/Niamey", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 503}},
+    {"US Mountain Standard Time", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 51}},
+    {"Africa/Lagos", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 483}},
+    {"America/Cambridge_Bay", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 71}},
+    {"Africa/Malabo", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 501}},
+    {"Asia/Harbin", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 792}},
+    {"America/Recife", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 303}},
+    {"Europe/Skopje", tz_alias_table + 472, tz_alias_table + 482, {tz_alias_table + 472, tz_alias_table + 479}},
+    {"Europe/Samara", tz_alias_table + 668, tz_alias_table + 674, {tz_alias_table + 668, tz_alias_table + 672}},
+    {"Asia/Seoul", tz_alias_table + 849, tz_alias_table + 855, {tz_alias_table + 849, tz_alias_table + 850}},
+    {"America/Los_Angeles", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 39}},
+    {"Atlantic Standard Time", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 189}},
+    {"Sri Lanka Standard Time", tz_alias_table + 723, tz_alias_table + 727, {tz_alias_table + 723, tz_alias_table + 724}},
+    {"Vladivostok Standard Time", tz_alias_table + 913, tz_alias_table + 919, {tz_alias_table + 913, tz_alias_table + 914}},
+    {"Venezuela Standard Time", tz_alias_table + 180, tz_alias_table + 184, {tz_alias_table + 180, tz_alias_table + 181}},
+    {"America/Matamoros", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 107}},
+    {"America/Regina", tz_alias_table + 126, tz_alias_table + 131, {tz_alias_table + 126, tz_alias_table + 127}},
+    {"America/North_Dakota/Center", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 114}},
+    {"Central Standard Time", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 100}},
+    {"Europe/Podgorica", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 453}},
+    {"America/St_Vincent", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 256}},
+    {"Arab Standard Time", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 611}},
+    {"FLE Standard Time", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 570}},
+    {"Africa/Conakry", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 387}},
+    {"America/Glace_Bay", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 194}},
+    {"Africa/Kinshasa", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 489}},
+    {"Asia/Hovd", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 774}},
+    {"Indian/Reunion", tz_alias_table + 674, tz_alias_table + 682, {tz_alias_table + 674, tz_alias_table + 678}},
+    {"Paraguay Standard Time", tz_alias_table + 184, tz_alias_table + 188, {tz_alias_table + 184, tz_alias_table + 185}},
+    {"Antarctica/Rothera", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 297}},
+    {"Africa/Ouagadougou", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 377}},
+    {"Turkey Standard Time", tz_alias_table + 588, tz_alias_table + 592, {tz_alias_table + 588, tz_alias_table + 589}},
+    {"Indian/Mauritius", tz_alias_table + 674, tz_alias_table + 682, {tz_alias_table + 674, tz_alias_table + 675}},
+    {"Europe/Athens", tz_alias_table + 516, tz_alias_table + 524, {tz_alias_table + 516, tz_alias_table + 519}},
+    {"Asia/Singapore", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 804}},
+    {"Asia/Qatar", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 617}},
+    {"America/Belem", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 301}},
+    {"Asia/Aqtau", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 705}},
+    {"Asia/Macau", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 797}},
+    {"America/Cayenne", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 295}},
+    {"America/Dawson", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 43}},
+    {"Hawaiian Standard Time", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 15}},
+    {"Etc/GMT-7", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 779}},
+    {"E. South America Standard Time", tz_alias_table + 274, tz_alias_table + 279, {tz_alias_table + 274, tz_alias_table + 275}},
+    {"Pacific/Wake", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 938}},
+    {"US Eastern Standard Time", tz_alias_table + 174, tz_alias_table + 180, {tz_alias_table + 174, tz_alias_table + 175}},
+    {"Antarctica/McMurdo", tz_alias_table + 919, tz_alias_table + 926, {tz_alias_table + 919, tz_alias_table + 924}},
+    {"Etc/GMT-2", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 567}},
+    {"Middle East Standard Time", tz_alias_table + 524, tz_alias_table + 528, {tz_alias_table + 524, tz_alias_table + 525}},
+    {"Africa/Douala", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 495}},
+    {"America/Indiana/Marengo", tz_alias_table + 174, tz_alias_table + 180, {tz_alias_table + 174, tz_alias_table + 178}},
+    {"Pacific/Nauru", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 934}},
+    {"Europe/Guernsey", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 363}},
+    {"Asia/Dushanbe", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 711}},
+    {"Etc/GMT-1", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 510}},
+    {"Europe/Riga", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 582}},
+    {"Pacific/Tarawa", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 929}},
+    {"Europe/Luxembourg", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 425}},
+    {"America/Guyana", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 238}},
+    {"Pacific/Honolulu", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 15}},
+    {"Asia/Ulaanbaatar", tz_alias_table + 828, tz_alias_table + 833, {tz_alias_table + 828, tz_alias_table + 829}},
+    {"Africa/Lome", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 406}},
+    {"Europe/Sarajevo", tz_alias_table + 472, tz_alias_table + 482, {tz_alias_table + 472, tz_alias_table + 475}},
+    {"America/Pangnirtung", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 161}},
+    {"Argentina Standard Time", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 280}},
+    {"Pacific/Majuro", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 931}},
+    {"America/Rio_Branco", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 225}},
+    {"America/Chihuahua", tz_alias_table + 61, tz_alias_table + 66, {tz_alias_table + 61, tz_alias_table + 62}},
+    {"Australia/Broken_Hill", tz_alias_table + 855, tz_alias_table + 860, {tz_alias_table + 855, tz_alias_table + 859}},
+    {"Europe/Vaduz", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 423}},
+    {"Asia/Tbilisi", tz_alias_table + 682, tz_alias_table + 686, {tz_alias_table + 682, tz_alias_table + 683}},
+    {"Africa/Harare", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 565}},
+    {"Europe/Amsterdam", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 433}},
+    {"Asia/Calcutta", tz_alias_table + 719, tz_alias_table + 723, {tz_alias_table + 719, tz_alias_table + 720}},
+    {"America/Barbados", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 213}},
+    {"Africa/El_Aaiun", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 381}},
+    {"America/North_Dakota/Beulah", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 113}},
+    {"America/Santarem", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 304}},
+    {"Pacific/Johnston", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 21}},
+    {"Africa/Bangui", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 491}},
+    {"America/Indiana/Petersburg", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 167}},
+    {"Asia/Hong_Kong", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 795}},
+    {"Asia/Nicosia", tz_alias_table + 539, tz_alias_table + 543, {tz_alias_table + 539, tz_alias_table + 540}},
+    {"Asia/Dili", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 845}},
+    {"Europe/Moscow", tz_alias_table + 668, tz_alias_table + 674, {tz_alias_table + 668, tz_alias_table + 669}},
+    {"SA Western Standard Time", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 205}},
+    {"Pacific/Fiji", tz_alias_table + 943, tz_alias_table + 947, {tz_alias_table + 943, tz_alias_table + 944}},
+    {"Ulaanbaatar Standard Time", tz_alias_table + 828, tz_alias_table + 833, {tz_alias_table + 828, tz_alias_table + 829}},
+    {"Africa/Bissau", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 389}},
+    {"Asia/Omsk", tz_alias_table + 781, tz_alias_table + 787, {tz_alias_table + 781, tz_alias_table + 786}},
+    {"America/Iqaluit", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 158}},
+    {"America/Cayman", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 143}},
+    {"Africa/Ndjamena", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 506}},
+    {"America/North_Dakota/New_Salem", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 115}},
+    {"Africa/Dakar", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 402}},
+    {"America/Vancouver", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 41}},
+    {"Asia/Ust-Nera", tz_alias_table + 913, tz_alias_table + 919, {tz_alias_table + 913, tz_alias_table + 918}},
+    {"America/Managua", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 93}},
+    {"West Pacific Standard Time", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 875}},
+    {"Europe/Prague", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 450}},
+    {"Etc/GMT-9", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 847}},
+    {"Pacific/Auckland", tz_alias_table + 919, tz_alias_table + 926, {tz_alias_table + 919, tz_alias_table + 920}},
+    {"Africa/Casablanca", tz_alias_table + 344, tz_alias_table + 348, {tz_alias_table + 344, tz_alias_table + 345}},
+    {"Mauritius Standard Time", tz_alias_table + 674, tz_alias_table + 682, {tz_alias_table + 674, tz_alias_table + 675}},
+    {"America/Sitka", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 32}},
+    {"Pacific/Noumea", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 906}},
+    {"UTC-11", tz_alias_table + 4, tz_alias_table + 14, {tz_alias_table + 4, tz_alias_table + 5}},
+    {"Pacific Standard Time (Mexico)", tz_alias_table + 34, tz_alias_table + 38, {tz_alias_table + 34, tz_alias_table + 35}},
+    {"Pakistan Standard Time", tz_alias_table + 694, tz_alias_table + 698, {tz_alias_table + 694, tz_alias_table + 695}},
+    {"Africa/Mbabane", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 560}},
+    {"Romance Standard Time", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 462}},
+    {"Etc/GMT-4", tz_alias_table + 656, tz_alias_table + 664, {tz_alias_table + 656, tz_alias_table + 662}},
+    {"Etc/GMT-5", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 717}},
+    {"SE Asia Standard Time", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 761}},
+    {"Europe/Dublin", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 365}},
+    {"Australia/Perth", tz_alias_table + 818, tz_alias_table + 824, {tz_alias_table + 818, tz_alias_table + 819}},
+    {"America/Ojinaga", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 74}},
+    {"America/Indiana/Knox", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 110}},
+    {"Africa/Sao_Tome", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 404}},
+    {"Kaliningrad Standard Time", tz_alias_table + 604, tz_alias_table + 610, {tz_alias_table + 604, tz_alias_table + 605}},
+    {"America/Winnipeg", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 102}},
+    {"Central Asia Standard Time", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 732}},
+    {"Africa/Kigali", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 558}},
+    {"Europe/Simferopol", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 585}},
+    {"Taipei Standard Time", tz_alias_table + 824, tz_alias_table + 828, {tz_alias_table + 824, tz_alias_table + 825}},
+    {"Africa/Ceuta", tz_alias_table + 461, tz_alias_table + 472, {tz_alias_table + 461, tz_alias_table + 470}},
+    {"Pacific/Galapagos", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 88}},
+    {"America/Scoresbysund", tz_alias_table + 332, tz_alias_table + 338, {tz_alias_table + 332, tz_alias_table + 335}},
+    {"America/Port_of_Spain", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 254}},
+    {"Europe/Vienna", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 413}},
+    {"America/Antigua", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 207}},
+    {"Africa/Cairo", tz_alias_table + 528, tz_alias_table + 535, {tz_alias_table + 528, tz_alias_table + 529}},
+    {"Morocco Standard Time", tz_alias_table + 344, tz_alias_table + 348, {tz_alias_table + 344, tz_alias_table + 345}},
+    {"America/Moncton", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 196}},
+    {"Europe/Minsk", tz_alias_table + 604, tz_alias_table + 610, {tz_alias_table + 604, tz_alias_table + 607}},
+    {"Asia/Yerevan", tz_alias_table + 686, tz_alias_table + 690, {tz_alias_table + 686, tz_alias_table + 687}},
+    {"Arabian Standard Time", tz_alias_table + 656, tz_alias_table + 664, {tz_alias_table + 656, tz_alias_table + 657}},
+    {"America/Caracas", tz_alias_table + 180, tz_alias_table + 184, {tz_alias_table + 180, tz_alias_table + 181}},
+    {"Australia/Lindeman", tz_alias_table + 864, tz_alias_table + 869, {tz_alias_table + 864, tz_alias_table + 868}},
+    {"Australia/Brisbane", tz_alias_table + 864, tz_alias_table + 869, {tz_alias_table + 864, tz_alias_table + 865}},
+    {"Africa/Maputo", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 556}},
+    {"Asia/Muscat", tz_alias_table + 656, tz_alias_table + 664, {tz_alias_table + 656, tz_alias_table + 660}},
+    {"America/Guayaquil", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 137}},
+    {"Asia/Kuching", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 812}},
+    {"Asia/Jerusalem", tz_alias_table + 592, tz_alias_table + 596, {tz_alias_table + 592, tz_alias_table + 593}},
+    {"Africa/Monrovia", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 392}},
+    {"America/Guatemala", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 82}},
+    {"Africa/Johannesburg", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 544}},
+    {"Indian/Antananarivo", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 636}},
+    {"Antarctica/Mawson", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 701}},
+    {"Fiji Standard Time", tz_alias_table + 943, tz_alias_table + 947, {tz_alias_table + 943, tz_alias_table + 944}},
+    {"E. Europe Standard Time", tz_alias_table + 539, tz_alias_table + 543, {tz_alias_table + 539, tz_alias_table + 540}},
+    {"America/Nipigon", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 160}},
+    {"Africa/Porto-Novo", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 487}},
+    {"Europe/Ljubljana", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 457}},
+    {"Azerbaijan Standard Time", tz_alias_table + 664, tz_alias_table + 668, {tz_alias_table + 664, tz_alias_table + 665}},
+    {"Asia/Vientiane", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 772}},
+    {"America/Dominica", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 230}},
+    {"America/Jamaica", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 141}},
+    {"Cen. Australia Standard Time", tz_alias_table + 855, tz_alias_table + 860, {tz_alias_table + 855, tz_alias_table + 856}},
+    {"Europe/San_Marino", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 441}},
+    {"Pacific/Guadalcanal", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 899}},
+    {"America/St_Kitts", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 240}},
+    {"Australia/Sydney", tz_alias_table + 869, tz_alias_table + 874, {tz_alias_table + 869, tz_alias_table + 870}},
+    {"Pacific Standard Time", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 39}},
+    {"Central European Standard Time", tz_alias_table + 472, tz_alias_table + 482, {tz_alias_table + 472, tz_alias_table + 473}},
+    {"Namibia Standard Time", tz_alias_table + 512, tz_alias_table + 516, {tz_alias_table + 512, tz_alias_table + 513}},
+    {"America/Grenada", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 234}},
+    {"America/Puerto_Rico", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 250}},
+    {"Egypt Standard Time", tz_alias_table + 528, tz_alias_table + 535, {tz_alias_table + 528, tz_alias_table + 529}},
+    {"Antarctica/Davis", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 763}},
+    {"Africa/Abidjan", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 379}},
+    {"America/Anchorage", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 27}},
+    {"North Asia East Standard Time", tz_alias_table + 833, tz_alias_table + 837, {tz_alias_table + 833, tz_alias_table + 834}},
+    {"America/Noronha", tz_alias_table + 324, tz_alias_table + 332, {tz_alias_table + 324, tz_alias_table + 327}},
+    {"Antarctica/Palmer", tz_alias_table + 264, tz_alias_table + 270, {tz_alias_table + 264, tz_alias_table + 267}},
+    {"America/Panama", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 145}},
+    {"America/Phoenix", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 51}},
+    {"Asia/Tokyo", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 838}},
+    {"Atlantic/Faeroe", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 360}},
+    {"Nepal Standard Time", tz_alias_table + 727, tz_alias_table + 731, {tz_alias_table + 727, tz_alias_table + 728}},
+    {"Tokyo Standard Time", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 838}},
+    {"America/Argentina/Rio_Gallegos", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 284}},
+    {"Greenland Standard Time", tz_alias_table + 312, tz_alias_table + 316, {tz_alias_table + 312, tz_alias_table + 313}},
+    {"Africa/Tripoli", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 427}},
+    {"America/Eirunepe", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 223}},
+    {"Europe/Oslo", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 435}},
+    {"America/Denver", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 67}},
+    {"Europe/Warsaw", tz_alias_table + 472, tz_alias_table + 482, {tz_alias_table + 472, tz_alias_table + 473}},
+    {"China Standard Time", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 788}},
+    {"MST7MDT", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 79}},
+    {"Antarctica/Syowa", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 625}},
+    {"America/Monterrey", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 125}},
+    {"Antarctica/Vostok", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 734}},
+    {"CST6CDT", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 116}},
+    {"Asia/Samarkand", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 716}},
+    {"Europe/Tallinn", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 576}},
+    {"Atlantic/Madeira", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 373}},
+    {"Africa/Addis_Ababa", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 631}},
+    {"America/Dawson_Creek", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 53}},
+    {"W. Central Africa Standard Time", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 483}},
+    {"Africa/Blantyre", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 554}},
+    {"UTC+12", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 927}},
+    {"Indian/Comoro", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 634}},
+    {"UTC", tz_alias_table + 348, tz_alias_table + 355, {tz_alias_table + 348, tz_alias_table + 349}},
+    {"Asia/Beirut", tz_alias_table + 524, tz_alias_table + 528, {tz_alias_table + 524, tz_alias_table + 525}},
+    {"Africa/Windhoek", tz_alias_table + 512, tz_alias_table + 516, {tz_alias_table + 512, tz_alias_table + 513}},
+    {"Asia/Pontianak", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 769}},
+    {"America/Coral_Harbour", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 134}},
+    {"America/Inuvik", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 72}},
+    {"Asia/Manila", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 813}},
+    {"Asia/Amman", tz_alias_table + 596, tz_alias_table + 600, {tz_alias_table + 596, tz_alias_table + 597}},
+    {"America/Rankin_Inlet", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 105}},
+    {"Africa/Kampala", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 646}},
+    {"Pacific/Palau", tz_alias_table + 837, tz_alias_table + 849, {tz_alias_table + 837, tz_alias_table + 843}},
+    {"America/Menominee", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 112}},
+    {"America/Hermosillo", tz_alias_table + 50, tz_alias_table + 61, {tz_alias_table + 50, tz_alias_table + 56}},
+    {"Asia/Dubai", tz_alias_table + 656, tz_alias_table + 664, {tz_alias_table + 656, tz_alias_table + 657}},
+    {"Pacific/Enderbury", tz_alias_table + 953, tz_alias_table + 963, {tz_alias_table + 953, tz_alias_table + 956}},
+    {"Africa/Nouakchott", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 396}},
+    {"Asia/Colombo", tz_alias_table + 723, tz_alias_table + 727, {tz_alias_table + 723, tz_alias_table + 724}},
+    {"Africa/Brazzaville", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 493}},
+    {"Europe/Volgograd", tz_alias_table + 668, tz_alias_table + 674, {tz_alias_table + 668, tz_alias_table + 673}},
+    {"West Asia Standard Time", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 699}},
+    {"AUS Central Standard Time", tz_alias_table + 860, tz_alias_table + 864, {tz_alias_table + 860, tz_alias_table + 861}},
+    {"Bahia Standard Time", tz_alias_table + 320, tz_alias_table + 324, {tz_alias_table + 320, tz_alias_table + 321}},
+    {"Etc/GMT-12", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 927}},
+    {"America/Argentina/Tucuman", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 288}},
+    {"Etc/GMT-10", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 886}},
+    {"America/Jujuy", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 292}},
+    {"America/Araguaina", tz_alias_table + 274, tz_alias_table + 279, {tz_alias_table + 274, tz_alias_table + 278}},
+    {"Europe/London", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 356}},
+    {"Central Pacific Standard Time", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 899}},
+    {"PST8PDT", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 48}},
+    {"Azores Standard Time", tz_alias_table + 332, tz_alias_table + 338, {tz_alias_table + 332, tz_alias_table + 333}},
+    {"Africa/Djibouti", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 627}},
+    {"America/Santiago", tz_alias_table + 264, tz_alias_table + 270, {tz_alias_table + 264, tz_alias_table + 265}},
+    {"America/Santa_Isabel", tz_alias_table + 34, tz_alias_table + 38, {tz_alias_table + 34, tz_alias_table + 35}},
+    {"Central Brazilian Standard Time", tz_alias_table + 199, tz_alias_table + 204, {tz_alias_table + 199, tz_alias_table + 200}},
+    {"Asia/Baku", tz_alias_table + 664, tz_alias_table + 668, {tz_alias_table + 664, tz_alias_table + 665}},
+    {"Eastern Standard Time", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 152}},
+    {"America/Halifax", tz_alias_table + 188, tz_alias_table + 199, {tz_alias_table + 188, tz_alias_table + 189}},
+    {"Pacific/Funafuti", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 936}},
+    {"America/Argentina/San_Juan", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 286}},
+    {"Europe/Tirane", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 448}},
+    {"Europe/Bucharest", tz_alias_table + 516, tz_alias_table + 524, {tz_alias_table + 516, tz_alias_table + 517}},
+    {"Africa/Luanda", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 485}},
+    {"Africa/Khartoum", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 638}},
+    {"America/Kralendijk", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 218}},
+    {"Antarctica/Macquarie", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 901}},
+    {"America/Santo_Domingo", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 232}},
+    {"Jordan Standard Time", tz_alias_table + 596, tz_alias_table + 600, {tz_alias_table + 596, tz_alias_table + 597}},
+    {"America/St_Thomas", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 260}},
+    {"Europe/Chisinau", tz_alias_table + 516, tz_alias_table + 524, {tz_alias_table + 516, tz_alias_table + 521}},
+    {"America/Paramaribo", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 308}},
+    {"Europe/Malta", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 431}},
+    {"Africa/Mogadishu", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 640}},
+    {"Atlantic/Stanley", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 305}},
+    {"America/Shiprock", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 78}},
+    {"America/Bogota", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 132}},
+    {"Australia/Darwin", tz_alias_table + 860, tz_alias_table + 864, {tz_alias_table + 860, tz_alias_table + 861}},
+    {"Central America Standard Time", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 82}},
+    {"Europe/Vilnius", tz_alias_table + 569, tz_alias_table + 588, {tz_alias_table + 569, tz_alias_table + 580}},
+    {"America/Rainy_River", tz_alias_table + 99, tz_alias_table + 118, {tz_alias_table + 99, tz_alias_table + 104}},
+    {"SA Pacific Standard Time", tz_alias_table + 131, tz_alias_table + 151, {tz_alias_table + 131, tz_alias_table + 132}},
+    {"Asia/Bishkek", tz_alias_table + 731, tz_alias_table + 744, {tz_alias_table + 731, tz_alias_table + 738}},
+    {"AUS Eastern Standard Time", tz_alias_table + 869, tz_alias_table + 874, {tz_alias_table + 869, tz_alias_table + 870}},
+    {"America/Aruba", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 211}},
+    {"America/Indiana/Winamac", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 169}},
+    {"America/Merida", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 124}},
+    {"Australia/Melbourne", tz_alias_table + 869, tz_alias_table + 874, {tz_alias_table + 869, tz_alias_table + 873}},
+    {"Europe/Andorra", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 411}},
+    {"Asia/Brunei", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 806}},
+    {"W. Australia Standard Time", tz_alias_table + 818, tz_alias_table + 824, {tz_alias_table + 818, tz_alias_table + 819}},
+    {"Israel Standard Time", tz_alias_table + 592, tz_alias_table + 596, {tz_alias_table + 592, tz_alias_table + 593}},
+    {"Europe/Berlin", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 409}},
+    {"Pacific/Ponape", tz_alias_table + 898, tz_alias_table + 913, {tz_alias_table + 898, tz_alias_table + 903}},
+    {"Etc/GMT+11", tz_alias_table + 4, tz_alias_table + 14, {tz_alias_table + 4, tz_alias_table + 5}},
+    {"Tonga Standard Time", tz_alias_table + 953, tz_alias_table + 963, {tz_alias_table + 953, tz_alias_table + 954}},
+    {"Etc/GMT+2", tz_alias_table + 324, tz_alias_table + 332, {tz_alias_table + 324, tz_alias_table + 325}},
+    {"America/Manaus", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 220}},
+    {"America/Cuiaba", tz_alias_table + 199, tz_alias_table + 204, {tz_alias_table + 199, tz_alias_table + 200}},
+    {"Pacific/Kwajalein", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 933}},
+    {"Asia/Aden", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 620}},
+    {"UTC-02", tz_alias_table + 324, tz_alias_table + 332, {tz_alias_table + 324, tz_alias_table + 325}},
+    {"America/Swift_Current", tz_alias_table + 126, tz_alias_table + 131, {tz_alias_table + 126, tz_alias_table + 130}},
+    {"Europe/Monaco", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 429}},
+    {"Indian/Mahe", tz_alias_table + 674, tz_alias_table + 682, {tz_alias_table + 674, tz_alias_table + 680}},
+    {"America/Danmarkshavn", tz_alias_table + 348, tz_alias_table + 355, {tz_alias_table + 348, tz_alias_table + 352}},
+    {"Asia/Kabul", tz_alias_table + 690, tz_alias_table + 694, {tz_alias_table + 690, tz_alias_table + 691}},
+    {"Asia/Hebron", tz_alias_table + 528, tz_alias_table + 535, {tz_alias_table + 528, tz_alias_table + 534}},
+    {"Africa/Banjul", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 385}},
+    {"America/Juneau", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 30}},
+    {"Europe/Bratislava", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 459}},
+    {"Asia/Karachi", tz_alias_table + 694, tz_alias_table + 698, {tz_alias_table + 694, tz_alias_table + 695}},
+    {"Africa/Libreville", tz_alias_table + 482, tz_alias_table + 512, {tz_alias_table + 482, tz_alias_table + 499}},
+    {"America/Campo_Grande", tz_alias_table + 199, tz_alias_table + 204, {tz_alias_table + 199, tz_alias_table + 203}},
+    {"Pacific/Pago_Pago", tz_alias_table + 4, tz_alias_table + 14, {tz_alias_table + 4, tz_alias_table + 7}},
+    {"America/Fortaleza", tz_alias_table + 294, tz_alias_table + 312, {tz_alias_table + 294, tz_alias_table + 299}},
+    {"Asia/Novokuznetsk", tz_alias_table + 781, tz_alias_table + 787, {tz_alias_table + 781, tz_alias_table + 785}},
+    {"Etc/UTC", tz_alias_table + 348, tz_alias_table + 355, {tz_alias_table + 348, tz_alias_table + 351}},
+    {"Europe/Zurich", tz_alias_table + 408, tz_alias_table + 445, {tz_alias_table + 408, tz_alias_table + 415}},
+    {"Atlantic/Reykjavik", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 375}},
+    {"Pacific/Niue", tz_alias_table + 4, tz_alias_table + 14, {tz_alias_table + 4, tz_alias_table + 9}},
+    {"Magadan Standard Time", tz_alias_table + 947, tz_alias_table + 953, {tz_alias_table + 947, tz_alias_table + 948}},
+    {"Central Standard Time (Mexico)", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 119}},
+    {"Central Europe Standard Time", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 446}},
+    {"America/Sao_Paulo", tz_alias_table + 274, tz_alias_table + 279, {tz_alias_table + 274, tz_alias_table + 275}},
+    {"Asia/Kuala_Lumpur", tz_alias_table + 803, tz_alias_table + 818, {tz_alias_table + 803, tz_alias_table + 810}},
+    {"Asia/Riyadh", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 611}},
+    {"Korea Standard Time", tz_alias_table + 849, tz_alias_table + 855, {tz_alias_table + 849, tz_alias_table + 850}},
+    {"Alaskan Standard Time", tz_alias_table + 26, tz_alias_table + 34, {tz_alias_table + 26, tz_alias_table + 27}},
+    {"Asia/Shanghai", tz_alias_table + 787, tz_alias_table + 799, {tz_alias_table + 787, tz_alias_table + 788}},
+    {"Asia/Oral", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 703}},
+    {"Atlantic/St_Helena", tz_alias_table + 374, tz_alias_table + 408, {tz_alias_table + 374, tz_alias_table + 398}},
+    {"Asia/Katmandu", tz_alias_table + 727, tz_alias_table + 731, {tz_alias_table + 727, tz_alias_table + 728}},
+    {"America/Cancun", tz_alias_table + 118, tz_alias_table + 126, {tz_alias_table + 118, tz_alias_table + 123}},
+    {"Asia/Pyongyang", tz_alias_table + 849, tz_alias_table + 855, {tz_alias_table + 849, tz_alias_table + 852}},
+    {"Pacific/Wallis", tz_alias_table + 926, tz_alias_table + 943, {tz_alias_table + 926, tz_alias_table + 940}},
+    {"Asia/Novosibirsk", tz_alias_table + 781, tz_alias_table + 787, {tz_alias_table + 781, tz_alias_table + 782}},
+    {"America/Nassau", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 154}},
+    {"America/Catamarca", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 290}},
+    {"America/Toronto", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 156}},
+    {"Asia/Ashgabat", tz_alias_table + 698, tz_alias_table + 719, {tz_alias_table + 698, tz_alias_table + 713}},
+    {"South Africa Standard Time", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 544}},
+    {"America/La_Paz", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 205}},
+    {"Europe/Kaliningrad", tz_alias_table + 604, tz_alias_table + 610, {tz_alias_table + 604, tz_alias_table + 605}},
+    {"Asia/Kamchatka", tz_alias_table + 947, tz_alias_table + 953, {tz_alias_table + 947, tz_alias_table + 952}},
+    {"America/Argentina/Ushuaia", tz_alias_table + 279, tz_alias_table + 294, {tz_alias_table + 279, tz_alias_table + 289}},
+    {"New Zealand Standard Time", tz_alias_table + 919, tz_alias_table + 926, {tz_alias_table + 919, tz_alias_table + 920}},
+    {"America/Edmonton", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 69}},
+    {"Yakutsk Standard Time", tz_alias_table + 893, tz_alias_table + 898, {tz_alias_table + 893, tz_alias_table + 894}},
+    {"Europe/Budapest", tz_alias_table + 445, tz_alias_table + 461, {tz_alias_table + 445, tz_alias_table + 446}},
+    {"Africa/Bujumbura", tz_alias_table + 543, tz_alias_table + 569, {tz_alias_table + 543, tz_alias_table + 546}},
+    {"Europe/Istanbul", tz_alias_table + 588, tz_alias_table + 592, {tz_alias_table + 588, tz_alias_table + 589}},
+    {"Asia/Yakutsk", tz_alias_table + 893, tz_alias_table + 898, {tz_alias_table + 893, tz_alias_table + 894}},
+    {"America/Whitehorse", tz_alias_table + 38, tz_alias_table + 50, {tz_alias_table + 38, tz_alias_table + 44}},
+    {"America/Kentucky/Monticello", tz_alias_table + 151, tz_alias_table + 174, {tz_alias_table + 151, tz_alias_table + 170}},
+    {"Pacific/Rarotonga", tz_alias_table + 14, tz_alias_table + 26, {tz_alias_table + 14, tz_alias_table + 17}},
+    {"Pacific/Fakaofo", tz_alias_table + 953, tz_alias_table + 963, {tz_alias_table + 953, tz_alias_table + 958}},
+    {"Africa/Dar_es_Salaam", tz_alias_table + 622, tz_alias_table + 652, {tz_alias_table + 622, tz_alias_table + 644}},
+    {"America/El_Salvador", tz_alias_table + 81, tz_alias_table + 99, {tz_alias_table + 81, tz_alias_table + 95}},
+    {"Atlantic/Canary", tz_alias_table + 355, tz_alias_table + 374, {tz_alias_table + 355, tz_alias_table + 358}},
+    {"Etc/GMT", tz_alias_table + 348, tz_alias_table + 355, {tz_alias_table + 348, tz_alias_table + 349}},
+    {"America/Porto_Velho", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 224}},
+    {"N. Central Asia Standard Time", tz_alias_table + 781, tz_alias_table + 787, {tz_alias_table + 781, tz_alias_table + 782}},
+    {"Asia/Anadyr", tz_alias_table + 947, tz_alias_table + 953, {tz_alias_table + 947, tz_alias_table + 951}},
+    {"Asia/Saigon", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 777}},
+    {"Pacific/Guam", tz_alias_table + 874, tz_alias_table + 888, {tz_alias_table + 874, tz_alias_table + 881}},
+    {"Asia/Kuwait", tz_alias_table + 610, tz_alias_table + 622, {tz_alias_table + 610, tz_alias_table + 615}},
+    {"America/Boise", tz_alias_table + 66, tz_alias_table + 81, {tz_alias_table + 66, tz_alias_table + 77}},
+    {"Pacific/Midway", tz_alias_table + 4, tz_alias_table + 14, {tz_alias_table + 4, tz_alias_table + 11}},
+    {"Russian Standard Time", tz_alias_table + 668, tz_alias_table + 674, {tz_alias_table + 668, tz_alias_table + 669}},
+    {"America/St_Barthelemy", tz_alias_table + 204, tz_alias_table + 264, {tz_alias_table + 204, tz_alias_table + 215}},
+    {"Asia/Bangkok", tz_alias_table + 760, tz_alias_table + 781, {tz_alias_table + 760, tz_alias_table + 761}},
+    {"Myanmar Standard Time", tz_alias_table + 754, tz_alias_table + 760, {tz_alias_table + 754, tz_alias_table + 755}},
+};
+#define TZ_ALIAS_KEYS_SIZE 533 
+
+static const long tz_alias_displacements[] = {
+    -533, 0, 3, 4, 0, 2, -532, -531, 0, -529, -526, -525, 0, 1, 1, -524,
+    1, 1, -523, -522, 1, -521, 1, 0, -518, 0, 0, 0, -516, -512, -510, 0,
+    -506, 0, 0, 0, -503, -499, 1, -497, 2, -495, -494, 1, 2, -492, 3, 13,
+    0, -491, 0, 1, 0, -490, -488, 0, -487, 0, 0, 0, -485, 0, -484, -483,
+    -480, 1, 0, -475, -473, -472, -468, -466, -465, 1, 1, 0, -464, -463, 0, -454,
+    0, 0, 0, 0, 0, 0, 1, 0, -452, 1, 2, 2, -448, -447, 0, 4,
+    -444, -441, -440, 0, -438, -437, 1, 5, 0, 0, 0, 3, -435, -434, 0, 2,
+    0, -430, 6, -423, -415, 0, 2, 0, -413, 0, 2, -412, 0, -411, 0, 1,
+    0, 1, 1, -408, -405, 0, -403, 2, -397, 0, -396, 0, 0, -395, -390, 3,
+    0, 0, -389, 0, -382, 0, 0, -381, -372, 1, -371, -369, -367, 0, 2, 0,
+    -364, -362, 0, 0, 0, 0, 0, 0, 3, 4, -361, 0, -359, -357, 7, 0,
+    0, -356, 0, 0, 0, 2, 0, -352, 0, -351, 1, 0, 1, 6, -349, -347,
+    2, -342, 3, 0, 3, 0, 0, 1, 1, -341, 1, 2, 0, -340, 0, 1,
+    -339, 9, -331, -329, -327, -325, 1, 0, 0, -321, 4, 0, 0, 10, -320, 0,
+    -308, 0, 0, -304, -303, -301, 3, 0, 0, 0, 1, -300, 0, -299, 0, 0,
+    -298, -297, -294, 0, 1, -293, -287, 0, 0, -282, 2, 0, -281, 4, 1, 0,
+    0, 0, -280, -279, -268, -267, 0, 2, 3, 1, -266, 1, -264, -263, 0, 1,
+    -258, 0, 0, -255, 4, -254, -252, -251, 0, 0, -250, 3, 0, 0, -248, -247,
+    -246, 0, -242, 0, -240, -239, 0, -237, 0, -236, 0, 0, 1, 0, 0, 2,
+    0, -232, -226, 1, -225, 2, 2, -220, 1, 2, 1, 0, 0, -219, 1, -212,
+    0, 0, -210, -202, 1, -198, -195, 0, 3, 0, 0, -194, 0, 1, -185, 10,
+    14, 0, 2, -184, -183, -171, -166, 3, 0, -162, 0, 0, -160, 3, 8, 1,
+    0, -156, 0, -155, 2, 7, -153, 3, -152, -148, -147, 1, -146, 0, 0, 0,
+    -142, 0, 0, 5, -141, -140, 1, 0, 1, 2, -139, 4, -135, 0, 0, 1,
+    0, -133, -131, 0, 0, 0, 1, 3, 0, -128, 0, 0, 0, -126, -125, 0,
+    4, -119, 0, 13, 0, 0, -118, 0, 2, 0, 7, 0, -117, -109, 0, 0,
+    0, 0, -108, -106, 0, 3, 5, 0, 0, -103, -102, -97, -96, 1, -93, -92,
+    -86, 1, 0, 2, 0, -85, -82, 2, 0, -80, -79, -76, 0, 0, -72, 0,
+    0, 0, -69, 0, 0, -68, 0, -67, -65, 0, -63, 3, 3, 17, -62, 1,
+    -59, 3, -56, 0, 3, -55, 0, 0, 0, -54, -51, 6, 2, 1, -43, -42,
+    -40, 3, -39, 0, -37, -36, 0, 8, 0, -35, -33, -30, 0, -27, 2, -25,
+    -23, 0, -21, 1, 0, 1, 14, 0, -16, 0, -11, 2, 0, 0, 0, 0,
+    0, 9, 0, -10, 0, 4, 0, 4, 0, 1, -7, 1, 8, 1, 0, 0,
+    -6, 0, -3, 5, -2,
+};
+#define TZ_ALIAS_DISPLACEMENTS_SIZE 533 
+
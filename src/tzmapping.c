@@ -30,172 +30,194 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include <stdlib.h>
 #include <string.h>
 #include "tzmapping.h"
-#include "timezones_map.h"
 
+// Iterator points to the alias which is to be returned next, the static tables are never written through it
 struct tz_alias_iterator {
     tz_alias_t node;
-    tz_alias_iterator_t *next;
 };
 
+// Group of names mapped to each other, as generated by scripts/transform.py
+// Lead aliases (first windows standard time and olsen name found for the name) are iterated first,
+// then the rest of the group in the table order
 struct tz_aliases {
-    tz_alias_iterator_t begin;
+    const char *name;                   // Name the aliases are looked up by
+    const tz_alias_t *begin;            // First alias of the group in tz_alias_table
+    const tz_alias_t *end;              // Past the last alias of the group
+    const tz_alias_t *lead[2];          // Aliases iterated before the others
 };
 
-static tz_alias_iterator_t **insert_alias(tz_aliases_t *aliases, tz_alias_t *alias, tz_alias_iterator_t **insertPosition)
-{
-    tz_alias_iterator_t *inserted = NULL;
-    tz_alias_iterator_t *searchIt = TZMAP_BEGIN;
-    tz_alias_t *searchAlias = NULL;
-
-    if (insertPosition == NULL) {
-        return NULL;
-    }
-    while (tzmap_iterate(aliases, &searchIt, &searchAlias) == DT_OK) {
-        if (strcmp(searchAlias->name, alias->name) == 0 && alias->kind == searchAlias->kind) {
-            return insertPosition;
-        }
-    }
-
-    *insertPosition = malloc(sizeof(tz_alias_iterator_t));
-    inserted = *insertPosition;
-    inserted->next = NULL;
-
-    inserted->node.name = alias->name;
-    inserted->node.kind = alias->kind;
-    return &inserted->next;
-}
-
-
-static tz_alias_iterator_t **insert_mapping(tz_aliases_t *aliases, tz_alias_iterator_t **insertPosition, struct tz_unicode_mapping *tz)
-{
-    tz_alias_t alias = {0,};
-    alias.kind = DT_TZMAP_UNKNOWN;
-
-    alias.name = (const char *)tz->other;
-    alias.kind = DT_TZMAP_WIN_STANDARD_TIME;
-
-    insertPosition = insert_alias(aliases, &alias, insertPosition);
-
-    alias.name = (const char *)tz->type;
-    alias.kind = DT_TZMAP_OLSEN_NAME;
-
-    insertPosition = insert_alias(aliases, &alias, insertPosition);
-
-    alias.name = (const char *)tz->territory;
-    alias.kind = DT_TZMAP_ABBREVIATION;
-
-    insertPosition = insert_alias(aliases, &alias, insertPosition);
-
-    return insertPosition;
-}
+#include "timezones_map.h"
 
-static tz_alias_iterator_t **add_mapping_to_aliases(const char *tz_name, tz_aliases_t *list, tz_alias_iterator_t **insertPosition)
+static unsigned long tz_alias_hash(unsigned long seed, const char *name)
 {
-    size_t i = 0;
-    if (insertPosition == NULL) {
-        insertPosition = &list->begin.next;
-        list->begin.next = NULL;
+    if (seed == 0) {
+        seed = 0x01000193UL;
     }
-
-    for (i = 0; i < tz_unicode_map_size; i++) {
-        struct tz_unicode_mapping tz = tz_unicode_map[i];
-        if (((!strcmp(tz.type, tz_name)) ||
-                (!strcmp(tz.other, tz_name)))) {
-            insertPosition = insert_mapping(list, insertPosition, &tz);
-        }
+    for (; *name != '\0'; name++) {
+        seed = ((seed * 0x01000193UL) ^ (unsigned char) * name) & 0xffffffffUL;
     }
-    return insertPosition;
+    return seed;
 }
 
-static size_t mapping_size(tz_aliases_t *aliases)
+static const tz_alias_t *next_alias(const tz_aliases_t *aliases, const tz_alias_t *alias)
 {
-    size_t size = 0;
-    tz_alias_t *alias = NULL;
-    tz_alias_iterator_t *it = TZMAP_BEGIN;
-    if (aliases == NULL) {
-        return 0;
+    const tz_alias_t *next = NULL;
+
+    if (alias == aliases->lead[0]) {
+        return aliases->lead[1];
     }
-    while (tzmap_iterate(aliases, &it, &alias) == DT_OK) {
-        size++;
+    next = (alias == aliases->lead[1]) ? aliases->begin : alias + 1;
+    while (next < aliases->end && (next == aliases->lead[0] || next == aliases->lead[1])) {
+        next++;
     }
-    return size;
+    return next < aliases->end ? next : NULL;
 }
 
-dt_status_t tzmap_map(const char *tz_name, tz_aliases_t **aliases)
+dt_status_t tzmap_map(const char *tz_name, const tz_aliases_t **aliases)
 {
-    tz_aliases_t *list = NULL;
-    tz_alias_iterator_t **insertPosition = NULL;
-    tz_alias_iterator_t *it = TZMAP_BEGIN;
-    tz_alias_t *alias = NULL;
-    size_t size = 0;
+    long displacement = 0;
+    unsigned long slot = 0;
 
     if (tz_name == NULL || aliases == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
-    list = (tz_aliases_t *)malloc(sizeof(tz_aliases_t));
-    memset(list, 0, sizeof(tz_aliases_t));
-    *aliases = list;
-    insertPosition = add_mapping_to_aliases(tz_name, list, insertPosition);
-    while (size != mapping_size(list)) {
-        while (tzmap_iterate(list, &it, &alias) == DT_OK) {
-            if (alias->kind == DT_TZMAP_ABBREVIATION) {
-                continue;
-            }
-            if (strcmp(alias->name, tz_name) == 0) {
-                continue;
-            }
-            insertPosition = add_mapping_to_aliases(alias->name, list, insertPosition);
-        }
-        size = mapping_size(list);
-
+    // Perfect hash lookup, names which are not in the table may hash to any slot
+    displacement = tz_alias_displacements[tz_alias_hash(0, tz_name) % TZ_ALIAS_DISPLACEMENTS_SIZE];
+    if (displacement < 0) {
+        slot = (unsigned long)(-displacement - 1);
+    } else {
+        slot = tz_alias_hash((unsigned long) displacement, tz_name) % TZ_ALIAS_KEYS_SIZE;
     }
-
-    if (list->begin.next == NULL) {
-        tzmap_free(list);
+    if (strcmp(tz_alias_keys[slot].name, tz_name) != 0) {
         *aliases = NULL;
         return DT_TIMEZONE_NOT_FOUND;
     }
+    *aliases = &tz_alias_keys[slot];
     return DT_OK;
-
 }
 
-dt_status_t tzmap_iterate(const tz_aliases_t *aliases, tz_alias_iterator_t **iterator, tz_alias_t **alias)
+dt_status_t tzmap_iterate(const tz_aliases_t *aliases, tz_alias_iterator_t **iterator, const tz_alias_t **alias)
 {
-    tz_alias_iterator_t *it = NULL;
+    const tz_alias_t *it = NULL;
     if (aliases == NULL || iterator == NULL || alias == NULL) {
         return DT_INVALID_ARGUMENT;
     }
     if (*iterator == TZMAP_BEGIN) {
-        *iterator = aliases->begin.next;
+        *iterator = (tz_alias_iterator_t *) aliases->lead[0];
     }
 
-
-    it = *iterator;
+    it = (const tz_alias_t *) * iterator;
     if (it == NULL) {
         return DT_NO_MORE_ITEMS;
     }
 
-    *alias = &it->node;
-    *iterator = it->next;
-
+    *alias = it;
+    *iterator = (tz_alias_iterator_t *) next_alias(aliases, it);
 
     return DT_OK;
 }
 
 
-dt_status_t tzmap_free(tz_aliases_t *aliases)
+dt_status_t tzmap_free(const tz_aliases_t *aliases)
 {
-    tz_alias_iterator_t *it = NULL;
-    tz_alias_iterator_t *forFree = NULL;
+    // Aliases are static tables, there is nothing to free
     if (aliases == NULL) {
         return DT_INVALID_ARGUMENT;
     }
-    it = aliases->begin.next;
-    while ((forFree = it) != NULL) {
-        it = it->next;
-        free(forFree);
+    return DT_OK;
+}
+
+// Names of the timezones with zero UTC offset, with or without "Etc/" prefix, and their abbreviations in the timezone
+// database
+static const struct {
+    const char *name;
+    const char *abbreviation;
+} tz_zero_offset_names[] = {
+    {"UTC", "UTC"}, {"Z", "UTC"}, {"UCT", "UTC"}, {"Zulu", "UTC"}, {"Universal", "UTC"},
+    {"GMT", "GMT"}, {"Greenwich", "GMT"}, {"GMT0", "GMT"}, {"GMT+0", "GMT"}, {"GMT-0", "GMT"}
+};
+
+#define TZ_ETC_PREFIX "Etc/"
+#define TZ_UTC_PREFIX "UTC"
+
+// Parses two decimal digits
+static int tz_parse_two_digits(const char *str, long *value)
+{
+    if (str[0] < '0' || str[0] > '9' || str[1] < '0' || str[1] > '9') {
+        return 0;
+    }
+    *value = (str[0] - '0') * 10 + (str[1] - '0');
+    return 1;
+}
+
+// Parses ISO 8601 UTC offset: sign and hh, hhmm or hh:mm
+static dt_status_t tz_parse_iso_offset(const char *str, long *offset)
+{
+    long hours = 0;
+    long minutes = 0;
+    long sign = 0;
+
+    if (str[0] != '+' && str[0] != '-') {
+        return DT_TIMEZONE_NOT_FOUND;
+    }
+    sign = str[0] == '-' ? -1 : 1;
+    if (!tz_parse_two_digits(str + 1, &hours)) {
+        return DT_TIMEZONE_NOT_FOUND;
+    }
+    str += 3;
+    if (*str == ':') {
+        str++;
+    }
+    if (*str != '\0' && (!tz_parse_two_digits(str, &minutes) || str[2] != '\0')) {
+        return DT_TIMEZONE_NOT_FOUND;
+    }
+    if (hours > 23 || minutes > 59) {
+        return DT_TIMEZONE_NOT_FOUND;
     }
-    aliases->begin.next = NULL;
+    *offset = sign * (hours * 3600 + minutes * 60);
     return DT_OK;
 }
+
+dt_status_t tzmap_fixed_offset(const char *tz_name, long *offset, const char **abbreviation)
+{
+    const char *name = tz_name;
+    char *end = NULL;
+    long hours = 0;
+    size_t i = 0;
+
+    if (tz_name == NULL || offset == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (abbreviation != NULL) {
+        *abbreviation = NULL;
+    }
+    if (strncmp(name, TZ_ETC_PREFIX, sizeof(TZ_ETC_PREFIX) - 1) == 0) {
+        name += sizeof(TZ_ETC_PREFIX) - 1;
+    }
+    for (i = 0; i < sizeof(tz_zero_offset_names) / sizeof(tz_zero_offset_names[0]); i++) {
+        if (strcmp(name, tz_zero_offset_names[i].name) == 0) {
+            *offset = 0;
+            if (abbreviation != NULL) {
+                *abbreviation = tz_zero_offset_names[i].abbreviation;
+            }
+            return DT_OK;
+        }
+    }
+    if (name != tz_name) {
+        // Etc/GMT+N is N hours to the west of Greenwich, from Etc/GMT-14 to Etc/GMT+12
+        if (strncmp(name, "GMT", 3) != 0 || (name[3] != '+' && name[3] != '-') || name[4] < '0' || name[4] > '9') {
+            return DT_TIMEZONE_NOT_FOUND;
+        }
+        hours = strtol(name + 4, &end, 10);
+        if (*end != '\0' || hours > (name[3] == '+' ? 12 : 14)) {
+            return DT_TIMEZONE_NOT_FOUND;
+        }
+        *offset = (name[3] == '+' ? -hours : hours) * 3600;
+        return DT_OK;
+    }
+    if (strncmp(name, TZ_UTC_PREFIX, sizeof(TZ_UTC_PREFIX) - 1) == 0) {
+        name += sizeof(TZ_UTC_PREFIX) - 1;
+    }
+    return tz_parse_iso_offset(name, offset);
+}
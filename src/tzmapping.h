@@ -71,6 +71,8 @@ extern "C" {
 #endif
 
     //! Creates tz_aliases_t collection, by given timezone name
+    //! Lookup is done in constant time by the perfect hash generated by scripts/transform.py, first aliases
+    //! of windows standard time and olsen name kinds are always iterated first.
     //! You must manually free aliases after usage by tzmap_free() if this function has been called successfully
     /*!
      * @param tz_name name of time zone for maping
@@ -78,7 +80,7 @@ extern "C" {
      * @return DT_OK on success otherwise corresponding status from dt_status_t
      * @sa tzmap_free
      */
-    LIBDT_EXPORT dt_status_t tzmap_map(const char *tz_name, tz_aliases_t **aliases);
+    LIBDT_EXPORT dt_status_t tzmap_map(const char *tz_name, const tz_aliases_t **aliases);
 
     //! Iterates through tz_aliases_t collection
     /*!
@@ -87,14 +89,27 @@ extern "C" {
      * @param alias pointer to store finded alias
      * @return DT_OK on success otherwise corresponding status from dt_status_t
      */
-    LIBDT_EXPORT dt_status_t tzmap_iterate(const tz_aliases_t *aliases, tz_alias_iterator_t **iterator, tz_alias_t **alias);
+    LIBDT_EXPORT dt_status_t tzmap_iterate(const tz_aliases_t *aliases, tz_alias_iterator_t **iterator,
+                                           const tz_alias_t **alias);
 
     //! Free resources of tz_aliases_t collection
     /*!
      * @param aliases colection which resources will be free
      * @return DT_OK on success otherwise corresponding status from dt_status_t
      */
-    LIBDT_EXPORT dt_status_t tzmap_free(tz_aliases_t *aliases);
+    LIBDT_EXPORT dt_status_t tzmap_free(const tz_aliases_t *aliases);
+
+    //! Recognizes names of timezones with a fixed UTC offset
+    //! These are "UTC", "Z", "GMT" and their synonyms, "Etc/GMT+N" and "Etc/GMT-N" (POSIX style, the sign is
+    //! inverted) and ISO 8601 offsets "+hh", "+hhmm", "+hh:mm" (or with '-'), optionally prefixed with "UTC"
+    /*!
+     * @param tz_name name of time zone
+     * @param offset pointer to store UTC offset in seconds, positive to the east of Greenwich
+     * @param abbreviation pointer to store "UTC" or "GMT" for the names the timezone database abbreviates so, NULL
+     * for the ones abbreviated by the offset, could be NULL
+     * @return DT_OK if the name is of a fixed offset timezone, DT_TIMEZONE_NOT_FOUND if it is not
+     */
+    LIBDT_EXPORT dt_status_t tzmap_fixed_offset(const char *tz_name, long *offset, const char **abbreviation);
 
     /*! @}*/
 #ifdef __cplusplus
@@ -37,8 +37,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include "libtz/tz.h"
 #include "libtz/tzfile.h"
 #include "../tzmapping.h"
+#include "../dt_calendar.h"
+#include "tzcache.h"
+#include "tzlocal.h"
 
-static const time_t WRONG_POSIX_TIME = -1;
+#define SECONDS_PER_DAY 86400
+#define SECONDS_PER_HOUR 3600
+#define SECONDS_PER_MINUTE 60
 
 dt_status_t dt_now(dt_timestamp_t *result)
 {
@@ -68,9 +73,81 @@ dt_status_t dt_posix_time_to_timestamp(time_t time, unsigned long nano_second, d
 }
 
 
+// Transition hint is a cache, so it is updated through const timezone object, which dt.h requires not to be
+// a const object itself. It is a single word, which is validated against the immutable timezone state on use,
+// so relaxed atomic accesses are enough for sharing the object between threads, hit/miss counters are atomic
+// increments, so they are exact in this case too.
+static struct tm *localtime_hinted(const dt_timezone_t *tz, const time_t *posix_time, struct tm *tm)
+{
+    dt_timezone_t *hinted = (dt_timezone_t *) tz;
+    int hint = __atomic_load_n(&hinted->transition_hint, __ATOMIC_RELAXED);
+    int hit = 0;
+    struct tm *result = tz_localtime_hint_r(tz->state, posix_time, tm, &hint, &hit);
+
+    if (hit) {
+        (void) __atomic_fetch_add(&hinted->hint_hits, 1, __ATOMIC_RELAXED);
+    } else {
+        __atomic_store_n(&hinted->transition_hint, hint, __ATOMIC_RELAXED);
+        (void) __atomic_fetch_add(&hinted->hint_misses, 1, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+// Breaks down timestamp in fixed offset timezone. Time is split into days before the offset is applied,
+// so no timestamp overflows, years which do not fit struct tm are rejected as libtz does
+static dt_status_t fixed_to_representation(const dt_timestamp_t *timestamp, long gmtoff, dt_representation_t *representation)
+{
+    long long days = timestamp->second / SECONDS_PER_DAY;
+    long seconds = timestamp->second % SECONDS_PER_DAY + gmtoff;
+    long long year = 0;
+    int month = 0;
+    int day = 0;
+    int day_of_year = 0;
+
+    days += seconds / SECONDS_PER_DAY;
+    seconds %= SECONDS_PER_DAY;
+    if (seconds < 0) {
+        seconds += SECONDS_PER_DAY;
+        days--;
+    }
+    dt_calendar_civil_from_days(days, &year, &month, &day, &day_of_year);
+    if (year > INT_MAX || year < (long long) INT_MIN + 1900) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    representation->year = (int) year;
+    representation->month = month;
+    representation->day = day;
+    representation->hour = seconds / SECONDS_PER_HOUR;
+    representation->minute = seconds / SECONDS_PER_MINUTE % 60;
+    representation->second = seconds % SECONDS_PER_MINUTE;
+    representation->nano_second = timestamp->nano_second;
+    return DT_OK;
+}
+
+// Converts representation in fixed offset timezone to POSIX time, fields out of range are normalized as
+// mktime() does
+static time_t fixed_to_posix_time(const dt_representation_t *representation, long gmtoff)
+{
+    long long year = representation->year;
+    long month = (long) representation->month - 1;
+    long long days = 0;
+
+    year += month / 12;
+    month %= 12;
+    if (month < 0) {
+        month += 12;
+        year--;
+    }
+    days = dt_calendar_days_from_civil(year, month + 1, representation->day);
+    return days * SECONDS_PER_DAY + representation->hour * SECONDS_PER_HOUR + representation->minute * SECONDS_PER_MINUTE +
+           representation->second - gmtoff;
+}
+
 dt_status_t dt_timestamp_to_representation(const dt_timestamp_t *timestamp, const dt_timezone_t *tz, dt_representation_t *representation)
 {
     struct tm tm = {0,};
+    const struct state *local_state = NULL;
 
     if (timestamp == NULL || representation == NULL) {
         return DT_INVALID_ARGUMENT;
@@ -78,28 +155,396 @@ dt_status_t dt_timestamp_to_representation(const dt_timestamp_t *timestamp, cons
 
 
     if (tz == NULL) {
-        if (localtime_r(&(timestamp->second), &tm) == NULL) {
+        // Local timezone state is shared, so the hint of a timezone object is not used for it
+        local_state = tzlocal_get();
+        if (local_state == NULL) {
             return DT_SYSTEM_CALL_ERROR;
         }
+        if (tz_localtime_r(local_state, &(timestamp->second), &tm) == NULL) {
+            return DT_INVALID_ARGUMENT;
+        }
         return dt_tm_to_representation(&tm, timestamp->nano_second, representation);
     }
 
+    if (tz->is_fixed) {
+        return fixed_to_representation(timestamp, tz->gmtoff, representation);
+    }
+
     if (tz != NULL && tz->state == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
-    if (tz_localtime_r(tz->state, &(timestamp->second), &tm) == NULL) {
+    if (localtime_hinted(tz, &(timestamp->second), &tm) == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
     return dt_tm_to_representation(&tm, timestamp->nano_second, representation);
 }
 
+// Number of timestamps dt_timestamps_to_representations() converts at once in buffers on the stack
+#define BATCH_CHUNK_SIZE 256
+
+// Converts timestamps by dt_timestamp_to_representation(), keeping the first error
+static dt_status_t timestamps_to_representations_scalar(const dt_timestamp_t *timestamps, size_t count,
+                                                        const dt_timezone_t *tz, dt_representation_t *representations, dt_status_t result)
+{
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    size_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        status = dt_timestamp_to_representation(&timestamps[i], tz, &representations[i]);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+dt_status_t dt_timestamps_to_representations(const dt_timestamp_t *timestamps, size_t count,
+                                             const dt_timezone_t *tz, dt_representation_t *representations)
+{
+    time_t times[BATCH_CHUNK_SIZE];
+    time_t locals[BATCH_CHUNK_SIZE];
+    int years[BATCH_CHUNK_SIZE];
+    int months[BATCH_CHUNK_SIZE];
+    int days[BATCH_CHUNK_SIZE];
+    int seconds_of_day[BATCH_CHUNK_SIZE];
+    char fallback[BATCH_CHUNK_SIZE];
+    dt_timezone_t local_tz = {0,};
+    dt_timezone_t *hinted = (dt_timezone_t *) tz;
+    dt_status_t result = DT_OK;
+    size_t begin = 0;
+    size_t size = 0;
+    size_t i = 0;
+    int done = 0;
+    int hint = 0;
+
+    if ((timestamps == NULL || representations == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (tz == NULL) {
+        // Local timezone is converted as a timezone object of its own, with the hint for this call only
+        if ((local_tz.state = tzlocal_get()) == NULL) {
+            return DT_SYSTEM_CALL_ERROR;
+        }
+        tz = hinted = &local_tz;
+    }
+    if (!tz->is_fixed && tz->state == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    hint = __atomic_load_n(&hinted->transition_hint, __ATOMIC_RELAXED);
+    for (begin = 0; begin < count; begin += size) {
+        size = count - begin < BATCH_CHUNK_SIZE ? count - begin : BATCH_CHUNK_SIZE;
+
+        // Timestamps the calendar kernel can not take are converted one by one, zero is put instead of them
+        for (i = 0; i < size; i++) {
+            times[i] = timestamps[begin + i].second;
+            fallback[i] = times[i] < -DT_CALENDAR_MAX_SECONDS || times[i] > DT_CALENDAR_MAX_SECONDS;
+            if (fallback[i]) {
+                times[i] = 0;
+            }
+        }
+        for (i = 0; i < size && tz->is_fixed; i++) {
+            locals[i] = times[i] + tz->gmtoff;
+        }
+        for (i = tz->is_fixed ? size : 0; i < size; i += done + 1) {
+            done = tz_local_seconds(tz->state, times + i, locals + i, size - i, &hint);
+            if (done < 0) {
+                // Leap seconds are taken into account by libtz breaking down only
+                __atomic_store_n(&hinted->transition_hint, hint, __ATOMIC_RELAXED);
+                return timestamps_to_representations_scalar(timestamps + begin, count - begin, tz,
+                                                            representations + begin, result);
+            }
+            if (i + done < size) {
+                fallback[i + done] = 1;
+                locals[i + done] = 0;
+            }
+        }
+        for (i = 0; i < size; i++) {
+            if (locals[i] < -DT_CALENDAR_MAX_SECONDS || locals[i] > DT_CALENDAR_MAX_SECONDS) {
+                fallback[i] = 1;
+                locals[i] = 0;
+            }
+        }
+
+        dt_calendar_split(locals, size, years, months, days, seconds_of_day);
+
+        for (i = 0; i < size; i++) {
+            dt_representation_t *representation = &representations[begin + i];
+
+            if (fallback[i]) {
+                result = timestamps_to_representations_scalar(&timestamps[begin + i], 1, tz, representation, result);
+                continue;
+            }
+            representation->year = years[i];
+            representation->month = months[i];
+            representation->day = days[i];
+            representation->hour = seconds_of_day[i] / 3600;
+            representation->minute = seconds_of_day[i] / 60 % 60;
+            representation->second = seconds_of_day[i] % 60;
+            representation->nano_second = timestamps[begin + i].nano_second;
+        }
+    }
+    __atomic_store_n(&hinted->transition_hint, hint, __ATOMIC_RELAXED);
+    return result;
+}
+
+dt_status_t dt_timestamp_to_representations_multi(const dt_timestamp_t *timestamp, const dt_timezone_t *const *timezones,
+                                                  size_t count, dt_representation_t *representations)
+{
+    // UTC dates of the day before, of the day and of the day after the timestamp
+    long long years[3] = {0,};
+    int months[3] = {0,};
+    int days[3] = {0,};
+    int day_of_year = 0;
+    const struct state *local_state = NULL;
+    const struct state *state = NULL;
+    const dt_timezone_t *tz = NULL;
+    dt_timezone_t *hinted = NULL;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    dt_status_t result = DT_OK;
+    time_t local = 0;
+    long long day = 0;
+    long seconds = 0;
+    long second_of_day = 0;
+    long gmtoff = 0;
+    size_t i = 0;
+    int hint = 0;
+    int hint_before = 0;
+    int j = 0;
+    dt_bool_t is_done = DT_FALSE;
+
+    if (timestamp == NULL || ((timezones == NULL || representations == NULL) && count > 0)) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    day = timestamp->second / SECONDS_PER_DAY;
+    seconds = timestamp->second % SECONDS_PER_DAY;
+    if (seconds < 0) {
+        seconds += SECONDS_PER_DAY;
+        day--;
+    }
+    for (j = 0; j < 3; j++) {
+        dt_calendar_civil_from_days(day + j - 1, &years[j], &months[j], &days[j], &day_of_year);
+    }
+
+    for (i = 0; i < count; i++) {
+        dt_representation_t *representation = &representations[i];
+
+        tz = timezones[i];
+        state = (tz == NULL) ? local_state : tz->state;
+        status = DT_OK;
+        is_done = DT_FALSE;
+        if (tz != NULL && tz->is_fixed) {
+            gmtoff = tz->gmtoff;
+        } else if (tz == NULL && state == NULL && (state = local_state = tzlocal_get()) == NULL) {
+            status = DT_SYSTEM_CALL_ERROR;
+        } else if (state == NULL) {
+            status = DT_INVALID_ARGUMENT;
+        } else if (timestamp->second < -DT_CALENDAR_MAX_SECONDS || timestamp->second > DT_CALENDAR_MAX_SECONDS) {
+            // Local seconds overflow near the limits of time_t, such timestamps are converted one by one
+            status = dt_timestamp_to_representation(timestamp, tz, representation);
+            is_done = DT_TRUE;
+        } else {
+            // Local timezone state is shared, so it is converted without a hint as by dt_timestamp_to_representation()
+            hint = hint_before = (tz == NULL) ? 0 : __atomic_load_n(&tz->transition_hint, __ATOMIC_RELAXED);
+            if (tz_local_seconds(state, &timestamp->second, &local, 1, &hint) == 1) {
+                gmtoff = local - timestamp->second;
+            } else {
+                // Leap seconds are taken into account by libtz breaking down only
+                status = dt_timestamp_to_representation(timestamp, tz, representation);
+                is_done = DT_TRUE;
+            }
+            if (tz != NULL && hint != hint_before) {
+                hinted = (dt_timezone_t *) tz;
+                __atomic_store_n(&hinted->transition_hint, hint, __ATOMIC_RELAXED);
+            }
+        }
+
+        if (status == DT_OK && !is_done) {
+            // The offset moves time of the UTC day by a day at most, the date is one of those broken down already
+            second_of_day = seconds + gmtoff;
+            j = (second_of_day < 0) ? 0 : (second_of_day < SECONDS_PER_DAY) ? 1 : 2;
+            second_of_day -= (j - 1) * SECONDS_PER_DAY;
+            if (second_of_day < 0 || second_of_day >= SECONDS_PER_DAY || years[j] > INT_MAX ||
+                    years[j] < (long long) INT_MIN + 1900) {
+                status = fixed_to_representation(timestamp, gmtoff, representation);
+            } else {
+                representation->year = (int) years[j];
+                representation->month = months[j];
+                representation->day = days[j];
+                representation->hour = second_of_day / SECONDS_PER_HOUR;
+                representation->minute = second_of_day / SECONDS_PER_MINUTE % 60;
+                representation->second = second_of_day % SECONDS_PER_MINUTE;
+                representation->nano_second = timestamp->nano_second;
+            }
+        }
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+dt_status_t dt_stream_converter_init(const dt_timezone_t *timezone, dt_stream_converter_t *converter)
+{
+    if (converter == NULL || (timezone != NULL && !timezone->is_fixed && timezone->state == NULL)) {
+        return DT_INVALID_ARGUMENT;
+    }
+    memset(converter, 0, sizeof(dt_stream_converter_t));
+    converter->timezone = timezone;
+    converter->is_cached = DT_FALSE;
+    return DT_OK;
+}
+
+// Converts timestamp fully and caches its local day and the next transition in the converter
+static dt_status_t stream_convert_full(dt_stream_converter_t *converter, const dt_timestamp_t *timestamp)
+{
+    const dt_timezone_t *tz = converter->timezone;
+    const struct state *state = NULL;
+    dt_representation_t *representation = &converter->representation;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    time_t t = timestamp->second;
+    time_t local = 0;
+    time_t at = 0;
+    long gmtoff = 0;
+
+    converter->is_cached = DT_FALSE;
+    if (t < -DT_CALENDAR_MAX_SECONDS || t > DT_CALENDAR_MAX_SECONDS) {
+        // Local seconds overflow near the limits of time_t, such timestamps are not cached
+        return dt_timestamp_to_representation(timestamp, tz, representation);
+    }
+    if (tz != NULL && tz->is_fixed) {
+        gmtoff = tz->gmtoff;
+        converter->limit = LONG_MAX;
+    } else {
+        if (tz == NULL) {
+            if ((state = tzlocal_get()) == NULL) {
+                return DT_SYSTEM_CALL_ERROR;
+            }
+        } else {
+            state = tz->state;
+        }
+        // Local days are not cached for states with leap seconds, they are not of the same length
+        if (tz_local_seconds(state, &t, &local, 1, &converter->transition_hint) != 1) {
+            return dt_timestamp_to_representation(timestamp, tz, representation);
+        }
+        gmtoff = local - t;
+        converter->limit = tz_transition(state, t, 1, &at, NULL, NULL, NULL) ? at : LONG_MAX;
+    }
+    if (converter->limit > DT_CALENDAR_MAX_SECONDS) {
+        // Timestamps past the calendar range are converted fully, so differences to the cached ones do not overflow
+        converter->limit = DT_CALENDAR_MAX_SECONDS;
+    }
+
+    if ((status = fixed_to_representation(timestamp, gmtoff, representation)) != DT_OK) {
+        return status;
+    }
+    converter->last = timestamp->second;
+    converter->day_start = timestamp->second - (representation->hour * SECONDS_PER_HOUR +
+                                                representation->minute * SECONDS_PER_MINUTE + representation->second);
+    converter->is_cached = DT_TRUE;
+    return DT_OK;
+}
+
+// Moves cached representation to the next local day, returns DT_FALSE if the year changes
+static dt_bool_t stream_next_day(dt_stream_converter_t *converter)
+{
+    static const unsigned short days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    dt_representation_t *representation = &converter->representation;
+    int year = representation->year;
+    unsigned short month_days = days_in_month[representation->month - 1];
+
+    if (representation->month == 2 && year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) {
+        month_days++;
+    }
+    if (representation->day < month_days) {
+        representation->day++;
+    } else if (representation->month < 12) {
+        representation->day = 1;
+        representation->month++;
+    } else {
+        return DT_FALSE;
+    }
+    converter->day_start += SECONDS_PER_DAY;
+    return DT_TRUE;
+}
+
+dt_status_t dt_stream_converter_convert(dt_stream_converter_t *converter, const dt_timestamp_t *timestamp,
+                                        dt_representation_t *representation)
+{
+    dt_representation_t *cached = NULL;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    long delta = 0;
+    long second_of_day = 0;
+
+    if (converter == NULL || timestamp == NULL || representation == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    cached = &converter->representation;
+    if (!converter->is_cached || timestamp->second < converter->last || timestamp->second >= converter->limit) {
+        // Going back or past the transition, the offset is to be found again
+        status = stream_convert_full(converter, timestamp);
+    } else if ((delta = timestamp->second - converter->last) < SECONDS_PER_MINUTE) {
+        // Carrying by comparisons only, it is the most common case for streams
+        status = DT_OK;
+        cached->second += delta;
+        if (cached->second >= SECONDS_PER_MINUTE) {
+            cached->second -= SECONDS_PER_MINUTE;
+            if (++cached->minute == 60) {
+                cached->minute = 0;
+                if (++cached->hour == 24) {
+                    cached->hour = 0;
+                    if (!stream_next_day(converter)) {
+                        status = stream_convert_full(converter, timestamp);
+                    }
+                }
+            }
+        }
+    } else {
+        status = DT_OK;
+        second_of_day = timestamp->second - converter->day_start;
+        if (second_of_day >= SECONDS_PER_DAY && second_of_day < 2 * SECONDS_PER_DAY && stream_next_day(converter)) {
+            second_of_day -= SECONDS_PER_DAY;
+        }
+        if (second_of_day < SECONDS_PER_DAY) {
+            cached->hour = second_of_day / SECONDS_PER_HOUR;
+            cached->minute = second_of_day / SECONDS_PER_MINUTE % 60;
+            cached->second = second_of_day % SECONDS_PER_MINUTE;
+        } else {
+            status = stream_convert_full(converter, timestamp);
+        }
+    }
+
+    if (status != DT_OK) {
+        return status;
+    }
+    if (converter->is_cached) {
+        converter->last = timestamp->second;
+        cached->nano_second = timestamp->nano_second;
+    }
+    *representation = *cached;
+    return DT_OK;
+}
+
 dt_status_t dt_representation_to_timestamp(const dt_representation_t *representation, const dt_timezone_t *timezone,
                                            dt_timestamp_t *first_timestamp, dt_timestamp_t *second_timestamp)
+{
+    return dt_representation_to_timestamp_policy(representation, timezone, DT_GAP_REJECT, first_timestamp, second_timestamp);
+}
+
+dt_status_t dt_representation_to_timestamp_policy(const dt_representation_t *representation, const dt_timezone_t *timezone,
+                                                  dt_gap_policy_t gap_policy, dt_timestamp_t *first_timestamp,
+                                                  dt_timestamp_t *second_timestamp)
 {
     struct tm tm = {0,};
-    time_t posix_time = WRONG_POSIX_TIME;
+    dt_timezone_t local_tz = {0,};
+    time_t first = 0;
+    time_t second = 0;
+    time_t transition = 0;
+    int count = 0;
 
     dt_status_t status = DT_UNKNOWN_ERROR;
 
@@ -112,57 +557,377 @@ dt_status_t dt_representation_to_timestamp(const dt_representation_t *representa
     }
 
     if (timezone == NULL) {
-        posix_time = mktime(&tm);
-        if (posix_time != WRONG_POSIX_TIME) {
-            first_timestamp->second = posix_time;
-            first_timestamp->nano_second = representation->nano_second;
-            return DT_OK;
-        } else {
+        if ((local_tz.state = tzlocal_get()) == NULL) {
             return DT_SYSTEM_CALL_ERROR;
         }
+        timezone = &local_tz;
+    }
 
+    if (timezone->is_fixed) {
+        // Every local time occurs exactly once
+        first_timestamp->second = fixed_to_posix_time(representation, timezone->gmtoff);
+        first_timestamp->nano_second = representation->nano_second;
+        if (second_timestamp != NULL) {
+            *second_timestamp = *first_timestamp;
+        }
+        return DT_OK;
     }
 
     if (timezone != NULL && timezone->state == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
-
-    if (WRONG_POSIX_TIME == (posix_time = tz_mktime(timezone->state, &tm))) {
+    if ((count = tz_mktime_all(timezone->state, &tm, &first, &second, &transition)) < 0) {
         return DT_INVALID_ARGUMENT;
     }
 
-    first_timestamp->second = posix_time;
+    if (count == 0) {
+        // Representation is skipped by a transition
+        switch (gap_policy) {
+            case DT_GAP_EARLIEST:
+                second = first;
+                break;
+            case DT_GAP_LATEST:
+                first = second;
+                break;
+            case DT_GAP_SHIFT_FORWARD:
+                first = second = transition;
+                break;
+            default:
+                return DT_INVALID_ARGUMENT;
+        }
+    }
+
+    first_timestamp->second = first;
     first_timestamp->nano_second = representation->nano_second;
+    if (second_timestamp != NULL) {
+        second_timestamp->second = second;
+        second_timestamp->nano_second = representation->nano_second;
+    }
+    return DT_OK;
+}
+
+// Timezone of a conversion between timezones with the range [begin, end) of local times known to occur once
+// with UTC offset gmtoff, which is the whole time for fixed offset timezones and empty for the others at first
+typedef struct {
+    const dt_timezone_t *timezone;
+    const struct state *state;
+    long gmtoff;
+    time_t begin;
+    time_t end;
+    int hint;
+} convert_zone_t;
+
+static dt_status_t convert_zone_init(const dt_timezone_t *timezone, convert_zone_t *zone)
+{
+    memset(zone, 0, sizeof(convert_zone_t));
+    zone->timezone = timezone;
+    if (timezone != NULL && timezone->is_fixed) {
+        zone->gmtoff = timezone->gmtoff;
+        zone->begin = LONG_MIN;
+        zone->end = LONG_MAX;
+        return DT_OK;
+    }
+    if (timezone == NULL) {
+        if ((zone->state = tzlocal_get()) == NULL) {
+            return DT_SYSTEM_CALL_ERROR;
+        }
+        return DT_OK;
+    }
+    if ((zone->state = timezone->state) == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    zone->hint = __atomic_load_n(&timezone->transition_hint, __ATOMIC_RELAXED);
     return DT_OK;
 }
 
+static void convert_zone_cleanup(convert_zone_t *zone)
+{
+    dt_timezone_t *hinted = (dt_timezone_t *) zone->timezone;
+
+    if (hinted != NULL && !hinted->is_fixed) {
+        __atomic_store_n(&hinted->transition_hint, zone->hint, __ATOMIC_RELAXED);
+    }
+}
+
+// Converts representation through the timestamp by two public calls
+static dt_status_t convert_representation_tm(const dt_representation_t *representation, const convert_zone_t *from,
+                                             const convert_zone_t *to, dt_representation_t *result)
+{
+    dt_timestamp_t timestamp = {0,};
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if ((status = dt_representation_to_timestamp(representation, from->timezone, &timestamp, NULL)) != DT_OK) {
+        return status;
+    }
+    return dt_timestamp_to_representation(&timestamp, to->timezone, result);
+}
+
+// Converts representation by local seconds, the range of the source timezone is updated if keep_range is set
+static dt_status_t convert_representation(const dt_representation_t *representation, convert_zone_t *from,
+                                          convert_zone_t *to, dt_bool_t keep_range, dt_representation_t *result)
+{
+    dt_timestamp_t timestamp = {0,};
+    time_t local = 0;
+    time_t first = 0;
+    time_t second = 0;
+    time_t transition = 0;
+    time_t range[2] = {0,};
+    long gmtoff = 0;
+    int count = 0;
+
+    // Seconds out of a minute are added after the rest is resolved by mktime(), leap seconds are also its part
+    if (representation->second >= SECONDS_PER_MINUTE) {
+        return convert_representation_tm(representation, from, to, result);
+    }
+    local = fixed_to_posix_time(representation, 0);
+    if (local >= from->begin && local < from->end) {
+        timestamp.second = local - from->gmtoff;
+    } else {
+        count = tz_local_search(from->state, local, &first, &second, &transition, keep_range ? range : NULL);
+        if (count < 0) {
+            return convert_representation_tm(representation, from, to, result);
+        }
+        if (count == 0) {
+            // Representation is skipped by a transition
+            return DT_INVALID_ARGUMENT;
+        }
+        timestamp.second = first;
+        if (keep_range && count == 1) {
+            from->gmtoff = local - first;
+            from->begin = range[0];
+            from->end = range[1];
+        }
+    }
+    timestamp.nano_second = representation->nano_second;
+
+    if (from->state != NULL && from->state == to->state) {
+        // The offset of the time found is the one it has been found by
+        gmtoff = local - timestamp.second;
+    } else if (to->state == NULL) {
+        gmtoff = to->gmtoff;
+    } else if (tz_local_seconds(to->state, &timestamp.second, &local, 1, &to->hint) == 1) {
+        gmtoff = local - timestamp.second;
+    } else {
+        return dt_timestamp_to_representation(&timestamp, to->timezone, result);
+    }
+    return fixed_to_representation(&timestamp, gmtoff, result);
+}
+
+dt_status_t dt_convert_representation(const dt_representation_t *representation, const dt_timezone_t *from,
+                                      const dt_timezone_t *to, dt_representation_t *result)
+{
+    convert_zone_t from_zone;
+    convert_zone_t to_zone;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (representation == NULL || result == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if ((status = convert_zone_init(from, &from_zone)) != DT_OK ||
+            (status = convert_zone_init(to, &to_zone)) != DT_OK) {
+        return status;
+    }
+
+    status = convert_representation(representation, &from_zone, &to_zone, DT_FALSE, result);
+    convert_zone_cleanup(&to_zone);
+    return status;
+}
+
+dt_status_t dt_convert_representations(const dt_representation_t *representations, size_t count,
+                                       const dt_timezone_t *from, const dt_timezone_t *to,
+                                       dt_representation_t *results)
+{
+    convert_zone_t from_zone;
+    convert_zone_t to_zone;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    dt_status_t result = DT_OK;
+    size_t i = 0;
+
+    if ((representations == NULL || results == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if ((status = convert_zone_init(from, &from_zone)) != DT_OK ||
+            (status = convert_zone_init(to, &to_zone)) != DT_OK) {
+        return status;
+    }
+
+    for (i = 0; i < count; i++) {
+        status = convert_representation(&representations[i], &from_zone, &to_zone, DT_TRUE, &results[i]);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    convert_zone_cleanup(&to_zone);
+    return result;
+}
+
+// Resolves a local time of a zone to the time by the gap policy, the earlier one of ambiguous times is taken. The UTC
+// offset in effect at the time is stored, which differs from the one of the local time in a gap. Returns 0 if the local
+// time is rejected by the policy and -1 if it is not resolved by local seconds.
+static int resolve_local(const convert_zone_t *zone, time_t local, dt_gap_policy_t gap_policy, time_t *time,
+                         long *gmtoff)
+{
+    time_t first = 0;
+    time_t second = 0;
+    time_t transition = 0;
+    int count = 0;
+
+    if (zone->state == NULL) {
+        *time = local - zone->gmtoff;
+        *gmtoff = zone->gmtoff;
+        return 1;
+    }
+    if ((count = tz_local_search(zone->state, local, &first, &second, &transition, NULL)) < 0) {
+        return -1;
+    }
+    if (count > 0) {
+        *time = first;
+        *gmtoff = local - first;
+        return 1;
+    }
+
+    // The first time is read with the offset after the transition and is before it, the second one is vice versa
+    switch (gap_policy) {
+        case DT_GAP_EARLIEST:
+            *time = first;
+            *gmtoff = local - second;
+            return 1;
+        case DT_GAP_LATEST:
+            *time = second;
+            *gmtoff = local - first;
+            return 1;
+        case DT_GAP_SHIFT_FORWARD:
+            *time = transition;
+            *gmtoff = local - first;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Adds seconds to a timestamp, DT_OVERFLOW is returned if the result does not fit
+static dt_status_t add_seconds(dt_timestamp_t *timestamp, long count, long unit)
+{
+    if (count > LONG_MAX / unit || count < LONG_MIN / unit) {
+        return DT_OVERFLOW;
+    }
+    count *= unit;
+    if ((count > 0 && timestamp->second > LONG_MAX - count) || (count < 0 && timestamp->second < LONG_MIN - count)) {
+        return DT_OVERFLOW;
+    }
+    timestamp->second += count;
+    return DT_OK;
+}
+
+dt_status_t dt_representation_add(const dt_representation_t *representation, dt_unit_t unit, long count,
+                                  const dt_timezone_t *timezone, dt_gap_policy_t gap_policy,
+                                  dt_representation_t *result)
+{
+    static const long unit_seconds[] = {0, 0, 0, 0, 0, SECONDS_PER_HOUR, SECONDS_PER_MINUTE, 1};
+    convert_zone_t zone;
+    dt_representation_t moved = {0,};
+    dt_timestamp_t timestamp = {0,};
+    time_t local = 0;
+    long gmtoff = 0;
+    int resolved = 0;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (dt_validate_representation(representation) != DT_TRUE || unit < DT_UNIT_YEAR || unit > DT_UNIT_SECOND ||
+            result == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // Date units move the local time, which is resolved once, time units are added to the time it is resolved to
+    moved = *representation;
+    if (unit_seconds[unit] == 0 && (status = dt_calendar_add_date(representation, unit, count, &moved)) != DT_OK) {
+        return status;
+    }
+    if ((status = convert_zone_init(timezone, &zone)) != DT_OK) {
+        return status;
+    }
+
+    local = fixed_to_posix_time(&moved, 0);
+    resolved = resolve_local(&zone, local, gap_policy, &timestamp.second, &gmtoff);
+    timestamp.nano_second = moved.nano_second;
+    if (resolved == 0) {
+        // Representation is skipped by a transition
+        status = DT_INVALID_ARGUMENT;
+    } else if (resolved < 0) {
+        if ((status = dt_representation_to_timestamp_policy(&moved, timezone, gap_policy, &timestamp, NULL)) == DT_OK &&
+                (unit_seconds[unit] == 0 || (status = add_seconds(&timestamp, count, unit_seconds[unit])) == DT_OK)) {
+            status = dt_timestamp_to_representation(&timestamp, timezone, result);
+        }
+    } else if (unit_seconds[unit] == 0) {
+        status = fixed_to_representation(&timestamp, gmtoff, result);
+    } else if ((status = add_seconds(&timestamp, count, unit_seconds[unit])) == DT_OK) {
+        if (zone.state == NULL) {
+            status = fixed_to_representation(&timestamp, zone.gmtoff, result);
+        } else if (timestamp.second >= -DT_CALENDAR_MAX_SECONDS && timestamp.second <= DT_CALENDAR_MAX_SECONDS &&
+                   tz_local_seconds(zone.state, &timestamp.second, &local, 1, &zone.hint) == 1) {
+            // Local seconds overflow near the limits of time_t, such timestamps are converted below
+            status = fixed_to_representation(&timestamp, local - timestamp.second, result);
+        } else {
+            status = dt_timestamp_to_representation(&timestamp, timezone, result);
+        }
+    }
+    convert_zone_cleanup(&zone);
+    return status;
+}
+
 dt_status_t dt_timezone_lookup(const char *timezone_name, dt_timezone_t *timezone)
 {
     dt_status_t status = DT_UNKNOWN_ERROR;
-    tz_aliases_t *aliases = NULL;
+    const tz_aliases_t *aliases = NULL;
     tz_alias_iterator_t *it = TZMAP_BEGIN;
-    tz_alias_t *alias = NULL;
-    char path[PATH_MAX] = {0,};
+    const tz_alias_t *alias = NULL;
 
     const struct state *s = NULL;
+    long gmtoff = 0;
+    const char *abbreviation = NULL;
 
     if (timezone == NULL || timezone_name == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
+    // Fixed offset timezones do not need timezone data at all, "GMT" and its synonyms keep their own abbreviation
+    if (tzmap_fixed_offset(timezone_name, &gmtoff, &abbreviation) == DT_OK) {
+        if ((status = dt_timezone_fixed(gmtoff, timezone)) == DT_OK && abbreviation != NULL) {
+            strcpy(timezone->abbreviation, abbreviation);
+        }
+        return status;
+    }
+
+    timezone->is_fixed = DT_FALSE;
+    timezone->gmtoff = 0;
+    timezone->transition_hint = 0;
+    timezone->hint_hits = 0;
+    timezone->hint_misses = 0;
+
+    // Fast path: timezone has been already looked up by this name
+    if (tzcache_find(timezone_name, &s) == DT_OK) {
+        timezone->state = s;
+        return DT_OK;
+    }
+
     if ((status = tzmap_map(timezone_name, &aliases)) != DT_OK) {
         return status;
     }
 
     while ((status = tzmap_iterate(aliases, &it, &alias)) == DT_OK) {
         if (alias->kind == DT_PREFFERED_TZMAP_TYPE) {
-            strcat(path, TZDIR);
-            strcat(path, "/");
-            strcat(path, alias->name);
-            s = tz_alloc(path);
-            if (s == NULL) {
-                return DT_TIMEZONE_NOT_FOUND;
+            // Sharing one state between all names of the timezone
+            if (tzcache_find(alias->name, &s) != DT_OK) {
+                // Name is resolved relative to TZDIR (or the compiled-in database) by libtz
+                s = tz_alloc(alias->name);
+                if (s == NULL) {
+                    tzmap_free(aliases);
+                    return DT_TIMEZONE_NOT_FOUND;
+                }
+                tzcache_insert(alias->name, &s);
+            }
+            if (strcmp(alias->name, timezone_name) != 0) {
+                tzcache_insert(timezone_name, &s);
             }
             timezone->state = s;
             tzmap_free(aliases);
@@ -170,14 +935,251 @@ dt_status_t dt_timezone_lookup(const char *timezone_name, dt_timezone_t *timezon
         }
     }
 
+    tzmap_free(aliases);
     return status;
 }
 
+// Makes abbreviation of fixed offset timezone as the timezone database does: "UTC", "-03", "+0530" or "+053015"
+static void fixed_abbreviation(long offset_seconds, char *abbreviation)
+{
+    long offset = offset_seconds < 0 ? -offset_seconds : offset_seconds;
+
+    if (offset == 0) {
+        strcpy(abbreviation, "UTC");
+    } else if (offset % SECONDS_PER_MINUTE != 0) {
+        sprintf(abbreviation, "%c%02ld%02ld%02ld", offset_seconds < 0 ? '-' : '+', offset / SECONDS_PER_HOUR,
+                offset / SECONDS_PER_MINUTE % 60, offset % SECONDS_PER_MINUTE);
+    } else if (offset % SECONDS_PER_HOUR != 0) {
+        sprintf(abbreviation, "%c%02ld%02ld", offset_seconds < 0 ? '-' : '+', offset / SECONDS_PER_HOUR,
+                offset / SECONDS_PER_MINUTE % 60);
+    } else {
+        sprintf(abbreviation, "%c%02ld", offset_seconds < 0 ? '-' : '+', offset / SECONDS_PER_HOUR);
+    }
+}
+
+dt_status_t dt_timezone_fixed(long offset_seconds, dt_timezone_t *timezone)
+{
+    if (timezone == NULL || offset_seconds <= -SECONDS_PER_DAY || offset_seconds >= SECONDS_PER_DAY) {
+        return DT_INVALID_ARGUMENT;
+    }
+    timezone->state = NULL;
+    timezone->is_fixed = DT_TRUE;
+    timezone->gmtoff = offset_seconds;
+    fixed_abbreviation(offset_seconds, timezone->abbreviation);
+    timezone->transition_hint = 0;
+    timezone->hint_hits = 0;
+    timezone->hint_misses = 0;
+    return DT_OK;
+}
+
+dt_status_t dt_timezone_offset_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp, long *gmtoff,
+                                  dt_bool_t *is_dst, const char **abbreviation)
+{
+    if (timestamp == NULL || gmtoff == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return dt_timezone_offsets_at(timezone, timestamp, 1, gmtoff, is_dst, abbreviation);
+}
+
+dt_status_t dt_timezone_offsets_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamps, size_t count,
+                                   long *gmtoffs, dt_bool_t *is_dst, const char **abbreviations)
+{
+    time_t times[BATCH_CHUNK_SIZE];
+    int isdsts[BATCH_CHUNK_SIZE];
+    dt_timezone_t *hinted = (dt_timezone_t *) timezone;
+    const struct state *state = NULL;
+    dt_status_t result = DT_OK;
+    size_t begin = 0;
+    size_t size = 0;
+    size_t i = 0;
+    int done = 0;
+    int hint = 0;
+
+    if ((timestamps == NULL || gmtoffs == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    if (timezone != NULL && timezone->is_fixed) {
+        for (i = 0; i < count; i++) {
+            gmtoffs[i] = timezone->gmtoff;
+            if (is_dst != NULL) {
+                is_dst[i] = DT_FALSE;
+            }
+            if (abbreviations != NULL) {
+                abbreviations[i] = timezone->abbreviation;
+            }
+        }
+        return DT_OK;
+    }
+
+    if (timezone == NULL) {
+        if ((state = tzlocal_get()) == NULL) {
+            return DT_SYSTEM_CALL_ERROR;
+        }
+    } else if ((state = timezone->state) == NULL) {
+        return DT_INVALID_ARGUMENT;
+    } else {
+        hint = __atomic_load_n(&hinted->transition_hint, __ATOMIC_RELAXED);
+    }
+
+    for (begin = 0; begin < count; begin += size) {
+        size = count - begin < BATCH_CHUNK_SIZE ? count - begin : BATCH_CHUNK_SIZE;
+        for (i = 0; i < size; i++) {
+            times[i] = timestamps[begin + i].second;
+        }
+        // Offsets are not found only for timestamps too far away from the transitions, zero is put for them
+        for (i = 0; i < size; i += done + 1) {
+            done = tz_offsets(state, times + i, size - i, gmtoffs + begin + i, isdsts + i,
+                              abbreviations != NULL ? abbreviations + begin + i : NULL, &hint);
+            if (i + done < size) {
+                gmtoffs[begin + i + done] = 0;
+                isdsts[i + done] = 0;
+                if (abbreviations != NULL) {
+                    abbreviations[begin + i + done] = NULL;
+                }
+                result = result == DT_OK ? DT_INVALID_ARGUMENT : result;
+            }
+        }
+        for (i = 0; i < size && is_dst != NULL; i++) {
+            is_dst[begin + i] = isdsts[i] ? DT_TRUE : DT_FALSE;
+        }
+    }
+
+    if (timezone != NULL) {
+        __atomic_store_n(&hinted->transition_hint, hint, __ATOMIC_RELAXED);
+    }
+    return result;
+}
+
+// Finds the transition next to a second in the forward or the backward direction
+static dt_status_t find_transition(const dt_timezone_t *timezone, long second, int forward, dt_transition_t *transition)
+{
+    const struct state *state = NULL;
+    time_t at = 0;
+    long gmtoffs[2] = {0,};
+    int isdsts[2] = {0,};
+
+    if (timezone != NULL && timezone->is_fixed) {
+        return DT_NO_MORE_ITEMS;
+    }
+    if (timezone == NULL) {
+        if ((state = tzlocal_get()) == NULL) {
+            return DT_SYSTEM_CALL_ERROR;
+        }
+    } else if ((state = timezone->state) == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    if (!tz_transition(state, second, forward, &at, gmtoffs, isdsts, NULL)) {
+        return DT_NO_MORE_ITEMS;
+    }
+    transition->timestamp.second = at;
+    transition->timestamp.nano_second = 0;
+    transition->gmtoff_before = gmtoffs[0];
+    transition->gmtoff_after = gmtoffs[1];
+    transition->is_dst_before = isdsts[0] ? DT_TRUE : DT_FALSE;
+    transition->is_dst_after = isdsts[1] ? DT_TRUE : DT_FALSE;
+    return DT_OK;
+}
+
+dt_status_t dt_timezone_next_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                        dt_transition_t *transition)
+{
+    if (timestamp == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    // Transitions are at whole seconds, so nano-seconds do not matter
+    return find_transition(timezone, timestamp->second, 1, transition);
+}
+
+dt_status_t dt_timezone_prev_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                        dt_transition_t *transition)
+{
+    if (timestamp == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return find_transition(timezone, timestamp->second, 0, transition);
+}
+
+dt_status_t dt_timezone_transitions(const dt_timezone_t *timezone, const dt_timestamp_t *from, const dt_timestamp_t *to,
+                                    dt_transition_iterator_t *iterator)
+{
+    if (from == NULL || to == NULL || iterator == NULL || (timezone != NULL && !timezone->is_fixed && timezone->state == NULL)) {
+        return DT_INVALID_ARGUMENT;
+    }
+    iterator->timezone = timezone;
+    iterator->done = DT_FALSE;
+    // Transition at some second is not earlier than the beginning if it is later than the previous second
+    iterator->next = from->second;
+    if (from->nano_second == 0) {
+        if (from->second == LONG_MIN) {
+            iterator->done = DT_TRUE;
+        } else {
+            iterator->next--;
+        }
+    }
+    iterator->last = to->second;
+    if (to->nano_second == 0) {
+        if (to->second == LONG_MIN) {
+            iterator->done = DT_TRUE;
+        } else {
+            iterator->last--;
+        }
+    }
+    if (iterator->next >= iterator->last) {
+        iterator->done = DT_TRUE;
+    }
+    return DT_OK;
+}
+
+dt_status_t dt_transition_iterate(dt_transition_iterator_t *iterator, dt_transition_t *transition)
+{
+    dt_transition_t found;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (iterator == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    if (iterator->done) {
+        return DT_NO_MORE_ITEMS;
+    }
+    memset(&found, 0, sizeof(dt_transition_t));
+    status = find_transition(iterator->timezone, iterator->next, 1, &found);
+    if (status == DT_OK && found.timestamp.second > iterator->last) {
+        status = DT_NO_MORE_ITEMS;
+    }
+    if (status != DT_OK) {
+        iterator->done = DT_TRUE;
+        return status;
+    }
+    iterator->next = found.timestamp.second;
+    *transition = found;
+    return DT_OK;
+}
+
+dt_status_t dt_local_timezone_reload(void)
+{
+    return tzlocal_reload();
+}
+
+dt_status_t dt_timezone_hint_stats(const dt_timezone_t *timezone, unsigned long *hits, unsigned long *misses)
+{
+    if (timezone == NULL || hits == NULL || misses == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    *hits = __atomic_load_n(&timezone->hint_hits, __ATOMIC_RELAXED);
+    *misses = __atomic_load_n(&timezone->hint_misses, __ATOMIC_RELAXED);
+    return DT_OK;
+}
+
 dt_status_t dt_timezone_cleanup(dt_timezone_t *timezone)
 {
     if (timezone == NULL) {
         return DT_INVALID_ARGUMENT;
     }
+    // Dropping only our reference, the state is still owned by the timezones cache
     tz_free(timezone->state);
+    timezone->state = NULL;
+    timezone->is_fixed = DT_FALSE;
     return DT_OK;
 }
@@ -19,8 +19,14 @@ static char elsieid[] = "@(#)localtime.c	8.17";
 #include "private.h"
 #include "tzfile.h"
 #include "fcntl.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
 #include "float.h"  /* for FLT_MAX and DBL_MAX */
 #include "tz.h"
+#include "../../dt_calendar.h"
+#ifdef TZ_EMBEDDED_DATA
+#include "tzdata.h"
+#endif /* defined TZ_EMBEDDED_DATA */
 
 #ifndef TZ_ABBR_MAX_LEN
 #define TZ_ABBR_MAX_LEN 16
@@ -106,29 +112,101 @@ struct lsinfo {             /* leap second information */
 #define MY_TZNAME_MAX   255
 #endif /* !defined TZNAME_MAX */
 
+/*
+** Size of the abbreviation buffer of a state under construction; finished
+** states keep only the charcnt + 1 bytes actually used.
+*/
+#define TZ_CHARS_SIZE   BIGGEST(BIGGEST(TZ_MAX_CHARS + 1, sizeof gmt), \
+                                (2 * (MY_TZNAME_MAX + 1)))
+
+struct rule {
+    int     r_type;     /* type of rule--see below */
+    int     r_day;      /* day number of rule */
+    int     r_week;     /* week number of rule */
+    int     r_mon;      /* month number of rule */
+    long        r_time;     /* transition time of rule */
+};
+
+/*
+** The arrays of a state live in the same allocation as the state itself,
+** right after it, and hold exactly as many elements as the zone needs (see
+** state_alloc and state_shrink), so one free() releases everything.
+*/
 struct state {
+    int     refcount;   /* owners of the state, see tz_retain */
     int     leapcnt;
     int     timecnt;
     int     typecnt;
     int     charcnt;
     int     goback;
     int     goahead;
-    time_t      ats[TZ_MAX_TIMES];
-    unsigned char   types[TZ_MAX_TIMES];
-    struct ttinfo   ttis[TZ_MAX_TYPES];
-    char        chars[BIGGEST(BIGGEST(TZ_MAX_CHARS + 1, sizeof gmt),
-                              (2 * (MY_TZNAME_MAX + 1)))];
-    struct lsinfo   lsis[TZ_MAX_LEAPS];
+    long        mingmtoff;  /* least tt_gmtoff of ttis */
+    long        maxgmtoff;  /* greatest tt_gmtoff of ttis */
+    time_t      *ats;       /* NULL when stored as atdeltas */
+#ifdef TZ_COMPACT_TRANSITIONS
+    time_t      atbase;     /* origin of atdeltas */
+    uint_least32_t  *atdeltas;  /* ats[i] - atbase */
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    time_t      *eytz;      /* ats in Eytzinger order from 1, or NULL */
+    unsigned short  *eytzidx;   /* index in ats of each element of eytz */
+    unsigned char   *types;
+    struct ttinfo   *ttis;
+    char        *chars;
+    struct lsinfo   *lsis;
+    /*
+    ** Times later than the last transition of a zone with a DST rule in
+    ** its POSIX TZ string follow the rule rather than repeat the
+    ** transitions: ruletab is built on first use (see rule_table) and then
+    ** owned by the state.
+    */
+    int     hasrule;
+    int     ruletypes[2];   /* types of DST ([0]) and standard time */
+    struct rule rulestart;  /* DST begins */
+    struct rule ruleend;    /* DST ends */
+    struct ruletable *ruletab;
 };
 
-struct rule {
-    int     r_type;     /* type of rule--see below */
-    int     r_day;      /* day number of rule */
-    int     r_week;     /* week number of rule */
-    int     r_mon;      /* month number of rule */
-    long        r_time;     /* transition time of rule */
+/*
+** Transitions of a rule over a cycle of years, see rule_table, with
+** RULE_PAD ones of the neighbouring cycles on either side.
+*/
+#define RULE_PAD    4
+
+struct ruletable {
+    time_t      ats[2 * YEARSPERREPEAT + 2 * RULE_PAD];
+    unsigned char   types[2 * YEARSPERREPEAT + 2 * RULE_PAD];
 };
 
+/*
+** Flags of state_alloc.
+*/
+#define STATE_COMPACT   01  /* transition times stored as atdeltas */
+#define STATE_INDEXED   02  /* with the eytz index of transition times */
+
+/*
+** Zones with fewer transitions than this are searched by plain binary search,
+** which is as fast as the Eytzinger index while ats fits a few cache lines.
+*/
+#ifndef TZ_EYTZINGER_MIN
+#define TZ_EYTZINGER_MIN    64
+#endif /* !defined TZ_EYTZINGER_MIN */
+
+/*
+** Transition time i of a state, whichever way the transitions are stored.
+*/
+#ifdef TZ_COMPACT_TRANSITIONS
+#define STATE_AT(sp, i) ((sp)->ats != NULL ? (sp)->ats[i] : \
+                         (sp)->atbase + (time_t) (sp)->atdeltas[i])
+#else /* !defined TZ_COMPACT_TRANSITIONS */
+#define STATE_AT(sp, i) ((sp)->ats[i])
+#endif /* !defined TZ_COMPACT_TRANSITIONS */
+
+/*
+** Whether t is later than the transitions of a state and so follows its rule.
+*/
+#define STATE_RULED(sp, t)  ((sp)->hasrule && ((sp)->timecnt == 0 || \
+                             (t) > STATE_AT(sp, (sp)->timecnt - 1)))
+
 #ifndef TZ_STRLEN_MAX
 #define TZ_STRLEN_MAX 255
 #endif /* !defined TZ_STRLEN_MAX */
@@ -151,19 +229,49 @@ static const char  *getnum(const char *strp, int *nump, int min,
 static const char  *getsecs(const char *strp, long *secsp);
 static const char  *getoffset(const char *strp, long *offsetp);
 static const char  *getrule(const char *strp, struct rule *rulep);
-static void     gmtload(struct state *const sp);
+static void     gmtcheck(void);
+static struct state    *gmtload(void);
 static struct tm   *gmtsub(const time_t *timep, long offset,
                            struct tm *tmp);
 static struct tm   *localsub(const struct state const *sp,
                              const time_t *timep, long offset,
                              struct tm *tmp);
+static int      cycle_shift(const struct state *sp, time_t t,
+                                time_t *newtp, int_fast64_t *icyclesp);
+static const struct ttinfo *first_ttinfo(const struct state *sp);
+static struct tm   *localttinfo(const struct state *sp,
+                                const time_t *timep,
+                                const struct ttinfo *ttisp,
+                                struct tm *tmp);
 static int      increment_overflow(int *number, int delta);
-static int      leaps_thru_end_of(int y);
+static struct state    *state_alloc(int timecnt, int typecnt, int charsize,
+                                    int leapcnt, int flags);
+static int      eytzinger_fill(struct state *sp, const time_t *ats,
+                               int i, int k);
+static void     state_copy(struct state *sp, const struct state *from);
+static void     state_finish(struct state *sp, const time_t *ats);
+static struct state    *state_scratch(void);
+static struct state    *state_shrink(const struct state *sp);
+static int      leap_search(const struct state *sp, time_t t);
+static int      local_search(const struct state *sp, const struct tm *tmp,
+                             int isdst, time_t *times, time_t *transitionp);
+static int      local_search_rule(const struct state *sp, long long local,
+                                  time_t lo, time_t hi, int isdst,
+                                  time_t *times, time_t *transitionp);
 static int      long_increment_overflow(long *number, int delta);
 static int      long_normalize_overflow(long *tensptr,
                                         int *unitsptr, int base);
 static int      normalize_overflow(int *tensptr, int *unitsptr,
                                    int base);
+static int      rule_search(const struct state *sp, time_t t,
+                            int forward, time_t *atp, int *typep);
+static const struct ruletable *rule_table(const struct state *sp);
+static int      rule_transition(const struct state *sp, time_t t,
+                                int forward, time_t *atp,
+                                const struct ttinfo **beforep,
+                                const struct ttinfo **afterp);
+static const struct ttinfo *rule_ttinfo(const struct state *sp, time_t t);
+static void     rule_year(const struct state *sp, int i, time_t *ats);
 static time_t       time1(register const struct state *const sp,
                           struct tm *tmp,
                           struct tm * (*funcp)(const struct state *const sp, const time_t *,
@@ -183,22 +291,32 @@ static struct tm   *timesub(const time_t *timep, long offset,
                             const struct state *const sp, struct tm *tmp);
 static int      tmcomp(const struct tm *atmp,
                        const struct tm *btmp);
+static int      transition_next(const struct state *sp, time_t t,
+                                time_t *atp,
+                                const struct ttinfo **ttispp);
+static int      transition_result(const struct state *sp, time_t at,
+                                  const struct ttinfo *before,
+                                  const struct ttinfo *after, time_t *atp,
+                                  long *gmtoffs, int *isdsts,
+                                  const char **abbrs);
+static int      transition_search(const struct state *sp, time_t t);
+static int      transition_hinted(const struct state *sp, time_t t,
+                                  int *hintp, int *hitp);
+static int      ttinfo_changes(const struct state *sp,
+                               const struct ttinfo *a,
+                               const struct ttinfo *b);
+static const struct ttinfo *ttinfo_hinted(const struct state *sp, time_t t,
+        int *hintp);
 static time_t       transtime(time_t janfirst, int year,
                               const struct rule *rulep, long offset);
 static int      typesequiv(const struct state *const sp, int a, int b);
-static int      tzload(const char *name, struct state *const sp,
-                       int doextend);
+static struct state    *tzdecode(const char *data, size_t size,
+                                  int doextend);
+static struct state    *tzload(const char *name, int doextend);
 static int      tzparse(const char *name, struct state *const sp,
                         int lastditch);
 
-#ifdef ALL_STATE
-static struct state    *gmtptr;
-#endif /* defined ALL_STATE */
-
-#ifndef ALL_STATE
-static struct state gmtmem;
-#define gmtptr      (&gmtmem)
-#endif /* State Farm */
+static const struct state   *gmtptr;
 
 int gmt_is_set;
 
@@ -252,38 +370,285 @@ const time_t    t0;
     return t1 - t0 == SECSPERREPEAT;
 }
 
+/*
+** Allocate a state and its arrays in one block, with room for exactly the
+** given number of elements. With STATE_COMPACT in flags the transition times
+** are to be stored as 32-bit atdeltas instead of ats, with STATE_INDEXED
+** there is room for the eytz index of them.
+*/
+
+static struct state *
+state_alloc(timecnt, typecnt, charsize, leapcnt, flags)
+const int   timecnt;
+const int   typecnt;
+const int   charsize;
+const int   leapcnt;
+const int   flags;
+{
+    register struct state  *sp;
+    register char          *p;
+    size_t              atssize;
+    size_t              eytzsize;
+    size_t              deltassize;
+    size_t              eytzidxsize;
+
+    /*
+    ** Arrays are laid out by decreasing alignment, so no padding is needed
+    ** between them.
+    */
+    atssize = (flags & STATE_COMPACT) ? 0 : timecnt * sizeof * sp->ats;
+    eytzsize = (flags & STATE_INDEXED) ?
+               (timecnt + 1) * sizeof * sp->eytz : 0;
+    eytzidxsize = (flags & STATE_INDEXED) ?
+                  (timecnt + 1) * sizeof * sp->eytzidx : 0;
+    deltassize = 0;
+#ifdef TZ_COMPACT_TRANSITIONS
+    deltassize = (flags & STATE_COMPACT) ?
+                 timecnt * sizeof * sp->atdeltas : 0;
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    sp = (struct state *) calloc(1, sizeof * sp +
+                                 leapcnt * sizeof * sp->lsis +
+                                 atssize +
+                                 eytzsize +
+                                 typecnt * sizeof * sp->ttis +
+                                 deltassize +
+                                 eytzidxsize +
+                                 timecnt * sizeof * sp->types +
+                                 charsize);
+    if (sp == NULL) {
+        return NULL;
+    }
+    p = (char *)(sp + 1);
+    sp->refcount = 1;
+    sp->lsis = (struct lsinfo *) p;
+    p += leapcnt * sizeof * sp->lsis;
+    sp->ats = (flags & STATE_COMPACT) ? NULL : (time_t *) p;
+    p += atssize;
+    sp->eytz = (flags & STATE_INDEXED) ? (time_t *) p : NULL;
+    p += eytzsize;
+    sp->ttis = (struct ttinfo *) p;
+    p += typecnt * sizeof * sp->ttis;
+#ifdef TZ_COMPACT_TRANSITIONS
+    sp->atdeltas = (flags & STATE_COMPACT) ? (uint_least32_t *) p : NULL;
+    p += deltassize;
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    sp->eytzidx = (flags & STATE_INDEXED) ? (unsigned short *) p : NULL;
+    p += eytzidxsize;
+    sp->types = (unsigned char *) p;
+    p += timecnt * sizeof * sp->types;
+    sp->chars = p;
+    return sp;
+}
+
+/*
+** A state big enough for anything tzload and tzparse may put into it.
+*/
+
+static struct state *
+state_scratch()
+{
+    return state_alloc(TZ_MAX_TIMES, TZ_MAX_TYPES, TZ_CHARS_SIZE,
+                       TZ_MAX_LEAPS, 0);
+}
+
+/*
+** Copy a state built in scratch space into a right-sized one.
+*/
+
+static struct state *
+state_shrink(sp)
+register const struct state *const sp;
+{
+    register struct state  *result;
+    register int            flags;
+    register int            compact;
+    register int            i;
+
+    compact = FALSE;
+#ifdef TZ_COMPACT_TRANSITIONS
+    if (sp->timecnt > 0) {
+        const time_t    span = sp->ats[sp->timecnt - 1] - sp->ats[0];
+
+        compact = span >= 0 && (time_t)(uint_least32_t) span == span;
+    }
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    flags = compact ? STATE_COMPACT : 0;
+    if (sp->timecnt >= TZ_EYTZINGER_MIN) {
+        flags |= STATE_INDEXED;
+    }
+    /*
+    ** There is always at least one type and the abbreviation it refers to,
+    ** even for the fast GMT state built by tz_alloc.
+    */
+    result = state_alloc(sp->timecnt, BIGGEST(sp->typecnt, 1),
+                         sp->charcnt + 1, sp->leapcnt, flags);
+    if (result == NULL) {
+        return NULL;
+    }
+    result->leapcnt = sp->leapcnt;
+    result->timecnt = sp->timecnt;
+    result->typecnt = sp->typecnt;
+    result->charcnt = sp->charcnt;
+    result->goback = sp->goback;
+    result->goahead = sp->goahead;
+    result->hasrule = sp->hasrule;
+    result->ruletypes[0] = sp->ruletypes[0];
+    result->ruletypes[1] = sp->ruletypes[1];
+    result->rulestart = sp->rulestart;
+    result->ruleend = sp->ruleend;
+    if (!compact) {
+        (void) memcpy(result->ats, sp->ats,
+                      sp->timecnt * sizeof * sp->ats);
+    }
+#ifdef TZ_COMPACT_TRANSITIONS
+    else {
+        result->atbase = sp->ats[0];
+        for (i = 0; i < sp->timecnt; ++i) {
+            result->atdeltas[i] =
+                (uint_least32_t)(sp->ats[i] - result->atbase);
+        }
+    }
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    (void) memcpy(result->types, sp->types,
+                  sp->timecnt * sizeof * sp->types);
+    for (i = 0; i < BIGGEST(sp->typecnt, 1); ++i) {
+        result->ttis[i] = sp->ttis[i];
+    }
+    (void) memcpy(result->chars, sp->chars, sp->charcnt);
+    result->chars[sp->charcnt] = '\0';
+    (void) memcpy(result->lsis, sp->lsis,
+                  sp->leapcnt * sizeof * sp->lsis);
+    state_finish(result, sp->ats);
+    return result;
+}
+
+/*
+** Compute what a state derives from its data once they are complete: the
+** range of its UTC offsets and, if there is room for it, the eytz index of
+** the transition times ats.
+*/
+
+static void
+state_finish(sp, ats)
+register struct state *const   sp;
+register const time_t *const   ats;
+{
+    register int    i;
+
+    sp->mingmtoff = sp->maxgmtoff = sp->ttis[0].tt_gmtoff;
+    for (i = 1; i < sp->typecnt; ++i) {
+        if (sp->ttis[i].tt_gmtoff < sp->mingmtoff) {
+            sp->mingmtoff = sp->ttis[i].tt_gmtoff;
+        }
+        if (sp->ttis[i].tt_gmtoff > sp->maxgmtoff) {
+            sp->maxgmtoff = sp->ttis[i].tt_gmtoff;
+        }
+    }
+    if (sp->eytz != NULL) {
+        (void) eytzinger_fill(sp, ats, 0, 1);
+    }
+}
+
+/*
+** Copy the data of a loaded state into a scratch one, as tzparse builds on
+** the rules of TZDEFRULES.
+*/
+
+static void
+state_copy(sp, from)
+register struct state *const       sp;
+register const struct state *const from;
+{
+    register int    i;
+
+    sp->leapcnt = from->leapcnt;
+    sp->timecnt = from->timecnt;
+    sp->typecnt = from->typecnt;
+    sp->charcnt = from->charcnt;
+    sp->goback = from->goback;
+    sp->goahead = from->goahead;
+    for (i = 0; i < from->timecnt; ++i) {
+        sp->ats[i] = STATE_AT(from, i);
+        sp->types[i] = from->types[i];
+    }
+    for (i = 0; i < from->typecnt; ++i) {
+        sp->ttis[i] = from->ttis[i];
+    }
+    (void) memcpy(sp->chars, from->chars, from->charcnt + 1);
+    for (i = 0; i < from->leapcnt; ++i) {
+        sp->lsis[i] = from->lsis[i];
+    }
+}
+
+#ifdef TZ_EMBEDDED_DATA
+
 static int
-tzload(name, sp, doextend)
-register const char        *name;
+tzdata_compare(key, entry)
+const void *const  key;
+const void *const  entry;
+{
+    return strcmp((const char *) key,
+                  ((const struct tzdata_entry *) entry)->name);
+}
+
+/*
+** Find a zone of the compiled-in database by its name relative to TZDIR.
+*/
+
+static const struct tzdata_entry *
+tzdata_find(name)
+const char *const  name;
+{
+    return (const struct tzdata_entry *) bsearch(name, tzdata_index,
+            tzdata_count, sizeof * tzdata_index, tzdata_compare);
+}
+
+#endif /* defined TZ_EMBEDDED_DATA */
+
+/*
+** Lay the sorted ats out in sp->eytz in the order of breadth-first traversal
+** of the implicit binary search tree rooted at k = 1, with children 2k and
+** 2k + 1: the search then touches memory front to back, and the top levels
+** of the tree share a few cache lines. Returns the index in ats of the next
+** element to place, starting with i for the subtree rooted at k.
+*/
+
+static int
+eytzinger_fill(sp, ats, i, k)
 register struct state *const   sp;
+register const time_t *const   ats;
+register int            i;
+register const int      k;
+{
+    if (k <= sp->timecnt) {
+        i = eytzinger_fill(sp, ats, i, 2 * k);
+        sp->eytz[k] = ats[i];
+        sp->eytzidx[k] = (unsigned short) i;
+        ++i;
+        i = eytzinger_fill(sp, ats, i, 2 * k + 1);
+    }
+    return i;
+}
+
+/*
+** Load a zone by its name, NULL for TZDEFAULT, into a state of its own.
+** Returns NULL if the zone can not be loaded.
+*/
+
+static struct state *
+tzload(name, doextend)
+register const char        *name;
 register const int      doextend;
 {
     register const char        *p;
-    register int            i;
     register int            fid;
-    register int            stored;
-    register int            nread;
-    typedef union {
-        struct tzhead   tzhead;
-        char        buf[2 * sizeof(struct tzhead) +
-                        2 * sizeof *sp +
-                        4 * TZ_MAX_TIMES];
-    } u_t;
-#ifdef ALL_STATE
-    register u_t           *up;
+    register struct state      *result;
+    struct stat         st;
+    size_t              size;
+    void               *map;
 
-    up = (u_t *) calloc(1, sizeof * up);
-    if (up == NULL) {
-        return -1;
-    }
-#else /* !defined ALL_STATE */
-    u_t             u;
-    register u_t *const        up = &u;
-#endif /* !defined ALL_STATE */
-
-    sp->goback = sp->goahead = FALSE;
     if (name == NULL && (name = TZDEFAULT) == NULL) {
-        goto oops;
+        return NULL;
     }
     {
         register int    doaccess;
@@ -299,13 +664,27 @@ register const int      doextend;
         if (name[0] == ':') {
             ++name;
         }
+#ifdef TZ_EMBEDDED_DATA
+        /*
+        ** Relative names are resolved from the compiled-in database
+        ** first, the files under TZDIR are only a fallback.
+        */
+        if (name[0] != '/') {
+            register const struct tzdata_entry *ep = tzdata_find(name);
+
+            if (ep != NULL) {
+                return tzdecode((const char *) tzdata_blob + ep->offset,
+                                (size_t) ep->size, doextend);
+            }
+        }
+#endif /* defined TZ_EMBEDDED_DATA */
         doaccess = name[0] == '/';
         if (!doaccess) {
             if ((p = TZDIR) == NULL) {
-                goto oops;
+                return NULL;
             }
             if ((strlen(p) + strlen(name) + 1) >= sizeof fullname) {
-                goto oops;
+                return NULL;
             }
             (void) strcpy(fullname, p);
             (void) strcat(fullname, "/");
@@ -319,193 +698,292 @@ register const int      doextend;
             name = fullname;
         }
         if (doaccess && access(name, R_OK) != 0) {
-            goto oops;
+            return NULL;
         }
         if ((fid = open(name, OPEN_MODE)) == -1) {
-            goto oops;
+            return NULL;
         }
     }
-    nread = read(fid, up->buf, sizeof up->buf);
-    if (close(fid) < 0 || nread <= 0) {
-        goto oops;
-    }
-    for (stored = 4; stored <= 8; stored *= 2) {
-        int     ttisstdcnt;
-        int     ttisgmtcnt;
-
-        ttisstdcnt = (int) detzcode(up->tzhead.tzh_ttisstdcnt);
-        ttisgmtcnt = (int) detzcode(up->tzhead.tzh_ttisgmtcnt);
-        sp->leapcnt = (int) detzcode(up->tzhead.tzh_leapcnt);
-        sp->timecnt = (int) detzcode(up->tzhead.tzh_timecnt);
-        sp->typecnt = (int) detzcode(up->tzhead.tzh_typecnt);
-        sp->charcnt = (int) detzcode(up->tzhead.tzh_charcnt);
-        p = up->tzhead.tzh_charcnt + sizeof up->tzhead.tzh_charcnt;
-        if (sp->leapcnt < 0 || sp->leapcnt > TZ_MAX_LEAPS ||
-                sp->typecnt <= 0 || sp->typecnt > TZ_MAX_TYPES ||
-                sp->timecnt < 0 || sp->timecnt > TZ_MAX_TIMES ||
-                sp->charcnt < 0 || sp->charcnt > TZ_MAX_CHARS ||
-                (ttisstdcnt != sp->typecnt && ttisstdcnt != 0) ||
-                (ttisgmtcnt != sp->typecnt && ttisgmtcnt != 0)) {
-            goto oops;
+    /*
+    ** The file is mapped rather than read, so that it is decoded in place
+    ** without a file-sized buffer.
+    */
+    if (fstat(fid, &st) != 0 || st.st_size <= 0 ||
+            (uintmax_t) st.st_size > (size_t) -1) {
+        (void) close(fid);
+        return NULL;
+    }
+    size = (size_t) st.st_size;
+    map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fid, 0);
+    if (close(fid) < 0 || map == MAP_FAILED) {
+        if (map != MAP_FAILED) {
+            (void) munmap(map, size);
         }
-        if (nread - (p - up->buf) <
-                sp->timecnt * stored +      /* ats */
-                sp->timecnt +           /* types */
-                sp->typecnt * 6 +       /* ttinfos */
-                sp->charcnt +           /* chars */
-                sp->leapcnt * (stored + 4) +    /* lsinfos */
-                ttisstdcnt +            /* ttisstds */
-                ttisgmtcnt) {       /* ttisgmts */
-            goto oops;
+        return NULL;
+    }
+    result = tzdecode((const char *) map, size, doextend);
+    (void) munmap(map, size);
+    return result;
+}
+
+/*
+** Decode the size bytes of zoneinfo file data, which are only read, into a
+** state allocated for exactly the counts given by the header of the data
+** block decoded. Returns NULL if the data are malformed.
+*/
+
+static struct state *
+tzdecode(data, size, doextend)
+const char *const      data;
+const size_t            size;
+register const int      doextend;
+{
+    register const char        *p;
+    register const char        *rest;
+    register struct state      *sp;
+    register struct state      *tsp;
+    register int            i;
+    register int            stored;
+    const char *const      end = data + size;
+    const struct tzhead        *hp;
+    int             leapcnt;
+    int             timecnt;
+    int             typecnt;
+    int             charcnt;
+    int             ttisstdcnt;
+    int             ttisgmtcnt;
+    int             ruletimecnt;
+    size_t              datasize;
+    char                rule[TZ_STRLEN_MAX + 1];
+
+    /*
+    ** Validate the headers up to the data block to be decoded. The 32-bit
+    ** data of a version 2 file are superseded by the 64-bit data following
+    ** them, so there is no point in decoding them on a wide time_t system.
+    */
+    hp = (const struct tzhead *) data;
+    for (stored = 4; ; stored *= 2) {
+        if ((size_t)(end - (const char *) hp) < sizeof * hp ||
+                memcmp(hp->tzh_magic, TZ_MAGIC, sizeof hp->tzh_magic) != 0) {
+            return NULL;
         }
-        for (i = 0; i < sp->timecnt; ++i) {
-            sp->ats[i] = (stored == 4) ?
-                         detzcode(p) : detzcode64(p);
-            p += stored;
+        ttisstdcnt = (int) detzcode(hp->tzh_ttisstdcnt);
+        ttisgmtcnt = (int) detzcode(hp->tzh_ttisgmtcnt);
+        leapcnt = (int) detzcode(hp->tzh_leapcnt);
+        timecnt = (int) detzcode(hp->tzh_timecnt);
+        typecnt = (int) detzcode(hp->tzh_typecnt);
+        charcnt = (int) detzcode(hp->tzh_charcnt);
+        p = hp->tzh_charcnt + sizeof hp->tzh_charcnt;
+        if (leapcnt < 0 || leapcnt > TZ_MAX_LEAPS ||
+                typecnt <= 0 || typecnt > TZ_MAX_TYPES ||
+                timecnt < 0 || timecnt > TZ_MAX_TIMES ||
+                charcnt < 0 || charcnt > TZ_MAX_CHARS ||
+                (ttisstdcnt != typecnt && ttisstdcnt != 0) ||
+                (ttisgmtcnt != typecnt && ttisgmtcnt != 0)) {
+            return NULL;
         }
-        for (i = 0; i < sp->timecnt; ++i) {
-            sp->types[i] = (unsigned char) * p++;
-            if (sp->types[i] >= sp->typecnt) {
-                goto oops;
-            }
+        datasize = timecnt * stored +       /* ats */
+                   timecnt +            /* types */
+                   typecnt * 6 +        /* ttinfos */
+                   charcnt +            /* chars */
+                   leapcnt * (stored + 4) +     /* lsinfos */
+                   ttisstdcnt +             /* ttisstds */
+                   ttisgmtcnt;              /* ttisgmts */
+        if ((size_t)(end - p) < datasize) {
+            return NULL;
         }
-        for (i = 0; i < sp->typecnt; ++i) {
-            register struct ttinfo     *ttisp;
+        if (stored == 4 && hp->tzh_version[0] != '\0' &&
+                (int) sizeof(time_t) > stored && TYPE_INTEGRAL(time_t)) {
+            hp = (const struct tzhead *)(p + datasize);
+            continue;
+        }
+        break;
+    }
+    rest = (hp->tzh_version[0] != '\0') ? p + datasize : NULL;
 
-            ttisp = &sp->ttis[i];
-            ttisp->tt_gmtoff = detzcode(p);
-            p += 4;
-            ttisp->tt_isdst = (unsigned char) * p++;
-            if (ttisp->tt_isdst != 0 && ttisp->tt_isdst != 1) {
-                goto oops;
-            }
-            ttisp->tt_abbrind = (unsigned char) * p++;
-            if (ttisp->tt_abbrind < 0 ||
-                    ttisp->tt_abbrind > sp->charcnt) {
-                goto oops;
-            }
+    /*
+    ** A version 2 file ends with a POSIX TZ string between newlines, which
+    ** is copied out because tzparse needs it terminated. It is parsed
+    ** first, so that the state is allocated with room for its types and
+    ** abbreviations; tzparse itself needs a scratch state of full capacity.
+    */
+    tsp = NULL;
+    ruletimecnt = 0;
+    if (doextend && rest != NULL && end - rest > 2 &&
+            end - rest - 2 <= TZ_STRLEN_MAX &&
+            rest[0] == '\n' && end[-1] == '\n' &&
+            typecnt + 2 <= TZ_MAX_TYPES) {
+        if ((tsp = state_scratch()) == NULL) {
+            return NULL;
         }
-        for (i = 0; i < sp->charcnt; ++i) {
-            sp->chars[i] = *p++;
+        (void) memcpy(rule, rest + 1, end - rest - 2);
+        rule[end - rest - 2] = '\0';
+        if (tzparse(rule, tsp, FALSE) != 0 || tsp->typecnt != 2 ||
+                charcnt + tsp->charcnt > TZ_MAX_CHARS) {
+            free(tsp);
+            tsp = NULL;
+        } else if (!tsp->hasrule) {
+            /*
+            ** At most this many of the transitions of the rule are
+            ** appended, those later than the explicit ones.
+            */
+            ruletimecnt = tsp->timecnt < TZ_MAX_TIMES - timecnt ?
+                          tsp->timecnt : TZ_MAX_TIMES - timecnt;
+        }
+    }
+
+    sp = state_alloc(timecnt + ruletimecnt,
+                     typecnt + (tsp != NULL ? 2 : 0),
+                     charcnt + (tsp != NULL ? tsp->charcnt : 0) + 1,
+                     leapcnt,
+                     timecnt + ruletimecnt >= TZ_EYTZINGER_MIN ?
+                     STATE_INDEXED : 0);
+    if (sp == NULL) {
+        free(tsp);
+        return NULL;
+    }
+    sp->leapcnt = leapcnt;
+    sp->timecnt = timecnt;
+    sp->typecnt = typecnt;
+    sp->charcnt = charcnt;
+    sp->goback = sp->goahead = sp->hasrule = FALSE;
+
+    for (i = 0; i < sp->timecnt; ++i) {
+        sp->ats[i] = (stored == 4) ?
+                     detzcode(p) : detzcode64(p);
+        p += stored;
+    }
+    for (i = 0; i < sp->timecnt; ++i) {
+        sp->types[i] = (unsigned char) * p++;
+        if (sp->types[i] >= sp->typecnt) {
+            goto oops;
         }
-        sp->chars[i] = '\0';    /* ensure '\0' at end */
-        for (i = 0; i < sp->leapcnt; ++i) {
-            register struct lsinfo     *lsisp;
+    }
+    for (i = 0; i < sp->typecnt; ++i) {
+        register struct ttinfo     *ttisp;
 
-            lsisp = &sp->lsis[i];
-            lsisp->ls_trans = (stored == 4) ?
-                              detzcode(p) : detzcode64(p);
-            p += stored;
-            lsisp->ls_corr = detzcode(p);
-            p += 4;
+        ttisp = &sp->ttis[i];
+        ttisp->tt_gmtoff = detzcode(p);
+        p += 4;
+        ttisp->tt_isdst = (unsigned char) * p++;
+        if (ttisp->tt_isdst != 0 && ttisp->tt_isdst != 1) {
+            goto oops;
         }
-        for (i = 0; i < sp->typecnt; ++i) {
-            register struct ttinfo     *ttisp;
+        ttisp->tt_abbrind = (unsigned char) * p++;
+        if (ttisp->tt_abbrind < 0 ||
+                ttisp->tt_abbrind > sp->charcnt) {
+            goto oops;
+        }
+    }
+    for (i = 0; i < sp->charcnt; ++i) {
+        sp->chars[i] = *p++;
+    }
+    sp->chars[i] = '\0';    /* ensure '\0' at end */
+    for (i = 0; i < sp->leapcnt; ++i) {
+        register struct lsinfo     *lsisp;
 
-            ttisp = &sp->ttis[i];
-            if (ttisstdcnt == 0) {
-                ttisp->tt_ttisstd = FALSE;
-            } else {
-                ttisp->tt_ttisstd = *p++;
-                if (ttisp->tt_ttisstd != TRUE &&
-                        ttisp->tt_ttisstd != FALSE) {
-                    goto oops;
-                }
+        lsisp = &sp->lsis[i];
+        lsisp->ls_trans = (stored == 4) ?
+                          detzcode(p) : detzcode64(p);
+        p += stored;
+        lsisp->ls_corr = detzcode(p);
+        p += 4;
+    }
+    for (i = 0; i < sp->typecnt; ++i) {
+        register struct ttinfo     *ttisp;
+
+        ttisp = &sp->ttis[i];
+        if (ttisstdcnt == 0) {
+            ttisp->tt_ttisstd = FALSE;
+        } else {
+            ttisp->tt_ttisstd = *p++;
+            if (ttisp->tt_ttisstd != TRUE &&
+                    ttisp->tt_ttisstd != FALSE) {
+                goto oops;
             }
         }
-        for (i = 0; i < sp->typecnt; ++i) {
-            register struct ttinfo     *ttisp;
+    }
+    for (i = 0; i < sp->typecnt; ++i) {
+        register struct ttinfo     *ttisp;
 
-            ttisp = &sp->ttis[i];
-            if (ttisgmtcnt == 0) {
-                ttisp->tt_ttisgmt = FALSE;
-            } else {
-                ttisp->tt_ttisgmt = *p++;
-                if (ttisp->tt_ttisgmt != TRUE &&
-                        ttisp->tt_ttisgmt != FALSE) {
-                    goto oops;
-                }
+        ttisp = &sp->ttis[i];
+        if (ttisgmtcnt == 0) {
+            ttisp->tt_ttisgmt = FALSE;
+        } else {
+            ttisp->tt_ttisgmt = *p++;
+            if (ttisp->tt_ttisgmt != TRUE &&
+                    ttisp->tt_ttisgmt != FALSE) {
+                goto oops;
             }
         }
-        /*
-        ** Out-of-sort ats should mean we're running on a
-        ** signed time_t system but using a data file with
-        ** unsigned values (or vice versa).
-        */
-        for (i = 0; i < sp->timecnt - 2; ++i)
-            if (sp->ats[i] > sp->ats[i + 1]) {
-                ++i;
-                if (TYPE_SIGNED(time_t)) {
-                    /*
-                    ** Ignore the end (easy).
-                    */
-                    sp->timecnt = i;
-                } else {
-                    /*
-                    ** Ignore the beginning (harder).
-                    */
-                    register int    j;
+    }
+    /*
+    ** Out-of-sort ats should mean we're running on a
+    ** signed time_t system but using a data file with
+    ** unsigned values (or vice versa).
+    */
+    for (i = 0; i < sp->timecnt - 2; ++i)
+        if (sp->ats[i] > sp->ats[i + 1]) {
+            ++i;
+            if (TYPE_SIGNED(time_t)) {
+                /*
+                ** Ignore the end (easy).
+                */
+                sp->timecnt = i;
+            } else {
+                /*
+                ** Ignore the beginning (harder).
+                */
+                register int    j;
 
-                    for (j = 0; j + i < sp->timecnt; ++j) {
-                        sp->ats[j] = sp->ats[j + i];
-                        sp->types[j] = sp->types[j + i];
-                    }
-                    sp->timecnt = j;
+                for (j = 0; j + i < sp->timecnt; ++j) {
+                    sp->ats[j] = sp->ats[j + i];
+                    sp->types[j] = sp->types[j + i];
                 }
-                break;
+                sp->timecnt = j;
             }
-        /*
-        ** If this is an old file, we're done.
-        */
-        if (up->tzhead.tzh_version[0] == '\0') {
             break;
         }
-        nread -= p - up->buf;
-        for (i = 0; i < nread; ++i) {
-            up->buf[i] = p[i];
-        }
+    if (tsp != NULL) {
+        for (i = 0; i < 2; ++i)
+            tsp->ttis[i].tt_abbrind +=
+                sp->charcnt;
+        for (i = 0; i < tsp->charcnt; ++i)
+            sp->chars[sp->charcnt++] =
+                tsp->chars[i];
         /*
-        ** If this is a narrow integer time_t system, we're done.
+        ** The transitions of a rule are not stored, they are
+        ** computed for the year of the time looked up.
         */
-        if (stored >= (int) sizeof(time_t) && TYPE_INTEGRAL(time_t)) {
-            break;
-        }
-    }
-    if (doextend && nread > 2 &&
-            up->buf[0] == '\n' && up->buf[nread - 1] == '\n' &&
-            sp->typecnt + 2 <= TZ_MAX_TYPES) {
-        struct state    ts;
-        register int    result;
-
-        up->buf[nread - 1] = '\0';
-        result = tzparse(&up->buf[1], &ts, FALSE);
-        if (result == 0 && ts.typecnt == 2 &&
-                sp->charcnt + ts.charcnt <= TZ_MAX_CHARS) {
-            for (i = 0; i < 2; ++i)
-                ts.ttis[i].tt_abbrind +=
-                    sp->charcnt;
-            for (i = 0; i < ts.charcnt; ++i)
-                sp->chars[sp->charcnt++] =
-                    ts.chars[i];
+        if (tsp->hasrule) {
+            sp->hasrule = TRUE;
+            sp->ruletypes[0] = sp->typecnt + tsp->ruletypes[0];
+            sp->ruletypes[1] = sp->typecnt + tsp->ruletypes[1];
+            sp->rulestart = tsp->rulestart;
+            sp->ruleend = tsp->ruleend;
+            i = tsp->timecnt;
+        } else {
             i = 0;
-            while (i < ts.timecnt &&
-                    ts.ats[i] <=
-                    sp->ats[sp->timecnt - 1]) {
-                ++i;
-            }
-            while (i < ts.timecnt &&
-                    sp->timecnt < TZ_MAX_TIMES) {
-                sp->ats[sp->timecnt] =
-                    ts.ats[i];
-                sp->types[sp->timecnt] =
-                    sp->typecnt +
-                    ts.types[i];
-                ++sp->timecnt;
-                ++i;
-            }
-            sp->ttis[sp->typecnt++] = ts.ttis[0];
-            sp->ttis[sp->typecnt++] = ts.ttis[1];
         }
+        while (i < tsp->timecnt && sp->timecnt > 0 &&
+                tsp->ats[i] <=
+                sp->ats[sp->timecnt - 1]) {
+            ++i;
+        }
+        while (i < tsp->timecnt &&
+                sp->timecnt < timecnt + ruletimecnt) {
+            sp->ats[sp->timecnt] =
+                tsp->ats[i];
+            sp->types[sp->timecnt] =
+                sp->typecnt +
+                tsp->types[i];
+            ++sp->timecnt;
+            ++i;
+        }
+        sp->ttis[sp->typecnt++] = tsp->ttis[0];
+        sp->ttis[sp->typecnt++] = tsp->ttis[1];
+        free(tsp);
+        tsp = NULL;
     }
     if (sp->timecnt > 1) {
         for (i = 1; i < sp->timecnt; ++i)
@@ -514,7 +992,7 @@ register const int      doextend;
                 sp->goback = TRUE;
                 break;
             }
-        for (i = sp->timecnt - 2; i >= 0; --i)
+        for (i = sp->timecnt - 2; i >= 0 && !sp->hasrule; --i)
             if (typesequiv(sp, sp->types[sp->timecnt - 1],
                            sp->types[i]) &&
                     differ_by_repeat(sp->ats[sp->timecnt - 1],
@@ -523,15 +1001,35 @@ register const int      doextend;
                 break;
             }
     }
-#ifdef ALL_STATE
-    (void) free((void *) up);
-#endif /* defined ALL_STATE */
-    return 0;
+    if (sp->timecnt < TZ_EYTZINGER_MIN) {
+        /*
+        ** Out-of-sort transitions have been dropped.
+        */
+        sp->eytz = NULL;
+        sp->eytzidx = NULL;
+    }
+    state_finish(sp, sp->ats);
+#ifdef TZ_COMPACT_TRANSITIONS
+    /*
+    ** Transition times are repacked as 32-bit deltas when their span fits,
+    ** which takes a copy of the state.
+    */
+    if (sp->timecnt > 0) {
+        const time_t    span = sp->ats[sp->timecnt - 1] - sp->ats[0];
+
+        if (span >= 0 && (time_t)(uint_least32_t) span == span) {
+            tsp = state_shrink(sp);
+            free(sp);
+            return tsp;
+        }
+    }
+#endif /* defined TZ_COMPACT_TRANSITIONS */
+    return sp;
+
 oops:
-#ifdef ALL_STATE
-    (void) free((void *) up);
-#endif /* defined ALL_STATE */
-    return -1;
+    free(tsp);
+    free(sp);
+    return NULL;
 }
 
 static int
@@ -904,6 +1402,7 @@ const int           lastditch;
     register unsigned char     *typep;
     register char          *cp;
     register int            load_result;
+    register struct state      *lsp;
     static struct ttinfo        zttinfo;
 
     INITIALIZE(dstname);
@@ -911,8 +1410,8 @@ const int           lastditch;
     if (lastditch) {
         stdlen = strlen(name);  /* length of standard zone name */
         name += stdlen;
-        if (stdlen >= sizeof sp->chars) {
-            stdlen = (sizeof sp->chars) - 1;
+        if (stdlen >= TZ_CHARS_SIZE) {
+            stdlen = TZ_CHARS_SIZE - 1;
         }
         stdoffset = 0;
     } else {
@@ -937,8 +1436,12 @@ const int           lastditch;
             return -1;
         }
     }
-    load_result = tzload(TZDEFRULES, sp, FALSE);
-    if (load_result != 0) {
+    lsp = tzload(TZDEFRULES, FALSE);
+    load_result = (lsp != NULL) ? 0 : -1;
+    if (lsp != NULL) {
+        state_copy(sp, lsp);
+        tz_free(lsp);
+    } else {
         sp->leapcnt = 0;    /* so, we're off a little */
     }
     if (*name != '\0') {
@@ -988,8 +1491,15 @@ const int           lastditch;
                 return -1;
             }
             sp->typecnt = 2;    /* standard time and DST */
+            sp->hasrule = TYPE_BIT(time_t) - TYPE_SIGNED(time_t) >=
+                          SECSPERREPEAT_BITS;
+            sp->ruletypes[0] = 0;
+            sp->ruletypes[1] = 1;
+            sp->rulestart = start;
+            sp->ruleend = end;
             /*
-            ** Two transitions per year, from EPOCH_YEAR forward.
+            ** Two transitions per year, from EPOCH_YEAR forward; later
+            ** times are left to the rule.
             */
             sp->ttis[0] = sp->ttis[1] = zttinfo;
             sp->ttis[0].tt_gmtoff = -dstoffset;
@@ -1132,7 +1642,7 @@ const int           lastditch;
     if (dstlen != 0) {
         sp->charcnt += dstlen + 1;
     }
-    if ((size_t) sp->charcnt > sizeof sp->chars) {
+    if ((size_t) sp->charcnt > TZ_CHARS_SIZE) {
         return -1;
     }
     cp = sp->chars;
@@ -1146,39 +1656,71 @@ const int           lastditch;
     return 0;
 }
 
+/*
+** Load the state used by gmtsub on first use; gmtptr stays NULL if that
+** fails, which the callers are prepared for.
+*/
+
 static void
-gmtload(sp)
-struct state *const    sp;
+gmtcheck()
 {
-    if (tzload(gmt, sp, TRUE) != 0) {
-        (void) tzparse(gmt, sp, TRUE);
+    if (gmt_is_set) {
+        return;
     }
+    gmt_is_set = TRUE;
+    gmtptr = gmtload();
 }
 
-void
-tzsetwall(sp)
-register struct state *const sp;
+static struct state *
+gmtload()
 {
-    if (tzload((char *) NULL, sp, TRUE) != 0) {
-        gmtload(sp);
+    register struct state  *sp;
+    register struct state  *result;
+
+    if ((result = tzload(gmt, TRUE)) != NULL) {
+        return result;
     }
+    if ((sp = state_scratch()) == NULL) {
+        return NULL;
+    }
+    (void) tzparse(gmt, sp, TRUE);
+    result = state_shrink(sp);
+    free(sp);
+    return result;
 }
 
+/*
+** Zoneinfo files are decoded straight into a state of their size, the
+** states of POSIX TZ strings are built in scratch space and then copied
+** into an allocation holding exactly what the zone needs.
+*/
+
 const struct state *
 tz_alloc(name)
 register const char *name;
 {
-    register struct state *const sp = malloc(sizeof(struct state));
-
-    if (sp == NULL) {
-        return sp;
-    }
+    register struct state  *sp;
+    register struct state  *result;
 
     if (name == NULL) {
-        tzsetwall(sp);
-        return sp;
+        if ((result = tzload((char *) NULL, TRUE)) == NULL) {
+            result = gmtload();
+        }
+        return result;
+    }
+    if (*name != '\0') {
+        if ((result = tzload(name, TRUE)) != NULL) {
+            return result;
+        }
+        if (name[0] == ':') {
+            return gmtload();
+        }
     }
 
+    sp = state_scratch();
+    if (sp == NULL) {
+        return NULL;
+    }
     if (*name == '\0') {
         /*
         ** User wants it fast rather than right.
@@ -1190,17 +1732,36 @@ register const char *name;
         sp->ttis[0].tt_gmtoff = 0;
         sp->ttis[0].tt_abbrind = 0;
         (void) strcpy(sp->chars, gmt);
-    } else if (tzload(name, sp, TRUE) != 0)
-        if (name[0] == ':' || tzparse(name, sp, FALSE) != 0) {
-            (void) gmtload(sp);
-        }
+        sp->charcnt = sizeof gmt;
+    } else if (tzparse(name, sp, FALSE) != 0) {
+        free(sp);
+        return gmtload();
+    }
 
+    result = state_shrink(sp);
+    free(sp);
+    return result;
+}
+
+const struct state *
+tz_retain(sp)
+const struct state *const sp;
+{
+    if (sp != NULL) {
+        (void) __sync_add_and_fetch(&((struct state *) sp)->refcount, 1);
+    }
     return sp;
 }
 
 void tz_free(const struct state *const sp)
 {
-    free((struct state *)sp);
+    if (sp == NULL) {
+        return;
+    }
+    if (__sync_sub_and_fetch(&((struct state *) sp)->refcount, 1) == 0) {
+        free(sp->ruletab);
+        free((struct state *)sp);
+    }
 }
 
 /*
@@ -1220,9 +1781,9 @@ const time_t *const    timep;
 const long      offset;
 struct tm *const   tmp;
 {
-    register const struct ttinfo   *ttisp;
     register int            i;
     register struct tm         *result;
+    register const struct ttinfo   *ttisp;
     const time_t            t = *timep;
 
 #ifdef ALL_STATE
@@ -1230,43 +1791,24 @@ struct tm *const   tmp;
         return gmtsub(timep, offset, tmp);
     }
 #endif /* defined ALL_STATE */
-    if ((sp->goback && t < sp->ats[0]) ||
-            (sp->goahead && t > sp->ats[sp->timecnt - 1])) {
-        time_t          newt = t;
-        register time_t     seconds;
-        register time_t     tcycles;
-        register int_fast64_t   icycles;
-
-        if (t < sp->ats[0]) {
-            seconds = sp->ats[0] - t;
-        } else {
-            seconds = t - sp->ats[sp->timecnt - 1];
-        }
-        --seconds;
-        tcycles = seconds / YEARSPERREPEAT / AVGSECSPERYEAR;
-        ++tcycles;
-        icycles = tcycles;
-        if (tcycles - icycles >= 1 || icycles - tcycles >= 1) {
+    if (STATE_RULED(sp, t)) {
+        ttisp = rule_ttinfo(sp, t);
+        return (ttisp == NULL) ? NULL : localttinfo(sp, timep, ttisp, tmp);
+    }
+    if ((sp->goback && t < STATE_AT(sp, 0)) ||
+            (sp->goahead && t > STATE_AT(sp, sp->timecnt - 1))) {
+        time_t          newt;
+        int_fast64_t        icycles;
+
+        if (!cycle_shift(sp, t, &newt, &icycles)) {
             return NULL;
         }
-        seconds = icycles;
-        seconds *= YEARSPERREPEAT;
-        seconds *= AVGSECSPERYEAR;
-        if (t < sp->ats[0]) {
-            newt += seconds;
-        } else {
-            newt -= seconds;
-        }
-        if (newt < sp->ats[0] ||
-                newt > sp->ats[sp->timecnt - 1]) {
-            return NULL;    /* "cannot happen" */
-        }
         result = localsub(sp, &newt, offset, tmp);
         if (result == tmp) {
             register time_t newy;
 
             newy = tmp->tm_year;
-            if (t < sp->ats[0]) {
+            if (t < STATE_AT(sp, 0)) {
                 newy -= icycles * YEARSPERREPEAT;
             } else {
                 newy += icycles * YEARSPERREPEAT;
@@ -1278,36 +1820,465 @@ struct tm *const   tmp;
         }
         return result;
     }
-    if (sp->timecnt == 0 || t < sp->ats[0]) {
-        i = 0;
-        while (sp->ttis[i].tt_isdst)
-            if (++i >= sp->typecnt) {
-                i = 0;
-                break;
-            }
+    if (sp->timecnt == 0 || t < STATE_AT(sp, 0)) {
+        return localttinfo(sp, timep, first_ttinfo(sp), tmp);
+    }
+    i = (int) sp->types[transition_search(sp, t) - 1];
+    return localttinfo(sp, timep, &sp->ttis[i], tmp);
+}
+
+/*
+** Move t, which is out of the transitions of a state repeating them, by
+** whole 400-year cycles into them. Returns FALSE if it cannot be done.
+*/
+
+static int
+cycle_shift(sp, t, newtp, icyclesp)
+register const struct state *const sp;
+const time_t            t;
+time_t *const           newtp;
+int_fast64_t *const     icyclesp;
+{
+    time_t          newt = t;
+    register time_t     seconds;
+    register time_t     tcycles;
+    register int_fast64_t   icycles;
+
+    if (t < STATE_AT(sp, 0)) {
+        seconds = STATE_AT(sp, 0) - t;
+    } else {
+        seconds = t - STATE_AT(sp, sp->timecnt - 1);
+    }
+    --seconds;
+    tcycles = seconds / YEARSPERREPEAT / AVGSECSPERYEAR;
+    ++tcycles;
+    icycles = tcycles;
+    if (tcycles - icycles >= 1 || icycles - tcycles >= 1) {
+        return FALSE;
+    }
+    seconds = icycles;
+    seconds *= YEARSPERREPEAT;
+    seconds *= AVGSECSPERYEAR;
+    if (t < STATE_AT(sp, 0)) {
+        newt += seconds;
     } else {
-        register int    lo = 1;
-        register int    hi = sp->timecnt;
+        newt -= seconds;
+    }
+    if (newt < STATE_AT(sp, 0) ||
+            newt > STATE_AT(sp, sp->timecnt - 1)) {
+        return FALSE;   /* "cannot happen" */
+    }
+    *newtp = newt;
+    *icyclesp = icycles;
+    return TRUE;
+}
 
-        while (lo < hi) {
-            register int    mid = (lo + hi) >> 1;
+/*
+** Local time type in effect before the first transition: the first
+** standard time one, or the first one if there is no such.
+*/
 
-            if (t < sp->ats[mid]) {
-                hi = mid;
-            } else {
-                lo = mid + 1;
-            }
+static const struct ttinfo *
+first_ttinfo(sp)
+register const struct state *const sp;
+{
+    register int    i = 0;
+
+    while (sp->ttis[i].tt_isdst)
+        if (++i >= sp->typecnt) {
+            i = 0;
+            break;
+        }
+    return &sp->ttis[i];
+}
+
+/*
+** Transitions of the rule of a state in year EPOCH_YEAR + i, DST beginning in
+** ats[0] and ending in ats[1]; 0 <= i < YEARSPERREPEAT.
+*/
+
+static void
+rule_year(sp, i, ats)
+register const struct state *const sp;
+const int           i;
+time_t *const           ats;
+{
+    const time_t    janfirst = (time_t) dt_calendar_days_from_civil(
+                                   EPOCH_YEAR + i, 1, 1) * SECSPERDAY;
+
+    ats[0] = transtime(janfirst, EPOCH_YEAR + i, &sp->rulestart,
+                       -sp->ttis[sp->ruletypes[1]].tt_gmtoff);
+    ats[1] = transtime(janfirst, EPOCH_YEAR + i, &sp->ruleend,
+                       -sp->ttis[sp->ruletypes[0]].tt_gmtoff);
+}
+
+/*
+** The transitions of the rule of a state in the YEARSPERREPEAT years from
+** EPOCH_YEAR on, as rule_year() gives them year by year and in the order
+** tzparse puts them into a table; those of any other year are whole cycles
+** away from them. They are computed on first use, and the first table
+** published is kept by the state, so that threads sharing it see it
+** read-only. NULL if there is no memory for them.
+*/
+
+static const struct ruletable *
+rule_table(sp)
+register const struct state *const sp;
+{
+    register struct ruletable  *tab;
+    register int            i;
+    register int            j;
+    register int            q;
+    struct ruletable       *expected = NULL;
+    time_t              ats[2];
+
+    tab = __atomic_load_n(&sp->ruletab, __ATOMIC_ACQUIRE);
+    if (tab != NULL) {
+        return tab;
+    }
+    tab = (struct ruletable *) malloc(sizeof * tab);
+    if (tab == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < YEARSPERREPEAT; ++i) {
+        rule_year(sp, i, ats);
+        j = ats[0] > ats[1];
+        tab->ats[RULE_PAD + 2 * i] = ats[j];
+        tab->types[RULE_PAD + 2 * i] = (unsigned char) sp->ruletypes[j];
+        tab->ats[RULE_PAD + 2 * i + 1] = ats[1 - j];
+        tab->types[RULE_PAD + 2 * i + 1] =
+            (unsigned char) sp->ruletypes[1 - j];
+    }
+    for (q = 0; q < RULE_PAD; ++q) {
+        j = 2 * YEARSPERREPEAT + RULE_PAD + q;
+        tab->ats[q] = tab->ats[j - RULE_PAD] - (time_t) SECSPERREPEAT;
+        tab->types[q] = tab->types[j - RULE_PAD];
+        tab->ats[j] = tab->ats[RULE_PAD + q] + (time_t) SECSPERREPEAT;
+        tab->types[j] = tab->types[RULE_PAD + q];
+    }
+    if (!__atomic_compare_exchange_n(&((struct state *) sp)->ruletab,
+                                     &expected, tab, FALSE,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        free(tab);
+        tab = expected;
+    }
+    return tab;
+}
+
+/*
+** The last transition of the rule of a state not later than t (!forward) or
+** the first one later than t (forward), with the index of the local time type
+** in effect from it on: the one of the last transition at the same time.
+** Returns FALSE if the transition is out of the range of time_t.
+*/
+
+static int
+rule_search(sp, t, forward, atp, typep)
+register const struct state *const sp;
+const time_t            t;
+const int           forward;
+time_t *const           atp;
+int *const          typep;
+{
+    register const struct ruletable    *tab;
+    register const time_t          *ats;
+    register const unsigned char       *types;
+    register int_fast64_t       cycles;
+    register time_t         r;
+    register int            year;
+    register int            base;
+    register int            n;
+    register int            q;
+    time_t              at;
+    time_t              yats[2];
+    time_t              wats[10];
+    unsigned char           wtypes[10];
+
+    /*
+    ** Cycles begin on January 1 of EPOCH_YEAR + k * YEARSPERREPEAT, and
+    ** average years are off the years of a cycle by a couple of days at
+    ** most, so the transitions around r, the time into the cycle, are
+    ** those of the years around year.
+    */
+    cycles = t / SECSPERREPEAT;
+    if (t % SECSPERREPEAT < 0) {
+        --cycles;
+    }
+    r = (time_t) (t - cycles * SECSPERREPEAT);
+    year = (int) (r / AVGSECSPERYEAR);
+    /*
+    ** ats holds n transitions of the cycle from the one numbered base (0 for
+    ** the first of EPOCH_YEAR) on: the whole table, or those of the years
+    ** around year if there is no table.
+    */
+    if ((tab = rule_table(sp)) != NULL) {
+        ats = tab->ats;
+        types = tab->types;
+        base = -RULE_PAD;
+        n = 2 * YEARSPERREPEAT + 2 * RULE_PAD;
+    } else {
+        for (q = 0; q < 10; q += 2) {
+            register const int  y = year - 2 + q / 2;
+            register const int  i = (y < 0) ? y + YEARSPERREPEAT :
+                                    (y >= YEARSPERREPEAT) ? y - YEARSPERREPEAT : y;
+            register int        k;
+            register time_t     shift;
+
+            rule_year(sp, i, yats);
+            k = yats[0] > yats[1];
+            shift = (time_t) ((y - i) / YEARSPERREPEAT) * (time_t) SECSPERREPEAT;
+            wats[q] = yats[k] + shift;
+            wtypes[q] = (unsigned char) sp->ruletypes[k];
+            wats[q + 1] = yats[1 - k] + shift;
+            wtypes[q + 1] = (unsigned char) sp->ruletypes[1 - k];
+        }
+        ats = wats;
+        types = wtypes;
+        base = 2 * (year - 2);
+        n = 10;
+    }
+    q = 2 * year - base;
+    while (q < n && ats[q] <= r) {
+        ++q;
+    }
+    while (q > 0 && ats[q - 1] > r) {
+        --q;
+    }
+    if (q == 0 || q == n) {
+        return FALSE;   /* "cannot happen" */
+    }
+    if (!forward) {
+        --q;
+    }
+    while (q + 1 < n && ats[q + 1] == ats[q]) {
+        ++q;
+    }
+    *typep = types[q];
+    /*
+    ** The transition is a year from t at most, so t + (ats[q] - r) is out
+    ** of range only next to the limits of time_t.
+    */
+    at = (time_t) ((uint_fast64_t) t + (uint_fast64_t) (ats[q] - r));
+    if ((ats[q] > r) ? at <= t : at > t) {
+        return FALSE;
+    }
+    *atp = at;
+    return TRUE;
+}
+
+/*
+** Local time type in effect at t, which must be later than the transitions
+** of a state with a rule, or NULL if t is too far away to be handled.
+*/
+
+static const struct ttinfo *
+rule_ttinfo(sp, t)
+register const struct state *const sp;
+const time_t            t;
+{
+    time_t  at;
+    int type;
+
+    if (!rule_search(sp, t, FALSE, &at, &type)) {
+        return NULL;
+    }
+    if (sp->timecnt > 0 && at <= STATE_AT(sp, sp->timecnt - 1)) {
+        return &sp->ttis[sp->types[sp->timecnt - 1]];
+    }
+    return &sp->ttis[type];
+}
+
+/*
+** The first transition of the rule of a state later than t (forward) or the
+** last one not later than t (!forward) which changes the local time type,
+** among those later than the transitions of the state, with the types before
+** and after it. Returns FALSE if there is no such transition; the rule repeats
+** every cycle, so there is none if a cycle of transitions changes nothing.
+*/
+
+static int
+rule_transition(sp, t, forward, atp, beforep, afterp)
+register const struct state *const sp;
+time_t              t;
+const int           forward;
+time_t *const           atp;
+const struct ttinfo **const beforep;
+const struct ttinfo **const afterp;
+{
+    register int    n;
+    time_t      at;
+    int     type;
+
+    for (n = 0; n < 2 * YEARSPERREPEAT; ++n) {
+        if (!rule_search(sp, t, forward, &at, &type) ||
+                (sp->timecnt > 0 && at <= STATE_AT(sp, sp->timecnt - 1))) {
+            return FALSE;
+        }
+        *afterp = &sp->ttis[type];
+        *beforep = STATE_RULED(sp, at - 1) ? rule_ttinfo(sp, at - 1) :
+                   &sp->ttis[sp->types[sp->timecnt - 1]];
+        if (*beforep == NULL) {
+            return FALSE;
+        }
+        if (ttinfo_changes(sp, *beforep, *afterp)) {
+            *atp = at;
+            return TRUE;
+        }
+        t = forward ? at : at - 1;
+    }
+    return FALSE;
+}
+
+/*
+** Whether a change from local time type a to b is seen by the callers: the
+** UTC offset, the DST flag or the abbreviation differ.
+*/
+
+static int
+ttinfo_changes(sp, a, b)
+register const struct state *const sp;
+register const struct ttinfo *const    a;
+register const struct ttinfo *const    b;
+{
+    return a->tt_gmtoff != b->tt_gmtoff || a->tt_isdst != b->tt_isdst ||
+           strcmp(&sp->chars[a->tt_abbrind], &sp->chars[b->tt_abbrind]) != 0;
+}
+
+/*
+** The first transition of a state later than t, from its table or from its
+** rule, with the local time type in effect from it on. Returns FALSE if there
+** is none.
+*/
+
+static int
+transition_next(sp, t, atp, ttispp)
+register const struct state *const sp;
+const time_t            t;
+time_t *const           atp;
+const struct ttinfo **const ttispp;
+{
+    register int    k;
+    int     type;
+
+    if (sp->timecnt > 0 && t < STATE_AT(sp, sp->timecnt - 1)) {
+        k = (t < STATE_AT(sp, 0)) ? 0 : transition_search(sp, t);
+        *atp = STATE_AT(sp, k);
+        *ttispp = &sp->ttis[sp->types[k]];
+        return TRUE;
+    }
+    if (!sp->hasrule || !rule_search(sp, t, TRUE, atp, &type)) {
+        return FALSE;
+    }
+    *ttispp = &sp->ttis[type];
+    return TRUE;
+}
+
+/*
+** Index lo of the transition interval [ats[lo - 1], ats[lo]) holding t,
+** which must not be earlier than ats[0]; lo == timecnt for the last one.
+*/
+
+static int
+transition_search(sp, t)
+register const struct state *const sp;
+register const time_t   t;
+{
+    register int    lo = 1;
+    register int    hi = sp->timecnt;
+
+    if (sp->eytz != NULL) {
+        /*
+        ** Descend to a leaf, then back up past the nodes where the
+        ** search went right: what remains is the first element greater
+        ** than t, or 0 if there is none.
+        */
+        register int    k = 1;
+
+        while (k <= sp->timecnt) {
+            k = 2 * k + (sp->eytz[k] <= t);
+        }
+#ifdef __GNUC__
+        k >>= __builtin_ffs(~k);
+#else /* !defined __GNUC__ */
+        while (k & 1) {
+            k >>= 1;
+        }
+        k >>= 1;
+#endif /* !defined __GNUC__ */
+        return (k == 0) ? sp->timecnt : sp->eytzidx[k];
+    }
+    while (lo < hi) {
+        register int    mid = (lo + hi) >> 1;
+
+        if (t < STATE_AT(sp, mid)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/*
+** Hooks comparing the transition search with the plain binary search over
+** ats, for benchmarks and tests. Both return the index of the transition in
+** effect at t, or -1 if t is earlier than the first transition.
+*/
+
+int
+tz_transition_search(sp, t)
+register const struct state *const sp;
+const time_t            t;
+{
+    if (sp->timecnt == 0 || t < STATE_AT(sp, 0)) {
+        return -1;
+    }
+    return transition_search(sp, t) - 1;
+}
+
+int
+tz_transition_bsearch(sp, t)
+register const struct state *const sp;
+const time_t            t;
+{
+    register int    lo = 1;
+    register int    hi = sp->timecnt;
+
+    if (sp->timecnt == 0 || t < STATE_AT(sp, 0)) {
+        return -1;
+    }
+    while (lo < hi) {
+        register int    mid = (lo + hi) >> 1;
+
+        if (t < STATE_AT(sp, mid)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
         }
-        i = (int) sp->types[lo - 1];
     }
-    ttisp = &sp->ttis[i];
+    return lo - 1;
+}
+
+/*
+** Break down *timep by the local time type found for it.
+*/
+
+static struct tm *
+localttinfo(sp, timep, ttisp, tmp)
+register const struct state *const sp;
+const time_t *const            timep;
+register const struct ttinfo *const    ttisp;
+struct tm *const           tmp;
+{
+    register struct tm         *result;
+
     /*
     ** To get (wrong) behavior that's compatible with System V Release 2.0
     ** you'd replace the statement below with
     **  t += ttisp->tt_gmtoff;
     **  timesub(&t, 0L, sp, tmp);
     */
-    result = timesub(&t, ttisp->tt_gmtoff, sp, tmp);
+    result = timesub(timep, ttisp->tt_gmtoff, sp, tmp);
     tmp->tm_isdst = ttisp->tt_isdst;
 #ifdef TM_ZONE
     tmp->TM_ZONE = &sp->chars[ttisp->tt_abbrind];
@@ -1336,6 +2307,308 @@ struct tm      *tmp;
     return localsub(sp, timep, 0L, tmp);
 }
 
+/*
+** Re-entrant version of localtime for a caller keeping the transition
+** interval of the previous call in *hintp (0 if there is none yet). When
+** *timep is still inside of it the search for the interval is skipped and
+** *hitp is set to TRUE, otherwise the interval found is stored to *hintp.
+*/
+
+struct tm *
+tz_localtime_hint_r(sp, timep, tmp, hintp, hitp)
+register const struct state *const sp;
+const time_t *const            timep;
+struct tm              *tmp;
+int *const             hintp;
+int *const             hitp;
+{
+    register const time_t   t = *timep;
+    register int        lo;
+
+    if (sp->timecnt == 0 || STATE_RULED(sp, t)) {
+        *hitp = TRUE;
+        return localsub(sp, timep, 0L, tmp);
+    }
+    if (t < STATE_AT(sp, 0) ||
+            (sp->goahead && t > STATE_AT(sp, sp->timecnt - 1))) {
+        *hitp = FALSE;
+        *hintp = 0;
+        return localsub(sp, timep, 0L, tmp);
+    }
+    lo = transition_hinted(sp, t, hintp, hitp);
+    return localttinfo(sp, timep, &sp->ttis[sp->types[lo - 1]], tmp);
+}
+
+/*
+** Transition interval holding t as transition_search() finds it, trying
+** the interval in *hintp first. t must be inside of the transitions (not
+** earlier than the first one, and not later than the last one if the
+** state repeats them). *hitp tells whether the hint was right.
+*/
+
+static int
+transition_hinted(sp, t, hintp, hitp)
+register const struct state *const sp;
+register const time_t   t;
+int *const          hintp;
+int *const          hitp;
+{
+    register int    lo = *hintp;
+
+    if (lo > 0 && lo <= sp->timecnt && t >= STATE_AT(sp, lo - 1) &&
+            (lo == sp->timecnt || t < STATE_AT(sp, lo))) {
+        *hitp = TRUE;
+        return lo;
+    }
+    *hitp = FALSE;
+    lo = transition_search(sp, t);
+    *hintp = lo;
+    return lo;
+}
+
+/*
+** Local times as seconds since the epoch (t plus the UTC offset in effect)
+** of n times in a row for the callers doing the calendar arithmetic on
+** their own; times must be at least a day away from the limits of time_t.
+** *hintp is kept as by tz_localtime_hint_r(). Returns how many leading
+** times are done, n unless some of them cannot be handled, or -1 if the
+** state has leap seconds and tz_localtime_r() must be used.
+*/
+
+int
+tz_local_seconds(sp, times, locals, n, hintp)
+register const struct state *const sp;
+const time_t *const        times;
+time_t *const          locals;
+const size_t           n;
+int *const             hintp;
+{
+    register const struct ttinfo   *ttisp;
+    register size_t         i;
+
+    if (sp->leapcnt > 0) {
+        return -1;
+    }
+    for (i = 0; i < n; ++i) {
+        if ((ttisp = ttinfo_hinted(sp, times[i], hintp)) == NULL) {
+            break;
+        }
+        locals[i] = times[i] + ttisp->tt_gmtoff;
+    }
+    return (int) i;
+}
+
+/*
+** UTC offsets, DST flags and abbreviations of n times in a row, as localsub()
+** finds them but without breaking the times down; any of the output arrays
+** can be NULL. Abbreviations point into the state. *hintp is kept as by
+** tz_localtime_hint_r(). Returns how many leading times are done, n unless
+** some of them cannot be handled.
+*/
+
+int
+tz_offsets(sp, times, n, gmtoffs, isdsts, abbrs, hintp)
+register const struct state *const sp;
+const time_t *const        times;
+const size_t           n;
+long *const            gmtoffs;
+int *const             isdsts;
+const char **const         abbrs;
+int *const             hintp;
+{
+    register const struct ttinfo   *ttisp;
+    register size_t         i;
+
+    for (i = 0; i < n; ++i) {
+        if ((ttisp = ttinfo_hinted(sp, times[i], hintp)) == NULL) {
+            break;
+        }
+        if (gmtoffs != NULL) {
+            gmtoffs[i] = ttisp->tt_gmtoff;
+        }
+        if (isdsts != NULL) {
+            isdsts[i] = ttisp->tt_isdst;
+        }
+        if (abbrs != NULL) {
+            abbrs[i] = &sp->chars[ttisp->tt_abbrind];
+        }
+    }
+    return (int) i;
+}
+
+/*
+** Store a transition found by tz_transition() to its output arrays.
+*/
+
+static int
+transition_result(sp, at, before, after, atp, gmtoffs, isdsts, abbrs)
+register const struct state *const sp;
+const time_t            at;
+register const struct ttinfo *const    before;
+register const struct ttinfo *const    after;
+time_t *const           atp;
+long *const         gmtoffs;
+int *const          isdsts;
+const char **const      abbrs;
+{
+    if (atp != NULL) {
+        *atp = at;
+    }
+    if (gmtoffs != NULL) {
+        gmtoffs[0] = before->tt_gmtoff;
+        gmtoffs[1] = after->tt_gmtoff;
+    }
+    if (isdsts != NULL) {
+        isdsts[0] = before->tt_isdst;
+        isdsts[1] = after->tt_isdst;
+    }
+    if (abbrs != NULL) {
+        abbrs[0] = &sp->chars[before->tt_abbrind];
+        abbrs[1] = &sp->chars[after->tt_abbrind];
+    }
+    return TRUE;
+}
+
+/*
+** The first transition later than t (forward) or the last one not later
+** than t (!forward) which changes the UTC offset, the DST flag or the
+** abbreviation, with the local time types before ([0]) and after ([1]) it;
+** any of the output arrays can be NULL. Past the last transition of a state
+** with a rule the transitions are those of the rule, and transitions of states
+** repeating them (goback/goahead) are extrapolated by whole cycles.
+** Returns FALSE if there is no such transition.
+*/
+
+int
+tz_transition(sp, t, forward, atp, gmtoffs, isdsts, abbrs)
+register const struct state *const sp;
+const time_t            t;
+const int           forward;
+time_t *const           atp;
+long *const         gmtoffs;
+int *const          isdsts;
+const char **const      abbrs;
+{
+    const struct ttinfo     *before;
+    const struct ttinfo     *after;
+    register int            i;
+    register int            lo;
+    register int            rounds;
+    time_t              newt = t;
+    time_t              shift = 0;
+    time_t              at;
+    int_fast64_t            icycles;
+
+    if (sp->hasrule && (sp->timecnt == 0 ||
+                        t >= STATE_AT(sp, sp->timecnt - 1))) {
+        /*
+        ** A transition of the rule, unless none of those later than the
+        ** transitions of the state is early enough.
+        */
+        if (rule_transition(sp, t, forward, &at, &before, &after)) {
+            return transition_result(sp, at, before, after, atp,
+                                     gmtoffs, isdsts, abbrs);
+        }
+        if (forward || sp->timecnt == 0) {
+            return FALSE;
+        }
+    }
+    if (sp->timecnt == 0) {
+        return FALSE;
+    }
+    if ((sp->goback && t < STATE_AT(sp, 0)) ||
+            (sp->goahead && t > STATE_AT(sp, sp->timecnt - 1))) {
+        if (!cycle_shift(sp, t, &newt, &icycles)) {
+            return FALSE;
+        }
+        shift = t - newt;
+    }
+    /*
+    ** The transitions of a repeating state are scanned at most twice: once
+    ** from newt to the end of them and once more over the whole cycle.
+    */
+    lo = (newt < STATE_AT(sp, 0)) ? 0 : transition_search(sp, newt);
+    for (rounds = 0; rounds < 2; ++rounds) {
+        i = forward ? lo : lo - 1;
+        while (i >= 0 && i < sp->timecnt) {
+            /*
+            ** The type before the first transition of a state going
+            ** back is the one of the transition a cycle later.
+            */
+            if (i > 0 || !sp->goback) {
+                before = (i == 0) ? first_ttinfo(sp) :
+                         &sp->ttis[sp->types[i - 1]];
+                after = &sp->ttis[sp->types[i]];
+                if (ttinfo_changes(sp, before, after)) {
+                    at = (time_t) ((uint_fast64_t) STATE_AT(sp, i) +
+                                   (uint_fast64_t) shift);
+                    if ((shift > 0 && at < STATE_AT(sp, i)) ||
+                            (shift < 0 && at > STATE_AT(sp, i))) {
+                        return FALSE;
+                    }
+                    return transition_result(sp, at, before, after, atp,
+                                             gmtoffs, isdsts, abbrs);
+                }
+            }
+            i = forward ? i + 1 : i - 1;
+        }
+        /*
+        ** Continue with the rule, or with the same transitions a cycle
+        ** later or earlier.
+        */
+        if (forward && sp->hasrule) {
+            if (!rule_transition(sp, STATE_AT(sp, sp->timecnt - 1), TRUE,
+                                 &at, &before, &after)) {
+                return FALSE;
+            }
+            return transition_result(sp, at, before, after, atp,
+                                     gmtoffs, isdsts, abbrs);
+        } else if (forward && sp->goahead) {
+            shift += (time_t) SECSPERREPEAT;
+            newt = STATE_AT(sp, sp->timecnt - 1) - (time_t) SECSPERREPEAT;
+            lo = transition_search(sp, newt);
+        } else if (!forward && sp->goback) {
+            shift -= (time_t) SECSPERREPEAT;
+            newt = STATE_AT(sp, 0) + (time_t) SECSPERREPEAT;
+            lo = transition_search(sp, newt);
+        } else {
+            return FALSE;
+        }
+    }
+    return FALSE;
+}
+
+/*
+** Local time type in effect at t, searched as by tz_localtime_hint_r() (or
+** by the rule of the state past its transitions), or NULL if t is too far
+** away from the transitions to be handled.
+*/
+
+static const struct ttinfo *
+ttinfo_hinted(sp, t, hintp)
+register const struct state *const sp;
+time_t              t;
+int *const          hintp;
+{
+    int_fast64_t            icycles;
+    int             hit;
+
+    if (STATE_RULED(sp, t)) {
+        return rule_ttinfo(sp, t);
+    }
+    if (sp->timecnt > 0 && ((sp->goback && t < STATE_AT(sp, 0)) ||
+                            (sp->goahead && t > STATE_AT(sp, sp->timecnt - 1)))) {
+        /* Cycles are whole days, so the local time type found is the same */
+        if (!cycle_shift(sp, t, &t, &icycles)) {
+            return NULL;
+        }
+    }
+    if (sp->timecnt == 0 || t < STATE_AT(sp, 0)) {
+        return first_ttinfo(sp);
+    }
+    return &sp->ttis[sp->types[transition_hinted(sp, t, hintp, &hit) - 1]];
+}
+
 /*
 ** gmtsub is to gmtime as localsub is to localtime.
 */
@@ -1348,14 +2621,7 @@ struct tm *const   tmp;
 {
     register struct tm     *result;
 
-    if (!gmt_is_set) {
-        gmt_is_set = TRUE;
-#ifdef ALL_STATE
-        gmtptr = (struct state *) calloc(1, sizeof * gmtptr);
-        if (gmtptr != NULL)
-#endif /* defined ALL_STATE */
-            gmtload(gmtptr);
-    }
+    gmtcheck();
     result = timesub(timep, offset, gmtptr, tmp);
 #ifdef TM_ZONE
     /*
@@ -1366,16 +2632,11 @@ struct tm *const   tmp;
     if (offset != 0) {
         tmp->TM_ZONE = wildabbr;
     } else {
-#ifdef ALL_STATE
         if (gmtptr == NULL) {
             tmp->TM_ZONE = gmt;
         } else {
             tmp->TM_ZONE = gmtptr->chars;
         }
-#endif /* defined ALL_STATE */
-#ifndef ALL_STATE
-        tmp->TM_ZONE = gmtptr->chars;
-#endif /* State Farm */
     }
 #endif /* defined TM_ZONE */
     return result;
@@ -1413,16 +2674,28 @@ const long      offset;
 #endif /* defined STD_INSPIRED */
 
 /*
-** Return the number of leap years through the end of the given year
-** where, to make the math easy, the answer for year zero is defined as zero.
+** Index of the last leap second correction in effect at t, or -1 if
+** there is none.
 */
 
 static int
-leaps_thru_end_of(y)
-register const int  y;
+leap_search(sp, t)
+register const struct state *const sp;
+register const time_t   t;
 {
-    return (y >= 0) ? (y / 4 - y / 100 + y / 400) :
-           -(leaps_thru_end_of(-(y + 1)) + 1);
+    register int    lo = 0;
+    register int    hi = (sp == NULL) ? 0 : sp->leapcnt;
+
+    while (lo < hi) {
+        register int    mid = (lo + hi) >> 1;
+
+        if (t < sp->lsis[mid].ls_trans) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo - 1;
 }
 
 static struct tm *
@@ -1434,119 +2707,48 @@ register struct tm *const      tmp;
 {
     register const struct lsinfo   *lp;
     register time_t         tdays;
-    register int            idays;  /* unsigned would be so 2003 */
     register long           rem;
-    int             y;
-    register const int         *ip;
+    long long           y;
+    int             mon, mday, yday;
     register long           corr;
     register int            hit;
     register int            i;
 
     corr = 0;
     hit = 0;
-#ifdef ALL_STATE
-    i = (sp == NULL) ? 0 : sp->leapcnt;
-#endif /* defined ALL_STATE */
-#ifndef ALL_STATE
-    i = sp->leapcnt;
-#endif /* State Farm */
-    while (--i >= 0) {
+    i = leap_search(sp, *timep);
+    if (i >= 0) {
         lp = &sp->lsis[i];
-        if (*timep >= lp->ls_trans) {
-            if (*timep == lp->ls_trans) {
-                hit = ((i == 0 && lp->ls_corr > 0) ||
-                       lp->ls_corr > sp->lsis[i - 1].ls_corr);
-                if (hit)
-                    while (i > 0 &&
-                            sp->lsis[i].ls_trans ==
-                            sp->lsis[i - 1].ls_trans + 1 &&
-                            sp->lsis[i].ls_corr ==
-                            sp->lsis[i - 1].ls_corr + 1) {
-                        ++hit;
-                        --i;
-                    }
-            }
-            corr = lp->ls_corr;
-            break;
+        if (*timep == lp->ls_trans) {
+            hit = ((i == 0 && lp->ls_corr > 0) ||
+                   lp->ls_corr > sp->lsis[i - 1].ls_corr);
+            if (hit)
+                while (i > 0 &&
+                        sp->lsis[i].ls_trans ==
+                        sp->lsis[i - 1].ls_trans + 1 &&
+                        sp->lsis[i].ls_corr ==
+                        sp->lsis[i - 1].ls_corr + 1) {
+                    ++hit;
+                    --i;
+                }
         }
+        corr = lp->ls_corr;
     }
-    y = EPOCH_YEAR;
     tdays = *timep / SECSPERDAY;
-    rem = *timep - tdays * SECSPERDAY;
-    while (tdays < 0 || tdays >= year_lengths[isleap(y)]) {
-        int     newy;
-        register time_t tdelta;
-        register int    idelta;
-        register int    leapdays;
-
-        tdelta = tdays / DAYSPERLYEAR;
-        idelta = tdelta;
-        if (tdelta - idelta >= 1 || idelta - tdelta >= 1) {
-            return NULL;
-        }
-        if (idelta == 0) {
-            idelta = (tdays < 0) ? -1 : 1;
-        }
-        newy = y;
-        if (increment_overflow(&newy, idelta)) {
-            return NULL;
-        }
-        leapdays = leaps_thru_end_of(newy - 1) -
-                   leaps_thru_end_of(y - 1);
-        tdays -= ((time_t) newy - y) * DAYSPERNYEAR;
-        tdays -= leapdays;
-        y = newy;
-    }
-    {
-        register long   seconds;
-
-        seconds = tdays * SECSPERDAY + 0.5;
-        tdays = seconds / SECSPERDAY;
-        rem += seconds - tdays * SECSPERDAY;
-    }
-    /*
-    ** Given the range, we can now fearlessly cast...
-    */
-    idays = tdays;
-    rem += offset - corr;
-    while (rem < 0) {
+    rem = *timep - tdays * SECSPERDAY + offset - corr;
+    tdays += rem / SECSPERDAY;
+    rem %= SECSPERDAY;
+    if (rem < 0) {
         rem += SECSPERDAY;
-        --idays;
-    }
-    while (rem >= SECSPERDAY) {
-        rem -= SECSPERDAY;
-        ++idays;
-    }
-    while (idays < 0) {
-        if (increment_overflow(&y, -1)) {
-            return NULL;
-        }
-        idays += year_lengths[isleap(y)];
-    }
-    while (idays >= year_lengths[isleap(y)]) {
-        idays -= year_lengths[isleap(y)];
-        if (increment_overflow(&y, 1)) {
-            return NULL;
-        }
+        --tdays;
     }
-    tmp->tm_year = y;
-    if (increment_overflow(&tmp->tm_year, -TM_YEAR_BASE)) {
+    dt_calendar_civil_from_days(tdays, &y, &mon, &mday, &yday);
+    if (y < (long long) INT_MIN + TM_YEAR_BASE || y > INT_MAX) {
         return NULL;
     }
-    tmp->tm_yday = idays;
-    /*
-    ** The "extra" mods below avoid overflow problems.
-    */
-    tmp->tm_wday = EPOCH_WDAY +
-                   ((y - EPOCH_YEAR) % DAYSPERWEEK) *
-                   (DAYSPERNYEAR % DAYSPERWEEK) +
-                   leaps_thru_end_of(y - 1) -
-                   leaps_thru_end_of(EPOCH_YEAR - 1) +
-                   idays;
-    tmp->tm_wday %= DAYSPERWEEK;
-    if (tmp->tm_wday < 0) {
-        tmp->tm_wday += DAYSPERWEEK;
-    }
+    tmp->tm_year = (int) (y - TM_YEAR_BASE);
+    tmp->tm_yday = yday;
+    tmp->tm_wday = dt_calendar_day_of_week(tdays);
     tmp->tm_hour = (int) (rem / SECSPERHOUR);
     rem %= SECSPERHOUR;
     tmp->tm_min = (int) (rem / SECSPERMIN);
@@ -1555,11 +2757,8 @@ register struct tm *const      tmp;
     ** representation. This uses "... ??:59:60" et seq.
     */
     tmp->tm_sec = (int) (rem % SECSPERMIN) + hit;
-    ip = mon_lengths[isleap(y)];
-    for (tmp->tm_mon = 0; idays >= ip[tmp->tm_mon]; ++(tmp->tm_mon)) {
-        idays -= ip[tmp->tm_mon];
-    }
-    tmp->tm_mday = (int) (idays + 1);
+    tmp->tm_mon = mon - 1;
+    tmp->tm_mday = mday;
     tmp->tm_isdst = 0;
 #ifdef TM_GMTOFF
     tmp->TM_GMTOFF = offset;
@@ -1690,10 +2889,11 @@ const int       do_norm_secs;
     register int            dir;
     register int            i, j;
     register int            saved_seconds;
-    register long           li;
     register time_t         lo;
     register time_t         hi;
     long                y;
+    long long           days, year;
+    int             mon, yday;
     time_t              newt;
     time_t              t;
     struct tm           yourtm, mytm;
@@ -1723,32 +2923,17 @@ const int       do_norm_secs;
     if (long_increment_overflow(&y, TM_YEAR_BASE)) {
         return WRONG;
     }
-    while (yourtm.tm_mday <= 0) {
-        if (long_increment_overflow(&y, -1)) {
-            return WRONG;
-        }
-        li = y + (1 < yourtm.tm_mon);
-        yourtm.tm_mday += year_lengths[isleap(li)];
-    }
-    while (yourtm.tm_mday > DAYSPERLYEAR) {
-        li = y + (1 < yourtm.tm_mon);
-        yourtm.tm_mday -= year_lengths[isleap(li)];
-        if (long_increment_overflow(&y, 1)) {
-            return WRONG;
-        }
-    }
-    for ( ; ; ) {
-        i = mon_lengths[isleap(y)][yourtm.tm_mon];
-        if (yourtm.tm_mday <= i) {
-            break;
-        }
-        yourtm.tm_mday -= i;
-        if (++yourtm.tm_mon >= MONSPERYEAR) {
-            yourtm.tm_mon = 0;
-            if (long_increment_overflow(&y, 1)) {
-                return WRONG;
-            }
-        }
+    /*
+    ** Count days from the first of the month, so that any day of
+    ** month lands in the right year and month.
+    */
+    days = dt_calendar_days_from_civil(y, yourtm.tm_mon + 1, 1) +
+           yourtm.tm_mday - 1;
+    dt_calendar_civil_from_days(days, &year, &mon, &yourtm.tm_mday, &yday);
+    yourtm.tm_mon = mon - 1;
+    y = year;
+    if (y != year) {
+        return WRONG;
     }
     if (long_increment_overflow(&y, -TM_YEAR_BASE)) {
         return WRONG;
@@ -1847,11 +3032,9 @@ const int       do_norm_secs;
         ** It's okay to guess wrong since the guess
         ** gets checked.
         */
-#ifdef ALL_STATE
         if (sp == NULL) {
             return WRONG;
         }
-#endif /* defined ALL_STATE */
         for (i = sp->typecnt - 1; i >= 0; --i) {
             if (sp->ttis[i].tt_isdst != yourtm.tm_isdst) {
                 continue;
@@ -1957,11 +3140,9 @@ const long      offset;
     ** We try to divine the type they started from and adjust to the
     ** type they need.
     */
-#ifdef ALL_STATE
     if (sp == NULL) {
         return WRONG;
     }
-#endif /* defined ALL_STATE */
     for (i = 0; i < sp->typecnt; ++i) {
         seen[i] = FALSE;
     }
@@ -1996,14 +3177,309 @@ const long      offset;
     return WRONG;
 }
 
+/*
+** Direct inverse of localsub for the common case: t + gmtoff(t) == local
+** can only hold for t within [local - maxgmtoff, local - mingmtoff], so the
+** transition intervals overlapping that window, found by one search and
+** rarely more than two, are tried in order. Windows reaching repeated
+** (goback/goahead) times are first moved into the transitions by whole
+** cycles. Returns the number of UTC times with the local time of *tmp and a
+** type of tm_isdst isdst (any one if isdst is negative) stored to times in
+** ascending order (at most two of them), or LOCAL_UNKNOWN if time1 must
+** decide: leap seconds, tm_sec out of range, or times of other types only.
+** A local time skipped by a transition gives 0, times[0] and times[1] are
+** then the UTC times it would be with the offsets after and before the
+** transition, and *transitionp is the transition.
+*/
+
+#define LOCAL_UNKNOWN   (-1)
+
+/*
+** local_search() for the times from lo to hi when they reach past the
+** transitions of a state with a rule: the same walk over the local time types
+** in effect, with the transitions found one by one by transition_next().
+*/
+
+static int
+local_search_rule(sp, local, lo, hi, isdst, times, transitionp)
+register const struct state *const sp;
+const long long         local;
+const time_t            lo;
+const time_t            hi;
+const int           isdst;
+time_t *const           times;
+time_t *const           transitionp;
+{
+    register const struct ttinfo   *ttisp;
+    const struct ttinfo     *nextp;
+    register int            n;
+    register int            found;
+    register int            more;
+    time_t              t, start, at;
+    int             hint = 0;
+
+    if ((ttisp = ttinfo_hinted(sp, lo, &hint)) == NULL) {
+        return LOCAL_UNKNOWN;
+    }
+    start = lo;
+    n = 0;
+    found = FALSE;
+    for (;;) {
+        t = (time_t) (local - ttisp->tt_gmtoff);
+        more = transition_next(sp, start, &at, &nextp);
+        if (t >= start && (!more || t < at)) {
+            found = TRUE;
+            if ((isdst < 0 || ttisp->tt_isdst == isdst) && n < 2) {
+                times[n++] = t;
+            }
+        }
+        if (!more || at > hi) {
+            break;
+        }
+        if (!found && local >= at + ttisp->tt_gmtoff &&
+                local < at + nextp->tt_gmtoff) {
+            times[0] = (time_t) (local - nextp->tt_gmtoff);
+            times[1] = (time_t) (local - ttisp->tt_gmtoff);
+            *transitionp = at;
+        }
+        start = at;
+        ttisp = nextp;
+    }
+    if (n == 0 && found) {
+        return LOCAL_UNKNOWN;
+    }
+    return n;
+}
+
+/*
+** local_search() for a local time already given as seconds since the epoch.
+*/
+
+static int
+local_search_seconds(sp, local, isdst, times, transitionp)
+register const struct state *const sp;
+long long              local;
+const int              isdst;
+time_t *const              times;
+time_t *const              transitionp;
+{
+    register const struct ttinfo   *ttisp;
+    register const struct ttinfo   *nextp;
+    register int            k;
+    long long           shift;
+    time_t              lo, hi, t, newt;
+    int_fast64_t            icycles;
+    int             n, found;
+
+    if (sp == NULL || sp->leapcnt != 0) {
+        return LOCAL_UNKNOWN;
+    }
+    lo = (time_t) (local - sp->maxgmtoff);
+    hi = (time_t) (local - sp->mingmtoff);
+    if (lo != local - sp->maxgmtoff || hi != local - sp->mingmtoff) {
+        return LOCAL_UNKNOWN;
+    }
+    if (sp->hasrule && (sp->timecnt == 0 ||
+                        hi > STATE_AT(sp, sp->timecnt - 1))) {
+        return local_search_rule(sp, local, lo, hi, isdst, times,
+                                 transitionp);
+    }
+    shift = 0;
+    if (sp->timecnt > 0 && ((sp->goback && lo < STATE_AT(sp, 0)) ||
+                            (sp->goahead && hi > STATE_AT(sp, sp->timecnt - 1)))) {
+        if (!cycle_shift(sp, (lo < STATE_AT(sp, 0)) ? lo : hi, &newt, &icycles)) {
+            return LOCAL_UNKNOWN;
+        }
+        shift = (long long) newt - ((lo < STATE_AT(sp, 0)) ? lo : hi);
+        lo += shift;
+        hi += shift;
+        local += shift;
+        if (lo < STATE_AT(sp, 0) || hi > STATE_AT(sp, sp->timecnt - 1)) {
+            return LOCAL_UNKNOWN;
+        }
+    }
+    k = (sp->timecnt == 0 || lo < STATE_AT(sp, 0)) ? 0 : transition_search(sp, lo);
+    n = 0;
+    found = FALSE;
+    for (;;) {
+        ttisp = (k == 0) ? first_ttinfo(sp) : &sp->ttis[sp->types[k - 1]];
+        t = (time_t) (local - ttisp->tt_gmtoff);
+        if ((k == 0 || t >= STATE_AT(sp, k - 1)) &&
+                (k == sp->timecnt || t < STATE_AT(sp, k))) {
+            found = TRUE;
+            if ((isdst < 0 || ttisp->tt_isdst == isdst) && n < 2) {
+                times[n++] = (time_t) (t - shift);
+            }
+        }
+        if (k == sp->timecnt || STATE_AT(sp, k) > hi) {
+            break;
+        }
+        nextp = &sp->ttis[sp->types[k]];
+        if (!found && local >= STATE_AT(sp, k) + ttisp->tt_gmtoff &&
+                local < STATE_AT(sp, k) + nextp->tt_gmtoff) {
+            times[0] = (time_t) (local - nextp->tt_gmtoff - shift);
+            times[1] = (time_t) (local - ttisp->tt_gmtoff - shift);
+            *transitionp = (time_t) (STATE_AT(sp, k) - shift);
+        }
+        ++k;
+    }
+    if (n == 0 && found) {
+        return LOCAL_UNKNOWN;
+    }
+    return n;
+}
+
+static int
+local_search(sp, tmp, isdst, times, transitionp)
+const struct state *const  sp;
+const struct tm *const     tmp;
+const int          isdst;
+time_t *const          times;
+time_t *const          transitionp;
+{
+    long long   y;
+    long long   local;
+    int     mon;
+
+    if (tmp->tm_sec < 0 || tmp->tm_sec >= SECSPERMIN) {
+        return LOCAL_UNKNOWN;
+    }
+    y = (long long) tmp->tm_year + TM_YEAR_BASE + tmp->tm_mon / MONSPERYEAR;
+    mon = tmp->tm_mon % MONSPERYEAR;
+    if (mon < 0) {
+        mon += MONSPERYEAR;
+        --y;
+    }
+    local = (dt_calendar_days_from_civil(y, mon + 1, 1) + tmp->tm_mday - 1) *
+            SECSPERDAY + (long long) tmp->tm_hour * SECSPERHOUR +
+            (long long) tmp->tm_min * SECSPERMIN + tmp->tm_sec;
+    return local_search_seconds(sp, local, isdst, times, transitionp);
+}
+
 time_t
 tz_mktime(sp, tmp)
 const struct state *const sp;
 struct tm *const   tmp;
 {
+    time_t  times[2];
+    time_t  transition;
+    int n;
+
+    if (tmp != NULL && tmp->tm_isdst > 1) {
+        tmp->tm_isdst = 1;
+    }
+    n = (tmp == NULL) ? LOCAL_UNKNOWN :
+        local_search(sp, tmp, tmp->tm_isdst, times, &transition);
+    if (n > 0) {
+        if (localsub(sp, &times[0], 0L, tmp) == NULL) {
+            return WRONG;
+        }
+        return times[0];
+    }
+    if (n == 0 && tmp->tm_isdst < 0) {
+        return WRONG;
+    }
     return time1(sp, tmp, localsub, 0L);
 }
 
+/*
+** All UTC times with the local time of *tmp, whatever its tm_isdst is.
+** Returns 1, or 2 for an ambiguous time with the earlier one in *firstp,
+** storing the same time to both *firstp and *secondp otherwise. For a time
+** skipped by a transition returns 0 and stores the times it would be with
+** the offsets after and before the transition to *firstp and *secondp and
+** the transition to *transitionp. Returns -1 if the time is not valid or
+** cannot be represented. Zones with leap seconds get the tz_mktime()
+** result, where skipped times are not valid.
+*/
+
+int
+tz_mktime_all(sp, tmp, firstp, secondp, transitionp)
+const struct state *const sp;
+const struct tm *const     tmp;
+time_t *const          firstp;
+time_t *const          secondp;
+time_t *const          transitionp;
+{
+    time_t      times[2];
+    struct tm   mytm;
+    int     n;
+
+    n = local_search(sp, tmp, -1, times, transitionp);
+    if (n == LOCAL_UNKNOWN) {
+        mytm = *tmp;
+        mytm.tm_isdst = -1;
+        times[0] = time1(sp, &mytm, localsub, 0L);
+        if (times[0] == WRONG) {
+            return -1;
+        }
+        n = 1;
+    }
+    *firstp = times[0];
+    *secondp = times[(n == 1) ? 0 : 1];
+    return n;
+}
+
+/*
+** tz_mktime_all() for a local time given as seconds since the epoch, but
+** returning -1 where tz_mktime_all() would fall back to time1(): leap seconds
+** or an unrepresentable time. If rangep is not NULL and the local time occurs
+** once, stores to rangep[0] and rangep[1] the range [begin, end) of local
+** times around it which surely occur once with the same UTC offset, so a run
+** of local times can be converted by subtraction; the range is empty if the
+** local time is too close to a transition. The offsets of every time in the
+** range are within [mingmtoff, maxgmtoff], so it is enough for all of them to
+** map into the interval between the neighbouring transitions.
+*/
+
+#define TIME_T_MAX  ((time_t) (((unsigned long long) 1 << (TYPE_BIT(time_t) - 1)) - 1))
+#define TIME_T_MIN  (-TIME_T_MAX - 1)
+
+int
+tz_local_search(sp, local, firstp, secondp, transitionp, rangep)
+const struct state *const sp;
+const time_t           local;
+time_t *const          firstp;
+time_t *const          secondp;
+time_t *const          transitionp;
+time_t *const          rangep;
+{
+    time_t  times[2];
+    time_t  at;
+    int n;
+
+    n = local_search_seconds(sp, local, -1, times, transitionp);
+    if (n == LOCAL_UNKNOWN) {
+        return -1;
+    }
+    *firstp = times[0];
+    *secondp = times[(n == 1) ? 0 : 1];
+    if (rangep != NULL) {
+        rangep[0] = rangep[1] = local;
+        if (n != 1) {
+            return n;
+        }
+        if (!tz_transition(sp, times[0], FALSE, &at, NULL, NULL, NULL)) {
+            rangep[0] = TIME_T_MIN;
+        } else if (sp->maxgmtoff <= 0 || at <= TIME_T_MAX - sp->maxgmtoff) {
+            rangep[0] = at + sp->maxgmtoff;
+        } else {
+            return n;
+        }
+        if (!tz_transition(sp, times[0], TRUE, &at, NULL, NULL, NULL)) {
+            rangep[1] = TIME_T_MAX;
+        } else if (sp->mingmtoff >= 0 || at >= TIME_T_MIN - sp->mingmtoff) {
+            rangep[1] = at + sp->mingmtoff;
+        } else {
+            rangep[1] = rangep[0];
+        }
+        if (rangep[0] > local || rangep[1] <= local) {
+            rangep[0] = rangep[1] = local;
+        }
+    }
+    return n;
+}
+
 #ifdef STD_INSPIRED
 
 time_t
@@ -2023,6 +3499,7 @@ struct tm *const   tmp;
     if (tmp != NULL) {
         tmp->tm_isdst = 0;
     }
+    gmtcheck();
     return time1(gmtptr, tmp, gmtsub, 0L);
 }
 
@@ -2034,7 +3511,8 @@ const long      offset;
     if (tmp != NULL) {
         tmp->tm_isdst = 0;
     }
-    return time1(gtmptr, tmp, gmtsub, offset);
+    gmtcheck();
+    return time1(gmtptr, tmp, gmtsub, offset);
 }
 
 #endif /* defined STD_INSPIRED */
@@ -33,12 +33,36 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #define LIBTZ_DLL_EXPORTED
 #endif
 
-LIBTZ_DLL_EXPORTED const struct state *tz_alloc(register const char *name);
+LIBTZ_DLL_EXPORTED const struct state *tz_alloc(const char *name);
+LIBTZ_DLL_EXPORTED const struct state *tz_retain(const struct state *const sp);
 LIBTZ_DLL_EXPORTED void tz_free(const struct state *const sp);
 
 LIBTZ_DLL_EXPORTED struct tm *tz_localtime(const struct state *const sp, const time_t *const timep);
 LIBTZ_DLL_EXPORTED struct tm *tz_localtime_r(const struct state *const sp, const time_t *const timep, struct tm *tmp);
+LIBTZ_DLL_EXPORTED struct tm *tz_localtime_hint_r(const struct state *const sp, const time_t *const timep, struct tm *tmp,
+        int *const hintp, int *const hitp);
+/* Local times as seconds since the epoch of n times in a row, see libtz.c */
+LIBTZ_DLL_EXPORTED int tz_local_seconds(const struct state *const sp, const time_t *const times, time_t *const locals,
+                                        const size_t n, int *const hintp);
+/* UTC offsets, DST flags and abbreviations of n times in a row, see libtz.c */
+LIBTZ_DLL_EXPORTED int tz_offsets(const struct state *const sp, const time_t *const times, const size_t n,
+                                  long *const gmtoffs, int *const isdsts, const char **const abbrs, int *const hintp);
 
 LIBTZ_DLL_EXPORTED time_t tz_mktime(const struct state *const sp, struct tm *const tmp);
+/* All UTC times of a local time, see libtz.c */
+LIBTZ_DLL_EXPORTED int tz_mktime_all(const struct state *const sp, const struct tm *const tmp, time_t *const firstp,
+                                     time_t *const secondp, time_t *const transitionp);
+/* The same for a local time given as seconds since the epoch, see libtz.c */
+LIBTZ_DLL_EXPORTED int tz_local_search(const struct state *const sp, const time_t local, time_t *const firstp,
+                                       time_t *const secondp, time_t *const transitionp, time_t *const rangep);
+
+/* Next or previous transition changing the local time type, see libtz.c */
+LIBTZ_DLL_EXPORTED int tz_transition(const struct state *const sp, const time_t t, const int forward, time_t *const atp,
+                                     long *const gmtoffs, int *const isdsts, const char **const abbrs);
+
+/* Index of the transition in effect at t (-1 before the first one), by the search used for conversions
+ * and by plain binary search, for benchmarks and tests */
+LIBTZ_DLL_EXPORTED int tz_transition_search(const struct state *const sp, const time_t t);
+LIBTZ_DLL_EXPORTED int tz_transition_bsearch(const struct state *const sp, const time_t t);
 
 #endif /* TZ_H */
@@ -52,7 +52,7 @@ static char tzfilehid[] = "@(#)tzfile.h	8.1";
 #endif /* !defined lint */
 
 #ifndef TZDEFAULT
-#define TZDEFAULT   "localtime"
+#define TZDEFAULT   "/etc/localtime"
 #endif /* !defined TZDEFAULT */
 
 #ifndef TZDEFRULES
@@ -0,0 +1,135 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "libtz/tz.h"
+#include "tzcache.h"
+
+//! Buckets count, must be a power of 2, it is enough for all olsen and windows names without growing
+#define TZCACHE_BUCKETS_COUNT 1024
+
+typedef struct tzcache_node {
+    char *name;
+    const struct state *state;
+    struct tzcache_node *next;
+} tzcache_node_t;
+
+static tzcache_node_t *tzcache_buckets[TZCACHE_BUCKETS_COUNT] = {0,};
+static pthread_rwlock_t tzcache_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+// FNV-1a string hash
+static size_t tzcache_hash(const char *name)
+{
+    unsigned long hash = 2166136261UL;
+
+    while (*name != '\0') {
+        hash ^= (unsigned char) * name++;
+        hash *= 16777619UL;
+    }
+    return hash & (TZCACHE_BUCKETS_COUNT - 1);
+}
+
+static const tzcache_node_t *tzcache_find_node(const char *name, size_t bucket)
+{
+    const tzcache_node_t *node = NULL;
+
+    for (node = tzcache_buckets[bucket]; node != NULL; node = node->next) {
+        if (strcmp(node->name, name) == 0) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+dt_status_t tzcache_find(const char *name, const struct state **sp)
+{
+    const tzcache_node_t *node = NULL;
+
+    if (name == NULL || sp == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    if (pthread_rwlock_rdlock(&tzcache_lock) != 0) {
+        return DT_SYSTEM_CALL_ERROR;
+    }
+    node = tzcache_find_node(name, tzcache_hash(name));
+    if (node != NULL) {
+        *sp = tz_retain(node->state);
+    }
+    pthread_rwlock_unlock(&tzcache_lock);
+
+    return node != NULL ? DT_OK : DT_TIMEZONE_NOT_FOUND;
+}
+
+dt_status_t tzcache_insert(const char *name, const struct state **sp)
+{
+    const tzcache_node_t *node = NULL;
+    tzcache_node_t *inserted = NULL;
+    size_t bucket = 0;
+
+    if (name == NULL || sp == NULL || *sp == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    bucket = tzcache_hash(name);
+    if (pthread_rwlock_wrlock(&tzcache_lock) != 0) {
+        return DT_SYSTEM_CALL_ERROR;
+    }
+
+    node = tzcache_find_node(name, bucket);
+    if (node != NULL) {
+        // Somebody has been faster, so using his state
+        if (node->state != *sp) {
+            tz_free(*sp);
+            *sp = tz_retain(node->state);
+        }
+        pthread_rwlock_unlock(&tzcache_lock);
+        return DT_OK;
+    }
+
+    inserted = malloc(sizeof(tzcache_node_t));
+    if (inserted != NULL) {
+        inserted->name = malloc(strlen(name) + 1);
+    }
+    if (inserted == NULL || inserted->name == NULL) {
+        pthread_rwlock_unlock(&tzcache_lock);
+        free(inserted);
+        // State is still usable, it is just not cached
+        return DT_OK;
+    }
+    strcpy(inserted->name, name);
+    inserted->state = tz_retain(*sp);
+    inserted->next = tzcache_buckets[bucket];
+    tzcache_buckets[bucket] = inserted;
+
+    pthread_rwlock_unlock(&tzcache_lock);
+    return DT_OK;
+}
@@ -0,0 +1,71 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef TZCACHE_H
+#define TZCACHE_H
+
+#include <libdt/dt_types.h>
+
+/*!
+ * \defgroup TimezoneCache Process-wide cache of loaded timezone states
+ * Every cached state is shared between all dt_timezone_t objects which were looked up by the same name,
+ * it is immutable after loading and reference counted (see tz_retain() and tz_free()).
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    //! Finds timezone state in the cache
+    //! State must be released with tz_free() if this function has been called successfully
+    /*!
+     * @param name name of time zone as it was cached
+     * @param sp pointer to store retained state
+     * @return DT_OK on success, DT_TIMEZONE_NOT_FOUND if there is no state cached for the name,
+     * otherwise corresponding status from dt_status_t
+     */
+    dt_status_t tzcache_find(const char *name, const struct state **sp);
+
+    //! Puts timezone state to the cache
+    //! If another state has been already cached by the name, given state is released and the cached one is used instead.
+    //! Cache holds it's own reference, so ownership of the state remains at the caller.
+    /*!
+     * @param name name of time zone to cache state by
+     * @param sp pointer to state to cache, on return it points to the state from the cache [IN/OUT]
+     * @return DT_OK on success otherwise corresponding status from dt_status_t
+     */
+    dt_status_t tzcache_insert(const char *name, const struct state **sp);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @}*/
+
+#endif // TZCACHE_H
@@ -0,0 +1,143 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "libtz/tz.h"
+#include "libtz/tzfile.h"
+#include "tzlocal.h"
+
+// Source of the loaded state: value of TZ and identity of TZDEFAULT file
+typedef struct tzlocal_source {
+    char *tz;
+    dt_bool_t tz_set;
+    dt_bool_t file_found;
+    dev_t dev;
+    ino_t ino;
+    time_t mtime;
+    off_t size;
+} tzlocal_source_t;
+
+// State is read without locking, everything else is under the mutex. The state replaced by the last reload is kept
+// for conversions which have got it before, it is freed by the next reload.
+static const struct state *tzlocal_state = NULL;
+static const struct state *tzlocal_retired = NULL;
+static tzlocal_source_t tzlocal_loaded = {0,};
+static pthread_mutex_t tzlocal_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void tzlocal_read_source(tzlocal_source_t *source)
+{
+    const char *tz = getenv("TZ");
+    struct stat st;
+
+    source->tz_set = tz != NULL ? DT_TRUE : DT_FALSE;
+    source->tz = tz != NULL ? strdup(tz) : NULL;
+    source->file_found = stat(TZDEFAULT, &st) == 0 ? DT_TRUE : DT_FALSE;
+    if (source->file_found) {
+        source->dev = st.st_dev;
+        source->ino = st.st_ino;
+        source->mtime = st.st_mtime;
+        source->size = st.st_size;
+    }
+}
+
+static dt_bool_t tzlocal_source_equal(const tzlocal_source_t *lhs, const tzlocal_source_t *rhs)
+{
+    if (lhs->tz_set != rhs->tz_set || (lhs->tz_set && (lhs->tz == NULL || rhs->tz == NULL || strcmp(lhs->tz, rhs->tz) != 0))) {
+        return DT_FALSE;
+    }
+    if (lhs->tz_set && lhs->tz[0] != '\0' && strcmp(lhs->tz, TZDEFAULT) != 0) {
+        // File does not matter while TZ names another timezone
+        return DT_TRUE;
+    }
+    return lhs->file_found == rhs->file_found && (!lhs->file_found || (lhs->dev == rhs->dev && lhs->ino == rhs->ino &&
+            lhs->mtime == rhs->mtime && lhs->size == rhs->size)) ? DT_TRUE : DT_FALSE;
+}
+
+// Loads the state from the source and publishes it, must be called under the lock
+static dt_status_t tzlocal_load(tzlocal_source_t *source)
+{
+    const struct state *state = NULL;
+
+    // NULL name is for TZDEFAULT, empty one is for UTC as the C library takes empty TZ
+    state = tz_alloc(source->tz_set ? source->tz : NULL);
+    if (state == NULL || (source->tz_set && source->tz == NULL)) {
+        tz_free(state);
+        free(source->tz);
+        return DT_SYSTEM_CALL_ERROR;
+    }
+    // Conversions could still use the state replaced now, but not the one replaced before it
+    tz_free(tzlocal_retired);
+    tzlocal_retired = tzlocal_state;
+    free(tzlocal_loaded.tz);
+    tzlocal_loaded = *source;
+    __atomic_store_n(&tzlocal_state, state, __ATOMIC_RELEASE);
+    return DT_OK;
+}
+
+const struct state *tzlocal_get(void)
+{
+    const struct state *state = __atomic_load_n(&tzlocal_state, __ATOMIC_ACQUIRE);
+    tzlocal_source_t source = {0,};
+
+    if (state != NULL) {
+        return state;
+    }
+    // Only the first conversion loads the state, other threads wait for it
+    if (pthread_mutex_lock(&tzlocal_lock) != 0) {
+        return NULL;
+    }
+    if (tzlocal_state == NULL) {
+        tzlocal_read_source(&source);
+        tzlocal_load(&source);
+    }
+    state = tzlocal_state;
+    pthread_mutex_unlock(&tzlocal_lock);
+    return state;
+}
+
+dt_status_t tzlocal_reload(void)
+{
+    tzlocal_source_t source = {0,};
+    dt_status_t status = DT_OK;
+
+    if (pthread_mutex_lock(&tzlocal_lock) != 0) {
+        return DT_SYSTEM_CALL_ERROR;
+    }
+    tzlocal_read_source(&source);
+    if (tzlocal_state != NULL && tzlocal_source_equal(&source, &tzlocal_loaded)) {
+        free(source.tz);
+    } else {
+        status = tzlocal_load(&source);
+    }
+    pthread_mutex_unlock(&tzlocal_lock);
+    return status;
+}
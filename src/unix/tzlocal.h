@@ -0,0 +1,65 @@
+// vim: shiftwidth=4 softtabstop=4
+/* Copyright (c) 2013, EPAM Systems. All rights reserved.
+
+Authors:
+Ilya Storozhilov <Ilya_Storozhilov@epam.com>,
+Andrey Kuznetsov <Andrey_Kuznetsov@epam.com>,
+Maxim Kot <Maxim_Kot@epam.com>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+#ifndef TZLOCAL_H
+#define TZLOCAL_H
+
+#include <libdt/dt_types.h>
+
+/*!
+ * \defgroup LocalTimezone State of the local timezone
+ * Local timezone is taken from TZ environment variable like the C library does, or from TZDEFAULT
+ * (/etc/localtime) if it is not set. It is loaded by the first conversion with no timezone object and then
+ * shared by all of them, the TZ variable and the file are checked for changes only by tzlocal_reload().
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    //! Returns state of the local timezone, loading it if it has not been loaded yet
+    //! State is owned by the module, it remains valid after one reload and is freed by the next one
+    /*!
+     * @return pointer to the state, NULL if the state could not be allocated
+     */
+    const struct state *tzlocal_get(void);
+
+    //! Loads the local timezone again if TZ variable or TZDEFAULT file has been changed since it was loaded
+    /*!
+     * @return DT_OK on success otherwise corresponding status from dt_status_t
+     */
+    dt_status_t tzlocal_reload(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @}*/
+
+#endif // TZLOCAL_H
@@ -32,10 +32,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 #include <stdlib.h> /* for exit, malloc, atoi */
 #include <string.h> /* for strlen, strcpy_s, strcat_s*/
 #include <memory.h> /* for malloc, free*/
+#include <limits.h> /* for LONG_MAX, LONG_MIN */
 
 #include <libdt/dt.h>
 #include <libdt/dt_posix.h>
 #include "../tzmapping.h"
+#include "../dt_calendar.h"
 
 // WinAPI
 #include <windows.h>
@@ -288,6 +290,46 @@ dt_status_t dt_timestamp_to_representation(const dt_timestamp_t *timestamp, cons
     return DT_OK;
 }
 
+dt_status_t dt_timestamps_to_representations(const dt_timestamp_t *timestamps, size_t count,
+                                             const dt_timezone_t *timezone, dt_representation_t *representations)
+{
+    dt_status_t result = DT_OK;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    size_t i = 0;
+
+    if ((timestamps == NULL || representations == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+    // Timezone rules are applied by the system for each timestamp here
+    for (i = 0; i < count; i++) {
+        status = dt_timestamp_to_representation(&timestamps[i], timezone, &representations[i]);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+dt_status_t dt_timestamp_to_representations_multi(const dt_timestamp_t *timestamp, const dt_timezone_t *const *timezones,
+                                                  size_t count, dt_representation_t *representations)
+{
+    dt_status_t result = DT_OK;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    size_t i = 0;
+
+    if (timestamp == NULL || ((timezones == NULL || representations == NULL) && count > 0)) {
+        return DT_INVALID_ARGUMENT;
+    }
+    // Each timezone is applied by the system to the whole timestamp here
+    for (i = 0; i < count; i++) {
+        status = dt_timestamp_to_representation(timestamp, timezones[i], &representations[i]);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
 dt_status_t dt_representation_to_timestamp(const dt_representation_t *representation, const dt_timezone_t *timezone,
                                            dt_timestamp_t *first_timestamp, dt_timestamp_t *second_timestamp)
 {
@@ -732,15 +774,21 @@ GetTimeZoneInformationForYearLower_cleanup:
 dt_status_t dt_timezone_lookup(const char *timezone_name, dt_timezone_t *timezone)
 {
     dt_status_t status = DT_UNKNOWN_ERROR;
-    tz_aliases_t *aliases = NULL;
+    const tz_aliases_t *aliases = NULL;
     tz_alias_iterator_t *it = TZMAP_BEGIN;
-    tz_alias_t *alias = NULL;
+    const tz_alias_t *alias = NULL;
     const char *native_tz_name = NULL;
+    long gmtoff = 0;
 
     if (timezone == NULL || timezone_name == NULL) {
         return DT_INVALID_ARGUMENT;
     }
 
+    // System gives no abbreviations, so the one of the name is not needed
+    if (tzmap_fixed_offset(timezone_name, &gmtoff, NULL) == DT_OK) {
+        return dt_timezone_fixed(gmtoff, timezone);
+    }
+
     timezone->reg_tz_data = NULL;
     timezone->reg_tz_data_size = 0;
 
@@ -776,6 +824,252 @@ dt_status_t dt_timezone_lookup(const char *timezone_name, dt_timezone_t *timezon
     return status;
 }
 
+dt_status_t dt_timezone_fixed(long offset_seconds, dt_timezone_t *timezone)
+{
+    // Bias of the system timezone information is in minutes
+    if (timezone == NULL || offset_seconds <= -86400 || offset_seconds >= 86400 || offset_seconds % 60 != 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // Zeroed transition dates mean no daylight saving time
+    timezone->dtzi = calloc(1, sizeof(*timezone->dtzi));
+    if (timezone->dtzi == NULL) {
+        return DT_SYSTEM_CALL_ERROR;
+    }
+    timezone->dtzi->Bias = -offset_seconds / 60;
+    timezone->reg_tz_data = NULL;
+    timezone->reg_tz_data_size = 0;
+    return DT_OK;
+}
+
+dt_status_t dt_representation_to_timestamp_policy(const dt_representation_t *representation, const dt_timezone_t *timezone,
+                                                  dt_gap_policy_t gap_policy, dt_timestamp_t *first_timestamp,
+                                                  dt_timestamp_t *second_timestamp)
+{
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    // Timezone rules are applied by the system here, which gives one timestamp and no gap details
+    if ((status = dt_representation_to_timestamp(representation, timezone, first_timestamp, NULL)) != DT_OK) {
+        return status;
+    }
+    if (second_timestamp != NULL) {
+        *second_timestamp = *first_timestamp;
+    }
+    return DT_OK;
+}
+
+dt_status_t dt_convert_representation(const dt_representation_t *representation, const dt_timezone_t *from,
+                                      const dt_timezone_t *to, dt_representation_t *result)
+{
+    dt_timestamp_t timestamp = {0,};
+    dt_status_t status = DT_UNKNOWN_ERROR;
+
+    if (representation == NULL || result == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    // Both timezones are applied by the system, through the timestamp
+    if ((status = dt_representation_to_timestamp(representation, from, &timestamp, NULL)) != DT_OK) {
+        return status;
+    }
+    return dt_timestamp_to_representation(&timestamp, to, result);
+}
+
+dt_status_t dt_convert_representations(const dt_representation_t *representations, size_t count,
+                                       const dt_timezone_t *from, const dt_timezone_t *to,
+                                       dt_representation_t *results)
+{
+    dt_status_t result = DT_OK;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    size_t i = 0;
+
+    if ((representations == NULL || results == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+    for (i = 0; i < count; i++) {
+        status = dt_convert_representation(&representations[i], from, to, &results[i]);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+dt_status_t dt_representation_add(const dt_representation_t *representation, dt_unit_t unit, long count,
+                                  const dt_timezone_t *timezone, dt_gap_policy_t gap_policy,
+                                  dt_representation_t *result)
+{
+    static const long unit_seconds[] = {0, 0, 0, 0, 0, DT_SECONDS_PER_HOUR, DT_SECONDS_PER_MINUTE, 1};
+    dt_representation_t moved = {0};
+    dt_timestamp_t timestamp = {0};
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    long seconds = 0;
+
+    if (dt_validate_representation(representation) != DT_TRUE || unit < DT_UNIT_YEAR || unit > DT_UNIT_SECOND ||
+            result == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    moved = *representation;
+    if (unit_seconds[unit] == 0 && (status = dt_calendar_add_date(representation, unit, count, &moved)) != DT_OK) {
+        return status;
+    }
+    // Timezone rules are applied by the system here, so the time is resolved through the timestamp
+    if ((status = dt_representation_to_timestamp_policy(&moved, timezone, gap_policy, &timestamp, NULL)) != DT_OK) {
+        return status;
+    }
+    if (unit_seconds[unit] != 0) {
+        if (count > LONG_MAX / unit_seconds[unit] || count < LONG_MIN / unit_seconds[unit]) {
+            return DT_OVERFLOW;
+        }
+        seconds = count * unit_seconds[unit];
+        if ((seconds > 0 && timestamp.second > LONG_MAX - seconds) ||
+                (seconds < 0 && timestamp.second < LONG_MIN - seconds)) {
+            return DT_OVERFLOW;
+        }
+        timestamp.second += seconds;
+    }
+    return dt_timestamp_to_representation(&timestamp, timezone, result);
+}
+
+dt_status_t dt_timezone_offset_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp, long *gmtoff,
+                                  dt_bool_t *is_dst, const char **abbreviation)
+{
+    TIME_ZONE_INFORMATION tzi = {0};
+    SYSTEMTIME tUniversalTime = {0};
+    dt_representation_t representation = {0};
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    long long local = 0;
+    time_t time = 0;
+    unsigned long nano = 0;
+
+    if (timestamp == NULL || gmtoff == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+
+    // Offset is the difference of the local time given by the system and the timestamp
+    if ((status = dt_timestamp_to_representation(timestamp, timezone, &representation)) != DT_OK) {
+        return status;
+    }
+    local = dt_calendar_days_from_civil(representation.year, representation.month, representation.day) * 86400 +
+            representation.hour * 3600 + representation.minute * 60 + representation.second;
+    *gmtoff = (long)(local - timestamp->second);
+
+    if (is_dst != NULL) {
+        if (timezone == NULL) {
+            if (GetTimeZoneInformation(&tzi) == TIME_ZONE_ID_INVALID) {
+                return DT_TIMEZONE_NOT_FOUND;
+            }
+        } else if ((status = dt_timestamp_to_posix_time(timestamp, &time, &nano)) != DT_OK) {
+            return status;
+        } else if (UnixTimeToSystemTime(&time, &tUniversalTime) ||
+                   GetTimeZoneInformationForYearLower(tUniversalTime.wYear, timezone, &tzi) == FALSE) {
+            return DT_INVALID_ARGUMENT;
+        }
+        *is_dst = *gmtoff != -(tzi.Bias + tzi.StandardBias) * 60 ? DT_TRUE : DT_FALSE;
+    }
+    // System gives only full names of timezones
+    if (abbreviation != NULL) {
+        *abbreviation = NULL;
+    }
+    return DT_OK;
+}
+
+dt_status_t dt_timezone_offsets_at(const dt_timezone_t *timezone, const dt_timestamp_t *timestamps, size_t count,
+                                   long *gmtoffs, dt_bool_t *is_dst, const char **abbreviations)
+{
+    dt_status_t result = DT_OK;
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    size_t i = 0;
+
+    if ((timestamps == NULL || gmtoffs == NULL) && count > 0) {
+        return DT_INVALID_ARGUMENT;
+    }
+    for (i = 0; i < count; i++) {
+        status = dt_timezone_offset_at(timezone, &timestamps[i], &gmtoffs[i], is_dst != NULL ? &is_dst[i] : NULL,
+                                       abbreviations != NULL ? &abbreviations[i] : NULL);
+        if (status != DT_OK && result == DT_OK) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+dt_status_t dt_timezone_next_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                        dt_transition_t *transition)
+{
+    // System does not give transition instants, only the rules of the current and some of the past years
+    if (timestamp == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return DT_SYSTEM_CALL_ERROR;
+}
+
+dt_status_t dt_timezone_prev_transition(const dt_timezone_t *timezone, const dt_timestamp_t *timestamp,
+                                        dt_transition_t *transition)
+{
+    if (timestamp == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return DT_SYSTEM_CALL_ERROR;
+}
+
+dt_status_t dt_timezone_transitions(const dt_timezone_t *timezone, const dt_timestamp_t *from, const dt_timestamp_t *to,
+                                    dt_transition_iterator_t *iterator)
+{
+    if (from == NULL || to == NULL || iterator == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    memset(iterator, 0, sizeof(*iterator));
+    iterator->timezone = timezone;
+    iterator->done = DT_TRUE;
+    return DT_SYSTEM_CALL_ERROR;
+}
+
+dt_status_t dt_transition_iterate(dt_transition_iterator_t *iterator, dt_transition_t *transition)
+{
+    if (iterator == NULL || transition == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return DT_NO_MORE_ITEMS;
+}
+
+dt_status_t dt_stream_converter_init(const dt_timezone_t *timezone, dt_stream_converter_t *converter)
+{
+    if (converter == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    memset(converter, 0, sizeof(dt_stream_converter_t));
+    converter->timezone = timezone;
+    return DT_OK;
+}
+
+dt_status_t dt_stream_converter_convert(dt_stream_converter_t *converter, const dt_timestamp_t *timestamp,
+                                        dt_representation_t *representation)
+{
+    // Timezone rules are applied by the system for each timestamp here
+    if (converter == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    return dt_timestamp_to_representation(timestamp, converter->timezone, representation);
+}
+
+dt_status_t dt_local_timezone_reload(void)
+{
+    // Local timezone settings are read by the system at each conversion here
+    return DT_OK;
+}
+
+dt_status_t dt_timezone_hint_stats(const dt_timezone_t *timezone, unsigned long *hits, unsigned long *misses)
+{
+    if (timezone == NULL || hits == NULL || misses == NULL) {
+        return DT_INVALID_ARGUMENT;
+    }
+    // Timezone rules are applied by the system here, there are no transitions to search for
+    *hits = 0;
+    *misses = 0;
+    return DT_OK;
+}
+
 dt_status_t dt_timezone_cleanup(dt_timezone_t *timezone)
 {
     if (timezone == NULL || timezone->dtzi == NULL) {
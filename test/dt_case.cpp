@@ -28,11 +28,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #include "dt_case.h"
 #include "libdt/dt.h"
+#include "libdt/dt_inline.h"
 #include <time.h>
 #include "libdt/dt_posix.h"
 #include <limits>
 #include <limits.h>
 #include <float.h>
+#include <stdlib.h>
+#include <string>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 #define MOSCOW_WINDOWS_STANDARD_TZ_NAME "Russian Standard Time"
 #define MOSCOW_OLSEN_TZ_NAME  "Europe/Moscow"
@@ -132,7 +138,7 @@ static validate_representation_test_data_t validate_representation_test_data[] =
         DT_TRUE
     },
     {
-        {2012, 12, 21, 8, 30, 45, -1},
+        {2012, 12, 21, 8, 30, 45, (unsigned long) - 1},
         DT_FALSE
     },
     {
@@ -140,7 +146,7 @@ static validate_representation_test_data_t validate_representation_test_data[] =
         DT_FALSE
     },
     {
-        {2012, 12, 21, 8, 30, -1, 123456789},
+        {2012, 12, 21, 8, 30, (unsigned short) - 1, 123456789},
         DT_FALSE
     },
     {
@@ -148,7 +154,7 @@ static validate_representation_test_data_t validate_representation_test_data[] =
         DT_FALSE
     },
     {
-        {2012, 12, 21, 8, -1, 45, 123456789},
+        {2012, 12, 21, 8, (unsigned short) - 1, 45, 123456789},
         DT_FALSE
     },
 
@@ -157,7 +163,7 @@ static validate_representation_test_data_t validate_representation_test_data[] =
         DT_FALSE
     },
     {
-        {2012, 12, 21, -1, 30, 45, 123456789},
+        {2012, 12, 21, (unsigned short) - 1, 30, 45, 123456789},
         DT_FALSE
     },
     {
@@ -637,6 +643,444 @@ TEST_F(DtCase, miltiply_interval)
     EXPECT_EQ(ri.nano_seconds, 0UL);
 }
 
+TEST_F(DtCase, multiply_interval_exact)
+{
+    dt_interval_t i = {0,};
+    dt_interval_t ri = {0,};
+    dt_interval_t max_interval = {ULONG_MAX, 999999999UL};
+
+    // 200 days and a nano-second do not survive a double
+    EXPECT_EQ(dt_init_interval(17280000UL, 1UL, &i), DT_OK);
+    EXPECT_EQ(dt_mul_interval_int(NULL, 3UL, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_int(&i, 3UL, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_int(&invalid_interval, 3UL, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_int(&i, 3UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, 51840000UL);
+    EXPECT_EQ(ri.nano_seconds, 3UL);
+    EXPECT_EQ(dt_mul_interval_int(&i, 0UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, 0UL);
+    EXPECT_EQ(ri.nano_seconds, 0UL);
+    EXPECT_EQ(dt_mul_interval_int(&max_interval, 1UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, ULONG_MAX);
+    EXPECT_EQ(ri.nano_seconds, 999999999UL);
+    EXPECT_EQ(dt_mul_interval_int(&max_interval, 2UL, &ri), DT_OVERFLOW);
+    EXPECT_EQ(dt_mul_interval_int(&overflowable_interval, ULONG_MAX, &ri), DT_OVERFLOW);
+
+    EXPECT_EQ(dt_mul_interval_ratio(NULL, 1UL, 3UL, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_ratio(&i, 1UL, 3UL, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_ratio(&i, 1UL, 0UL, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_mul_interval_ratio(&i, 1UL, 3UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, 5760000UL);
+    EXPECT_EQ(ri.nano_seconds, 0UL);
+    EXPECT_EQ(dt_mul_interval_ratio(&i, 5UL, 2UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, 43200000UL);
+    EXPECT_EQ(ri.nano_seconds, 2UL);
+    EXPECT_EQ(dt_init_interval(1UL, 0UL, &i), DT_OK);
+    EXPECT_EQ(dt_mul_interval_ratio(&i, 2UL, 3UL, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, 0UL);
+    EXPECT_EQ(ri.nano_seconds, 666666666UL);
+    // Intermediate product does not fit 64 bits while the result does
+    EXPECT_EQ(dt_mul_interval_ratio(&max_interval, ULONG_MAX, ULONG_MAX, &ri), DT_OK);
+    EXPECT_EQ(ri.seconds, ULONG_MAX);
+    EXPECT_EQ(ri.nano_seconds, 999999999UL);
+    EXPECT_EQ(dt_mul_interval_ratio(&max_interval, 3UL, 2UL, &ri), DT_OVERFLOW);
+
+    dt_interval_t d = {0,};
+    dt_interval_t zero = {0,};
+    unsigned long q = 0;
+    EXPECT_EQ(dt_init_interval(10UL, 500000000UL, &i), DT_OK);
+    EXPECT_EQ(dt_init_interval(3UL, 0UL, &d), DT_OK);
+    EXPECT_EQ(dt_div_interval(NULL, &d, &q, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_div_interval(&i, NULL, &q, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_div_interval(&i, &d, NULL, &ri), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_div_interval(&i, &zero, &q, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_div_interval(&i, &d, &q, &ri), DT_OK);
+    EXPECT_EQ(q, 3UL);
+    EXPECT_EQ(ri.seconds, 1UL);
+    EXPECT_EQ(ri.nano_seconds, 500000000UL);
+    EXPECT_EQ(dt_div_interval(&d, &i, &q, NULL), DT_OK);
+    EXPECT_EQ(q, 0UL);
+    EXPECT_EQ(dt_init_interval(0UL, 1000UL, &d), DT_OK);
+    EXPECT_EQ(dt_div_interval(&i, &d, &q, &ri), DT_OK);
+    EXPECT_EQ(q, 10500000UL);
+    EXPECT_EQ(ri.seconds, 0UL);
+    EXPECT_EQ(ri.nano_seconds, 0UL);
+    EXPECT_EQ(dt_init_interval(0UL, 1UL, &d), DT_OK);
+    EXPECT_EQ(dt_div_interval(&max_interval, &d, &q, &ri), DT_OVERFLOW);
+}
+
+TEST_F(DtCase, timestamps_array)
+{
+    // Odd count to cover remainders of vector kernels, with timestamps near limits of seconds
+    const size_t count = 11;
+    dt_timestamp_t timestamps[count];
+    dt_timestamp_t others[count];
+    dt_timestamp_t results[count];
+    dt_offset_t offsets[count];
+    dt_compare_result_t compares[count];
+    long seconds[count];
+    unsigned long nano_seconds[count];
+    long result_seconds[count];
+    unsigned long result_nano_seconds[count];
+    unsigned long offset_seconds[count];
+    dt_bool_t offset_is_forward[count];
+    dt_offset_t o = {0,};
+    dt_timestamp_t threshold = {0,};
+    dt_timestamp_t min = {0,};
+    dt_timestamp_t max = {0,};
+
+    for (size_t i = 0; i < count; i++) {
+        timestamps[i].second = 1388530800L + (long) i * 86400L - (long) (i % 3) * 1000000L;
+        timestamps[i].nano_second = (unsigned long) i * 99999999UL;
+        others[i].second = 1388530800L + (long) (i % 4);
+        others[i].nano_second = 500000000UL;
+        seconds[i] = timestamps[i].second;
+        nano_seconds[i] = timestamps[i].nano_second;
+    }
+    o.duration.seconds = 3600;
+    o.duration.nano_seconds = 900000000UL;
+
+    for (int direction = 0; direction < 2; direction++) {
+        o.is_forward = direction ? DT_TRUE : DT_FALSE;
+        EXPECT_EQ(dt_timestamps_apply_offset(timestamps, count, &o, results), DT_OK);
+        EXPECT_EQ(dt_timestamp_columns_apply_offset(seconds, nano_seconds, count, &o, result_seconds,
+                  result_nano_seconds), DT_OK);
+        for (size_t i = 0; i < count; i++) {
+            dt_timestamp_t expected = {0,};
+            EXPECT_EQ(dt_apply_offset(&timestamps[i], &o, &expected), DT_OK);
+            EXPECT_EQ(results[i].second, expected.second);
+            EXPECT_EQ(results[i].nano_second, expected.nano_second);
+            EXPECT_EQ(result_seconds[i], expected.second);
+            EXPECT_EQ(result_nano_seconds[i], expected.nano_second);
+        }
+    }
+
+    EXPECT_EQ(dt_timestamps_offset_between(timestamps, others, count, offsets), DT_OK);
+    EXPECT_EQ(dt_timestamp_columns_offset_between(seconds, nano_seconds, seconds, nano_seconds, count, offset_seconds,
+              result_nano_seconds, offset_is_forward), DT_OK);
+    for (size_t i = 0; i < count; i++) {
+        dt_offset_t expected = {0,};
+        EXPECT_EQ(dt_offset_between(&timestamps[i], &others[i], &expected), DT_OK);
+        EXPECT_EQ(offsets[i].duration.seconds, expected.duration.seconds);
+        EXPECT_EQ(offsets[i].duration.nano_seconds, expected.duration.nano_seconds);
+        EXPECT_EQ(offsets[i].is_forward, expected.is_forward);
+        EXPECT_EQ(offset_seconds[i], 0UL);
+        EXPECT_EQ(result_nano_seconds[i], 0UL);
+        EXPECT_EQ(offset_is_forward[i], DT_TRUE);
+    }
+
+    threshold = timestamps[5];
+    EXPECT_EQ(dt_timestamps_compare(timestamps, count, &threshold, compares), DT_OK);
+    for (size_t i = 0; i < count; i++) {
+        dt_compare_result_t expected = DT_EQUALS;
+        EXPECT_EQ(dt_compare_timestamps(&timestamps[i], &threshold, &expected), DT_OK);
+        EXPECT_EQ(compares[i], expected);
+    }
+    EXPECT_EQ(dt_timestamp_columns_compare(seconds, nano_seconds, count, &threshold, compares), DT_OK);
+    EXPECT_EQ(compares[5], DT_EQUALS);
+
+    EXPECT_EQ(dt_timestamps_min_max(timestamps, count, &min, &max), DT_OK);
+    EXPECT_EQ(min.second, timestamps[2].second);
+    EXPECT_EQ(min.nano_second, timestamps[2].nano_second);
+    EXPECT_EQ(max.second, timestamps[9].second);
+    EXPECT_EQ(max.nano_second, timestamps[9].nano_second);
+    EXPECT_EQ(dt_timestamp_columns_min_max(seconds, nano_seconds, 1, &min, &max), DT_OK);
+    EXPECT_EQ(min.second, timestamps[0].second);
+    EXPECT_EQ(max.second, timestamps[0].second);
+
+    // Results are written over the source one
+    o.is_forward = DT_TRUE;
+    EXPECT_EQ(dt_timestamps_apply_offset(timestamps, count, &o, timestamps), DT_OK);
+    EXPECT_EQ(timestamps[0].second, 1388534400L);
+    EXPECT_EQ(timestamps[0].nano_second, 900000000UL);
+
+    EXPECT_EQ(dt_timestamps_apply_offset(NULL, count, &o, results), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_apply_offset(timestamps, count, NULL, results), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_min_max(timestamps, 0, &min, &max), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_compare(timestamps, count, &invalid_timestamp, compares), DT_INVALID_ARGUMENT);
+    nano_seconds[7] = MAX_NANOSECONDS + 1;
+    EXPECT_EQ(dt_timestamp_columns_apply_offset(seconds, nano_seconds, count, &o, result_seconds,
+              result_nano_seconds), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamp_columns_min_max(seconds, nano_seconds, count, &min, &max), DT_INVALID_ARGUMENT);
+
+    nano_seconds[7] = 0;
+    seconds[9] = LONG_MAX - 100;
+    EXPECT_EQ(dt_timestamp_columns_apply_offset(seconds, nano_seconds, count, &o, result_seconds,
+              result_nano_seconds), DT_OVERFLOW);
+    o.is_forward = DT_FALSE;
+    EXPECT_EQ(dt_timestamp_columns_apply_offset(seconds, nano_seconds, count, &o, result_seconds,
+              result_nano_seconds), DT_OK);
+    seconds[3] = LONG_MIN + 100;
+    EXPECT_EQ(dt_timestamp_columns_apply_offset(seconds, nano_seconds, count, &o, result_seconds,
+              result_nano_seconds), DT_OVERFLOW);
+}
+
+TEST_F(DtCase, timestamps_sort_search)
+{
+    // Enough timestamps for radix sort, with equal ones to check it is stable, and seconds of both signs
+    const size_t count = 200;
+    dt_timestamp_t timestamps[count];
+    dt_timestamp_t sorted[count];
+    size_t permutation[count];
+    long seconds[count];
+    unsigned long nano_seconds[count];
+    dt_timestamp_t value = {0,};
+    size_t index = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        timestamps[i].second = (long) ((i * 37) % 50) - 25;
+        timestamps[i].nano_second = (unsigned long) (i % 3) * 300000000UL;
+        sorted[i] = timestamps[i];
+    }
+    timestamps[7].second = LONG_MIN;
+    timestamps[8].second = LONG_MAX;
+    sorted[7] = timestamps[7];
+    sorted[8] = timestamps[8];
+
+    EXPECT_EQ(dt_timestamps_sort(sorted, count, permutation), DT_OK);
+    EXPECT_EQ(sorted[0].second, LONG_MIN);
+    EXPECT_EQ(sorted[count - 1].second, LONG_MAX);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(sorted[i].second, timestamps[permutation[i]].second);
+        EXPECT_EQ(sorted[i].nano_second, timestamps[permutation[i]].nano_second);
+        if (i > 0) {
+            dt_compare_result_t result = DT_EQUALS;
+            EXPECT_EQ(dt_compare_timestamps(&sorted[i - 1], &sorted[i], &result), DT_OK);
+            EXPECT_NE(result, DT_GREATER);
+            if (result == DT_EQUALS) {
+                EXPECT_LT(permutation[i - 1], permutation[i]);
+            }
+        }
+        seconds[i] = sorted[i].second;
+        nano_seconds[i] = sorted[i].nano_second;
+    }
+
+    // Small arrays are sorted by insertion
+    EXPECT_EQ(dt_timestamps_sort(timestamps, 10, NULL), DT_OK);
+    EXPECT_EQ(timestamps[0].second, LONG_MIN);
+    EXPECT_EQ(timestamps[9].second, LONG_MAX);
+
+    value.second = 0;
+    value.nano_second = 300000000UL;
+    EXPECT_EQ(dt_timestamps_lower_bound(sorted, count, &value, &index), DT_OK);
+    EXPECT_EQ(sorted[index].second, 0);
+    EXPECT_EQ(sorted[index].nano_second, 300000000UL);
+    EXPECT_EQ(sorted[index - 1].nano_second, 0UL);
+    EXPECT_EQ(dt_timestamps_upper_bound(sorted, count, &value, &index), DT_OK);
+    EXPECT_EQ(sorted[index].nano_second, 600000000UL);
+    EXPECT_EQ(sorted[index - 1].nano_second, 300000000UL);
+    EXPECT_EQ(dt_timestamp_columns_upper_bound(seconds, nano_seconds, count, &value, &index), DT_OK);
+    EXPECT_EQ(sorted[index].nano_second, 600000000UL);
+    value.second = LONG_MIN;
+    value.nano_second = 0;
+    EXPECT_EQ(dt_timestamp_columns_lower_bound(seconds, nano_seconds, count, &value, &index), DT_OK);
+    EXPECT_EQ(index, 0UL);
+    value.second = LONG_MAX;
+    value.nano_second = MAX_NANOSECONDS;
+    EXPECT_EQ(dt_timestamps_upper_bound(sorted, count, &value, &index), DT_OK);
+    EXPECT_EQ(index, count);
+    EXPECT_EQ(dt_timestamps_lower_bound(sorted, 0, &value, &index), DT_OK);
+    EXPECT_EQ(index, 0UL);
+
+    EXPECT_EQ(dt_timestamps_sort(NULL, count, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_lower_bound(sorted, count, &invalid_timestamp, &index), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_upper_bound(sorted, count, &value, NULL), DT_INVALID_ARGUMENT);
+    sorted[5].nano_second = MAX_NANOSECONDS + 1;
+    EXPECT_EQ(dt_timestamps_sort(sorted, count, NULL), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, ns_conversions)
+{
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t rt = {0,};
+    dt_interval_t i = {0,};
+    dt_offset_t o = {0,};
+    dt_offset_t ro = {0,};
+    dt_ns_t ns = 0;
+
+    // Timestamps before the epoch have nano-seconds counted forward from their second
+    t.second = -2;
+    t.nano_second = 250000000UL;
+    EXPECT_EQ(dt_timestamp_to_ns(&t, &ns), DT_OK);
+    EXPECT_EQ(ns, -1750000000LL);
+    EXPECT_EQ(dt_ns_to_timestamp(ns, &rt), DT_OK);
+    EXPECT_EQ(rt.second, -2L);
+    EXPECT_EQ(rt.nano_second, 250000000UL);
+    EXPECT_EQ(dt_ns_to_timestamp(-1, &rt), DT_OK);
+    EXPECT_EQ(rt.second, -1L);
+    EXPECT_EQ(rt.nano_second, MAX_NANOSECONDS);
+
+    // Limits of dt_ns_t are 1677-09-21T00:12:43.145224192Z and 2262-04-11T23:47:16.854775807Z
+    EXPECT_EQ(dt_ns_to_timestamp(DT_NS_MIN, &rt), DT_OK);
+    EXPECT_EQ(rt.second, -9223372037L);
+    EXPECT_EQ(rt.nano_second, 145224192UL);
+    EXPECT_EQ(dt_timestamp_to_ns(&rt, &ns), DT_OK);
+    EXPECT_EQ(ns, DT_NS_MIN);
+    rt.nano_second--;
+    EXPECT_EQ(dt_timestamp_to_ns(&rt, &ns), DT_OVERFLOW);
+    EXPECT_EQ(dt_ns_to_timestamp(DT_NS_MAX, &rt), DT_OK);
+    EXPECT_EQ(rt.second, 9223372036L);
+    EXPECT_EQ(rt.nano_second, 854775807UL);
+    EXPECT_EQ(dt_timestamp_to_ns(&rt, &ns), DT_OK);
+    EXPECT_EQ(ns, DT_NS_MAX);
+    rt.nano_second++;
+    EXPECT_EQ(dt_timestamp_to_ns(&rt, &ns), DT_OVERFLOW);
+    t.second = LONG_MAX;
+    EXPECT_EQ(dt_timestamp_to_ns(&t, &ns), DT_OVERFLOW);
+    t.second = LONG_MIN;
+    EXPECT_EQ(dt_timestamp_to_ns(&t, &ns), DT_OVERFLOW);
+
+    EXPECT_EQ(dt_init_interval(3UL, 500000000UL, &i), DT_OK);
+    EXPECT_EQ(dt_interval_to_ns(&i, &ns), DT_OK);
+    EXPECT_EQ(ns, 3500000000LL);
+    EXPECT_EQ(dt_ns_to_interval(ns + 600000000LL, &i), DT_OK);
+    EXPECT_EQ(i.seconds, 4UL);
+    EXPECT_EQ(i.nano_seconds, 100000000UL);
+    EXPECT_EQ(dt_ns_to_interval(-1, &i), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_interval_to_ns(&overflowable_interval, &ns), DT_OVERFLOW);
+
+    // Backward offsets are negative, zero one is forward
+    EXPECT_EQ(dt_ns_to_offset(-3500000000LL, &o), DT_OK);
+    EXPECT_EQ(o.is_forward, DT_FALSE);
+    EXPECT_EQ(o.duration.seconds, 3UL);
+    EXPECT_EQ(o.duration.nano_seconds, 500000000UL);
+    EXPECT_EQ(dt_offset_to_ns(&o, &ns), DT_OK);
+    EXPECT_EQ(ns, -3500000000LL);
+    EXPECT_EQ(dt_ns_to_offset(0, &o), DT_OK);
+    EXPECT_EQ(o.is_forward, DT_TRUE);
+    EXPECT_EQ(dt_ns_to_offset(DT_NS_MIN, &o), DT_OK);
+    EXPECT_EQ(dt_offset_to_ns(&o, &ns), DT_OK);
+    EXPECT_EQ(ns, DT_NS_MIN);
+    o.is_forward = DT_TRUE;
+    EXPECT_EQ(dt_offset_to_ns(&o, &ns), DT_OVERFLOW);
+
+    // Offset between timestamps is their difference in nano-seconds
+    t.second = 1000;
+    t.nano_second = 900000000UL;
+    rt.second = 998;
+    rt.nano_second = 100000000UL;
+    EXPECT_EQ(dt_offset_between(&t, &rt, &o), DT_OK);
+    EXPECT_EQ(dt_offset_to_ns(&o, &ns), DT_OK);
+    EXPECT_EQ(ns, -2800000000LL);
+    EXPECT_EQ(dt_ns_to_offset(ns, &ro), DT_OK);
+    EXPECT_EQ(ro.is_forward, o.is_forward);
+    EXPECT_EQ(ro.duration.seconds, o.duration.seconds);
+    EXPECT_EQ(ro.duration.nano_seconds, o.duration.nano_seconds);
+
+    EXPECT_EQ(dt_timestamp_to_ns(NULL, &ns), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamp_to_ns(&t, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_ns_to_timestamp(0, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_interval_to_ns(&invalid_interval, &ns), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_offset_to_ns(NULL, &ns), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_ns_to_offset(0, NULL), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, ns_arithmetic)
+{
+    dt_ns_t ns = 0;
+
+    EXPECT_EQ(dt_ns_add(1500000000LL, -2000000000LL, &ns), DT_OK);
+    EXPECT_EQ(ns, -500000000LL);
+    EXPECT_EQ(dt_ns_sub(1500000000LL, -2000000000LL, &ns), DT_OK);
+    EXPECT_EQ(ns, 3500000000LL);
+    EXPECT_EQ(dt_ns_add(DT_NS_MAX, -1, &ns), DT_OK);
+    EXPECT_EQ(ns, DT_NS_MAX - 1);
+    EXPECT_EQ(dt_ns_add(DT_NS_MAX, 1, &ns), DT_OVERFLOW);
+    EXPECT_EQ(dt_ns_add(DT_NS_MIN, -1, &ns), DT_OVERFLOW);
+    EXPECT_EQ(dt_ns_sub(0, DT_NS_MIN, &ns), DT_OVERFLOW);
+    EXPECT_EQ(dt_ns_sub(-1, DT_NS_MIN, &ns), DT_OK);
+    EXPECT_EQ(ns, DT_NS_MAX);
+    EXPECT_EQ(dt_ns_sub(DT_NS_MIN, 1, &ns), DT_OVERFLOW);
+    EXPECT_EQ(dt_ns_add(0, 0, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_ns_sub(0, 0, NULL), DT_INVALID_ARGUMENT);
+
+    EXPECT_EQ(dt_ns_add_saturated(DT_NS_MAX - 5, 10), DT_NS_MAX);
+    EXPECT_EQ(dt_ns_add_saturated(DT_NS_MIN + 5, -10), DT_NS_MIN);
+    EXPECT_EQ(dt_ns_add_saturated(-5, 10), 5);
+    EXPECT_EQ(dt_ns_sub_saturated(DT_NS_MIN + 5, 10), DT_NS_MIN);
+    EXPECT_EQ(dt_ns_sub_saturated(0, DT_NS_MIN), DT_NS_MAX);
+    EXPECT_EQ(dt_ns_sub_saturated(5, 10), -5);
+
+    EXPECT_EQ(dt_ns_compare(DT_NS_MIN, DT_NS_MAX), DT_LESSER);
+    EXPECT_EQ(dt_ns_compare(DT_NS_MAX, -1), DT_GREATER);
+    EXPECT_EQ(dt_ns_compare(7, 7), DT_EQUALS);
+}
+
+TEST_F(DtCase, unchecked_arithmetic)
+{
+    const long seconds[] = {LONG_MIN, -86400L, -1L, 0L, 1L, 1388534400L, LONG_MAX};
+    const unsigned long nano_seconds[] = {0UL, 1UL, 500000000UL, MAX_NANOSECONDS};
+    const size_t seconds_count = sizeof(seconds) / sizeof(seconds[0]);
+    const size_t nano_seconds_count = sizeof(nano_seconds) / sizeof(nano_seconds[0]);
+    dt_timestamp_t lhs = {0,};
+    dt_timestamp_t rhs = {0,};
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t ut = {0,};
+    dt_offset_t o = {0,};
+    dt_offset_t uo = {0,};
+    dt_interval_t li = {0,};
+    dt_interval_t ri = {0,};
+    dt_interval_t i = {0,};
+    dt_interval_t ui = {0,};
+    dt_compare_result_t cr = DT_EQUALS;
+
+    // Checked functions give the unchecked results whenever they succeed
+    for (size_t j = 0; j < seconds_count * nano_seconds_count; j++) {
+        for (size_t k = 0; k < seconds_count * nano_seconds_count; k++) {
+            lhs.second = seconds[j / nano_seconds_count];
+            lhs.nano_second = nano_seconds[j % nano_seconds_count];
+            rhs.second = seconds[k / nano_seconds_count];
+            rhs.nano_second = nano_seconds[k % nano_seconds_count];
+            EXPECT_EQ(dt_compare_timestamps(&lhs, &rhs, &cr), DT_OK);
+            EXPECT_EQ(dt_compare_timestamps_unchecked(&lhs, &rhs), cr);
+            EXPECT_EQ(dt_offset_between(&lhs, &rhs, &o), DT_OK);
+            uo = dt_offset_between_unchecked(&lhs, &rhs);
+            EXPECT_EQ(uo.duration.seconds, o.duration.seconds);
+            EXPECT_EQ(uo.duration.nano_seconds, o.duration.nano_seconds);
+            EXPECT_EQ(uo.is_forward, o.is_forward);
+
+            o.duration.seconds = (unsigned long) rhs.second;
+            o.duration.nano_seconds = rhs.nano_second;
+            o.is_forward = (k % 2 == 0) ? DT_TRUE : DT_FALSE;
+            if (dt_apply_offset(&lhs, &o, &t) == DT_OK) {
+                ut = dt_apply_offset_unchecked(&lhs, &o);
+                EXPECT_EQ(ut.second, t.second);
+                EXPECT_EQ(ut.nano_second, t.nano_second);
+            }
+
+            li.seconds = (unsigned long) lhs.second;
+            li.nano_seconds = lhs.nano_second;
+            ri.seconds = (unsigned long) rhs.second;
+            ri.nano_seconds = rhs.nano_second;
+            EXPECT_EQ(dt_compare_intervals(&li, &ri, &cr), DT_OK);
+            EXPECT_EQ(dt_compare_intervals_unchecked(&li, &ri), cr);
+            if (dt_sum_intervals(&li, &ri, &i) == DT_OK) {
+                ui = dt_sum_intervals_unchecked(&li, &ri);
+                EXPECT_EQ(ui.seconds, i.seconds);
+                EXPECT_EQ(ui.nano_seconds, i.nano_seconds);
+            }
+            if (dt_sub_intervals(&li, &ri, &i) == DT_OK) {
+                ui = dt_sub_intervals_unchecked(&li, &ri);
+                EXPECT_EQ(ui.seconds, i.seconds);
+                EXPECT_EQ(ui.nano_seconds, i.nano_seconds);
+            }
+        }
+    }
+
+    // Offset between timestamps brings one of them to the other
+    lhs.second = -5;
+    lhs.nano_second = 700000000UL;
+    rhs.second = 3;
+    rhs.nano_second = 200000000UL;
+    uo = dt_offset_between_unchecked(&rhs, &lhs);
+    EXPECT_EQ(uo.is_forward, DT_FALSE);
+    EXPECT_EQ(uo.duration.seconds, 7UL);
+    EXPECT_EQ(uo.duration.nano_seconds, 500000000UL);
+    ut = dt_apply_offset_unchecked(&rhs, &uo);
+    EXPECT_EQ(ut.second, lhs.second);
+    EXPECT_EQ(ut.nano_second, lhs.nano_second);
+}
+
 TEST_F(DtCase, init_representation)
 {
     dt_representation_t r = {0,};
@@ -779,6 +1223,16 @@ TEST_F(DtCase, representation_day_of_week)
     EXPECT_TRUE(dt_init_representation(2013, 8, 18, 8, 0, 0, 0, &r) == DT_OK);
     EXPECT_EQ(dt_representation_day_of_week(&r, &dow), DT_OK);
     EXPECT_EQ(dow, 1);
+    // Years where century corrections matter
+    EXPECT_TRUE(dt_init_representation(2000, 1, 1, 8, 0, 0, 0, &r) == DT_OK);
+    EXPECT_EQ(dt_representation_day_of_week(&r, &dow), DT_OK);
+    EXPECT_EQ(dow, 7);
+    EXPECT_TRUE(dt_init_representation(2020, 2, 29, 8, 0, 0, 0, &r) == DT_OK);
+    EXPECT_EQ(dt_representation_day_of_week(&r, &dow), DT_OK);
+    EXPECT_EQ(dow, 7);
+    EXPECT_TRUE(dt_init_representation(1900, 3, 1, 8, 0, 0, 0, &r) == DT_OK);
+    EXPECT_EQ(dt_representation_day_of_week(&r, &dow), DT_OK);
+    EXPECT_EQ(dow, 5);
 }
 
 TEST_F(DtCase, representation_day_of_year)
@@ -1046,15 +1500,822 @@ TEST_F(DtCase, lookup_free_timezone)
 
 }
 
+TEST_F(DtCase, lookup_shared_timezone)
+{
+    dt_timezone_t tz_first = {0,};
+    dt_timezone_t tz_second = {0,};
+    dt_timezone_t tz_alias = {0,};
+    dt_timestamp_t t = {0,};
+    dt_representation_t r = {0,};
+
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_OLSEN_TZ_NAME, &tz_first), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_OLSEN_TZ_NAME, &tz_second), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_WINDOWS_STANDARD_TZ_NAME, &tz_alias), DT_OK);
+#ifndef _WIN32
+    // Same timezone is loaded only once
+    EXPECT_TRUE(tz_first.state == tz_second.state);
+    EXPECT_TRUE(tz_first.state == tz_alias.state);
+#endif
+
+    // Cleanup of one object must not affect the others
+    EXPECT_EQ(dt_timezone_cleanup(&tz_first), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_alias), DT_OK);
+    EXPECT_EQ(dt_init_representation(2013, 1, 15, 8, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_second, &t, NULL), DT_OK);
+    EXPECT_EQ(t.second, 1358222400L);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_second), DT_OK);
+
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_OLSEN_TZ_NAME, &tz_first), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, &tz_first, &r), DT_OK);
+    EXPECT_EQ(r.hour, 8);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_first), DT_OK);
+}
+
+#ifndef _WIN32
+#define HINT_THREAD_CONVERSIONS 200000
+
+// Converts timestamps alternating between summer and winter with a shared timezone object
+static void *convert_with_shared_timezone(void *timezone)
+{
+    dt_timestamp_t t = {0,};
+    dt_representation_t r = {0,};
+    int i = 0;
+
+    for (i = 0; i < HINT_THREAD_CONVERSIONS; i++) {
+        t.second = (i % 2 == 0) ? 1372636800L : 1358208000L;
+        dt_timestamp_to_representation(&t, (const dt_timezone_t *) timezone, &r);
+    }
+    return NULL;
+}
+#endif
+
+TEST_F(DtCase, transition_hint)
+{
+    dt_timezone_t tz = {0,};
+    dt_timestamp_t t = {0,};
+    dt_representation_t r = {0,};
+    unsigned long hits = 0;
+    unsigned long misses = 0;
+    int i = 0;
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz), DT_OK);
+    EXPECT_EQ(dt_timezone_hint_stats(&tz, &hits, &misses), DT_OK);
+    EXPECT_EQ(hits, 0UL);
+    EXPECT_EQ(misses, 0UL);
+
+    // Sorted timestamps of one summer day
+    for (i = 0; i < 24; i++) {
+        t.second = 1372636800L + i * DT_SECONDS_PER_HOUR;   // 2013-07-01 00:00:00 UTC
+        EXPECT_EQ(dt_timestamp_to_representation(&t, &tz, &r), DT_OK);
+        EXPECT_EQ(r.hour, (i + 2) % 24);
+    }
+    // Jumping to winter must not reuse the summer offset
+    t.second = 1358208000L;   // 2013-01-15 00:00:00 UTC
+    EXPECT_EQ(dt_timestamp_to_representation(&t, &tz, &r), DT_OK);
+    EXPECT_EQ(r.hour, 1);
+    t.second = 1372636800L;
+    EXPECT_EQ(dt_timestamp_to_representation(&t, &tz, &r), DT_OK);
+    EXPECT_EQ(r.hour, 2);
+
+    EXPECT_EQ(dt_timezone_hint_stats(&tz, &hits, &misses), DT_OK);
+#ifndef _WIN32
+    EXPECT_EQ(hits, 23UL);
+    EXPECT_EQ(misses, 3UL);
+
+    // Counters do not lose increments of threads sharing the object
+    {
+        pthread_t threads[4];
+        unsigned long hits_after = 0;
+        unsigned long misses_after = 0;
+
+        for (i = 0; i < 4; i++) {
+            EXPECT_EQ(pthread_create(&threads[i], NULL, convert_with_shared_timezone, &tz), 0);
+        }
+        for (i = 0; i < 4; i++) {
+            EXPECT_EQ(pthread_join(threads[i], NULL), 0);
+        }
+        EXPECT_EQ(dt_timezone_hint_stats(&tz, &hits_after, &misses_after), DT_OK);
+        EXPECT_EQ(hits_after - hits + misses_after - misses, 4UL * HINT_THREAD_CONVERSIONS);
+    }
+#endif
+    EXPECT_EQ(dt_timezone_hint_stats(NULL, &hits, &misses), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_hint_stats(&tz, NULL, &misses), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+}
+
+TEST_F(DtCase, timestamps_to_representations)
+{
+    const char *timezone_names[] = {BERLIN_TZ_NAME, MOSCOW_TZ_NAME, UTC_TZ_NAME, GMT_PLUS_5_TZ_NAME};
+    const size_t count = 1000;
+    dt_timezone_t tz = {0,};
+    dt_timestamp_t timestamps[count];
+    dt_representation_t batch[count];
+    dt_representation_t scalar = {0,};
+    unsigned long long seed = 12345;
+    size_t i = 0;
+    size_t j = 0;
+
+    for (i = 0; i < count; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        // Mostly sorted timestamps in 1900-2100 with some random ones far away from them
+        if (i % 10 == 0) {
+            timestamps[i].second = (long)(seed >> 32) * ((i % 20 == 0) ? 1L : -1L);
+        } else {
+            timestamps[i].second = -2208988800L + (long)(i * 6311390L) + (long)((seed >> 40) % 86400);
+        }
+        timestamps[i].nano_second = (unsigned long)((seed >> 8) % 1000000000ULL);
+    }
+    timestamps[0].second = 0;
+    timestamps[1].second = -1;
+
+    for (j = 0; j < sizeof(timezone_names) / sizeof(timezone_names[0]); j++) {
+        EXPECT_EQ(dt_timezone_lookup(timezone_names[j], &tz), DT_OK);
+        EXPECT_EQ(dt_timestamps_to_representations(timestamps, count, &tz, batch), DT_OK);
+        for (i = 0; i < count; i++) {
+            EXPECT_EQ(dt_timestamp_to_representation(&timestamps[i], &tz, &scalar), DT_OK);
+            EXPECT_EQ(batch[i].year, scalar.year);
+            EXPECT_EQ(batch[i].month, scalar.month);
+            EXPECT_EQ(batch[i].day, scalar.day);
+            EXPECT_EQ(batch[i].hour, scalar.hour);
+            EXPECT_EQ(batch[i].minute, scalar.minute);
+            EXPECT_EQ(batch[i].second, scalar.second);
+            EXPECT_EQ(batch[i].nano_second, scalar.nano_second);
+        }
+        EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+    }
+
+    EXPECT_EQ(dt_timestamps_to_representations(timestamps, 0, NULL, NULL), DT_OK);
+    EXPECT_EQ(dt_timestamps_to_representations(NULL, count, NULL, batch), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamps_to_representations(timestamps, count, NULL, NULL), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, timestamp_to_representations_multi)
+{
+    const char *timezone_names[] = {BERLIN_TZ_NAME, MOSCOW_TZ_NAME, UTC_TZ_NAME, GMT_PLUS_5_TZ_NAME};
+    const size_t named_count = sizeof(timezone_names) / sizeof(timezone_names[0]);
+    const size_t count = named_count + 3;
+    // Ends of days, months and years in UTC, in Berlin and in far offsets around the epoch and a leap day
+    const long seconds[] = {0L, -1L, 1388534399L, 1388534400L, 1388530800L, 951782400L, 951868799L, 1372672800L,
+                            -2208988800L, 4102444799L
+                           };
+    dt_timezone_t named[named_count];
+    dt_timezone_t east = {0,};
+    dt_timezone_t west = {0,};
+    const dt_timezone_t *timezones[count];
+    dt_representation_t multi[count];
+    dt_representation_t scalar = {0,};
+    dt_timestamp_t t = {0,};
+    unsigned long long seed = 12345;
+    size_t i = 0;
+    size_t j = 0;
+
+    for (j = 0; j < named_count; j++) {
+        EXPECT_EQ(dt_timezone_lookup(timezone_names[j], &named[j]), DT_OK);
+        timezones[j] = &named[j];
+    }
+    EXPECT_EQ(dt_timezone_fixed(14 * 3600, &east), DT_OK);
+    EXPECT_EQ(dt_timezone_fixed(-12 * 3600 - 1800, &west), DT_OK);
+    timezones[named_count] = &east;
+    timezones[named_count + 1] = &west;
+    timezones[named_count + 2] = NULL;
+
+    for (i = 0; i < 1000; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        if (i < sizeof(seconds) / sizeof(seconds[0])) {
+            t.second = seconds[i];
+        } else {
+            t.second = -2208988800L + (long)((seed >> 20) % 6311390400ULL);
+        }
+        t.nano_second = (unsigned long)((seed >> 8) % 1000000000ULL);
+        EXPECT_EQ(dt_timestamp_to_representations_multi(&t, timezones, count, multi), DT_OK);
+        for (j = 0; j < count; j++) {
+            EXPECT_EQ(dt_timestamp_to_representation(&t, timezones[j], &scalar), DT_OK);
+            ASSERT_EQ(multi[j].year, scalar.year);
+            ASSERT_EQ(multi[j].month, scalar.month);
+            ASSERT_EQ(multi[j].day, scalar.day);
+            ASSERT_EQ(multi[j].hour, scalar.hour);
+            ASSERT_EQ(multi[j].minute, scalar.minute);
+            ASSERT_EQ(multi[j].second, scalar.second);
+            ASSERT_EQ(multi[j].nano_second, scalar.nano_second);
+        }
+    }
+
+    // Timestamps near the limits are converted as by dt_timestamp_to_representation()
+    for (i = 0; i < 4; i++) {
+        const long limits[] = {LONG_MIN, LONG_MIN + 5, LONG_MAX - 5, LONG_MAX};
+        dt_status_t expected = DT_OK;
+        dt_status_t status = DT_OK;
+        dt_timestamp_t edge = {0,};
+
+        edge.second = limits[i];
+        memset(multi, 0, sizeof(multi));
+        for (j = 0; j < count; j++) {
+            status = dt_timestamp_to_representation(&edge, timezones[j], &scalar);
+            if (status != DT_OK && expected == DT_OK) {
+                expected = status;
+            }
+        }
+        EXPECT_EQ(dt_timestamp_to_representations_multi(&edge, timezones, count, multi), expected);
+        for (j = 0; j < count; j++) {
+            memset(&scalar, 0, sizeof(scalar));
+            if (dt_timestamp_to_representation(&edge, timezones[j], &scalar) == DT_OK) {
+                EXPECT_EQ(multi[j].year, scalar.year);
+                EXPECT_EQ(multi[j].day, scalar.day);
+                EXPECT_EQ(multi[j].second, scalar.second);
+            }
+        }
+    }
+
+#ifndef _WIN32
+    // Timezone cleaned up fails alone
+    EXPECT_EQ(dt_timezone_cleanup(&named[1]), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representations_multi(&t, timezones, count, multi), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, timezones[2], &scalar), DT_OK);
+    EXPECT_EQ(multi[2].hour, scalar.hour);
+    EXPECT_EQ(multi[2].day, scalar.day);
+#endif
+    for (j = 0; j < named_count; j++) {
+        dt_timezone_cleanup(&named[j]);
+    }
+
+    EXPECT_EQ(dt_timestamp_to_representations_multi(&t, NULL, 0, NULL), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representations_multi(NULL, timezones, count, multi), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timestamp_to_representations_multi(&t, NULL, count, multi), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, stream_converter)
+{
+    const char *timezone_names[] = {BERLIN_TZ_NAME, MOSCOW_TZ_NAME, UTC_TZ_NAME, GMT_PLUS_5_TZ_NAME};
+    dt_timezone_t tz = {0,};
+    dt_stream_converter_t converter;
+    dt_timestamp_t t = {0,};
+    dt_representation_t streamed = {0,};
+    dt_representation_t expected = {0,};
+    unsigned long long seed = 12345;
+    size_t i = 0;
+    size_t j = 0;
+
+    for (j = 0; j < sizeof(timezone_names) / sizeof(timezone_names[0]) + 1; j++) {
+        // Local timezone is the last one
+        if (j < sizeof(timezone_names) / sizeof(timezone_names[0])) {
+            EXPECT_EQ(dt_timezone_lookup(timezone_names[j], &tz), DT_OK);
+            EXPECT_EQ(dt_stream_converter_init(&tz, &converter), DT_OK);
+        } else {
+            EXPECT_EQ(dt_stream_converter_init(NULL, &converter), DT_OK);
+        }
+        // Mostly small steps through years with DST changes and a step back from time to time
+        t.second = 1293840000L;
+        for (i = 0; i < 100000; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            if (i % 1000 == 999) {
+                t.second -= (long)((seed >> 33) % 100000);
+            } else if (i % 100 == 99) {
+                t.second += (long)((seed >> 33) % 200000);
+            } else {
+                t.second += (long)((seed >> 33) % 90);
+            }
+            t.nano_second = (unsigned long)((seed >> 8) % 1000000000ULL);
+            EXPECT_EQ(dt_stream_converter_convert(&converter, &t, &streamed), DT_OK);
+            EXPECT_EQ(dt_timestamp_to_representation(&t, j < sizeof(timezone_names) / sizeof(timezone_names[0]) ? &tz : NULL,
+                                                     &expected), DT_OK);
+            ASSERT_EQ(streamed.year, expected.year);
+            ASSERT_EQ(streamed.month, expected.month);
+            ASSERT_EQ(streamed.day, expected.day);
+            ASSERT_EQ(streamed.hour, expected.hour);
+            ASSERT_EQ(streamed.minute, expected.minute);
+            ASSERT_EQ(streamed.second, expected.second);
+            ASSERT_EQ(streamed.nano_second, expected.nano_second);
+        }
+        if (j < sizeof(timezone_names) / sizeof(timezone_names[0])) {
+            EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+        }
+    }
+
+    // Timestamps near the limits are converted as by dt_timestamp_to_representation(), cached ones in between too
+    for (j = 0; j < 2; j++) {
+        const long limits[] = {LONG_MIN, LONG_MIN + 5, -43200000000000L, 0, 43199999999999L, 43200000000000L,
+                               43200000000001L, LONG_MAX - 5, LONG_MAX
+                              };
+        dt_status_t status = DT_UNKNOWN_ERROR;
+
+        EXPECT_EQ(j == 0 ? dt_timezone_lookup(BERLIN_TZ_NAME, &tz) : dt_timezone_fixed(-5 * 3600L, &tz), DT_OK);
+        EXPECT_EQ(dt_stream_converter_init(&tz, &converter), DT_OK);
+        for (i = 0; i < sizeof(limits) / sizeof(limits[0]); i++) {
+            t.second = limits[i];
+            t.nano_second = 0;
+            memset(&expected, 0, sizeof(expected));
+            memset(&streamed, 0, sizeof(streamed));
+            status = dt_timestamp_to_representation(&t, &tz, &expected);
+            EXPECT_EQ(dt_stream_converter_convert(&converter, &t, &streamed), status);
+            if (status == DT_OK) {
+                EXPECT_EQ(streamed.year, expected.year);
+                EXPECT_EQ(streamed.day, expected.day);
+                EXPECT_EQ(streamed.second, expected.second);
+            }
+        }
+        EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+    }
+
+    EXPECT_EQ(dt_stream_converter_init(NULL, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_stream_converter_convert(&converter, NULL, &streamed), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_stream_converter_convert(NULL, &t, &streamed), DT_INVALID_ARGUMENT);
+}
+
+#ifndef _WIN32
+TEST_F(DtCase, representation_to_timestamp_policy)
+{
+    dt_representation_t r = {0,};
+    dt_timestamp_t first = {0,};
+    dt_timestamp_t second = {0,};
+    dt_timezone_t tz = {0,};
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz), DT_OK);
+
+    // Usual time has one timestamp
+    EXPECT_EQ(dt_init_representation(2013, 7, 1, 12, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_OK);
+    EXPECT_EQ(first.second, 1372672800L);
+    EXPECT_EQ(second.second, first.second);
+
+    // Double time 2:30 27.10.2013 has both of them
+    EXPECT_EQ(dt_init_representation(2013, 10, 27, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_OK);
+    EXPECT_EQ(first.second, 1382833800L);
+    EXPECT_EQ(second.second, 1382837400L);
+
+    // Non existing time 2:30 31.03.2013
+    EXPECT_EQ(dt_init_representation(2013, 3, 31, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_representation_to_timestamp_policy(&r, &tz, DT_GAP_REJECT, &first, &second), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_representation_to_timestamp_policy(&r, &tz, DT_GAP_EARLIEST, &first, &second), DT_OK);
+    EXPECT_EQ(first.second, 1364689800L);
+    EXPECT_EQ(second.second, first.second);
+    EXPECT_EQ(dt_representation_to_timestamp_policy(&r, &tz, DT_GAP_LATEST, &first, NULL), DT_OK);
+    EXPECT_EQ(first.second, 1364693400L);
+    EXPECT_EQ(dt_representation_to_timestamp_policy(&r, &tz, DT_GAP_SHIFT_FORWARD, &first, NULL), DT_OK);
+    EXPECT_EQ(first.second, 1364691600L);
+
+    EXPECT_EQ(dt_representation_to_timestamp_policy(NULL, &tz, DT_GAP_LATEST, &first, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+}
+#endif
+
+TEST_F(DtCase, convert_representation)
+{
+    const char *timezone_names[] = {BERLIN_TZ_NAME, MOSCOW_TZ_NAME, GMT_PLUS_5_TZ_NAME};
+    const size_t zone_count = sizeof(timezone_names) / sizeof(timezone_names[0]);
+    const size_t count = 2000;
+    dt_timezone_t zones[zone_count];
+    dt_timezone_t fixed = {0,};
+    const dt_timezone_t *from = NULL;
+    const dt_timezone_t *to = NULL;
+    dt_representation_t representations[count];
+    dt_representation_t batch[count];
+    dt_representation_t r = {0,};
+    dt_representation_t converted = {0,};
+    dt_representation_t expected = {0,};
+    dt_timestamp_t t = {0,};
+    dt_status_t status = DT_UNKNOWN_ERROR;
+    unsigned long long seed = 12345;
+    size_t i = 0;
+    size_t j = 0;
+    size_t k = 0;
+
+    // Summer time in Berlin is 2 hours behind Moscow time of 2013
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &zones[0]), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &zones[1]), DT_OK);
+    EXPECT_EQ(dt_init_representation(2013, 7, 1, 12, 0, 0, 500, &r), DT_OK);
+    EXPECT_EQ(dt_convert_representation(&r, &zones[0], &zones[1], &converted), DT_OK);
+    EXPECT_EQ(converted.year, 2013);
+    EXPECT_EQ(converted.month, 7);
+    EXPECT_EQ(converted.day, 1);
+    EXPECT_EQ(converted.hour, 14);
+    EXPECT_EQ(converted.minute, 0);
+    EXPECT_EQ(converted.nano_second, 500);
+#ifndef _WIN32
+    // Non existing time is rejected, double time is the earlier one
+    EXPECT_EQ(dt_init_representation(2013, 3, 31, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_convert_representation(&r, &zones[0], &zones[1], &converted), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_init_representation(2013, 10, 27, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_convert_representation(&r, &zones[0], &zones[1], &converted), DT_OK);
+    EXPECT_EQ(converted.hour, 4);
+#endif
+    EXPECT_EQ(dt_timezone_cleanup(&zones[0]), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&zones[1]), DT_OK);
+
+    // Runs of close times through DST changes with jumps from time to time and some fields out of range
+    r.year = 1990;
+    r.month = 1;
+    r.day = 1;
+    r.hour = 0;
+    for (i = 0; i < count; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        if (i % 100 == 99) {
+            r.year = 1900 + (int)((seed >> 33) % 250);
+        }
+        r.month = (i % 50 == 49) ? 13 : 3 + (int)(i / 100 % 2) * 7;
+        r.day = 24 + (int)((seed >> 40) % 8);
+        r.hour = (int)((seed >> 45) % 24);
+        r.minute = (int)((seed >> 50) % 60);
+        r.second = (i % 70 == 69) ? 75 : (int)((seed >> 20) % 60);
+        r.nano_second = (unsigned long)((seed >> 8) % 1000000000ULL);
+        representations[i] = r;
+    }
+
+    EXPECT_EQ(dt_timezone_fixed(-3 * 3600 - 1800, &fixed), DT_OK);
+    for (j = 0; j < zone_count; j++) {
+        EXPECT_EQ(dt_timezone_lookup(timezone_names[j], &zones[j]), DT_OK);
+    }
+    for (j = 0; j < zone_count + 2; j++) {
+        for (k = 0; k < zone_count + 2; k++) {
+            // Fixed offset and local timezones are the last ones
+            from = (j < zone_count) ? &zones[j] : (j == zone_count) ? &fixed : NULL;
+            to = (k < zone_count) ? &zones[k] : (k == zone_count) ? &fixed : NULL;
+            dt_convert_representations(representations, count, from, to, batch);
+            for (i = 0; i < count; i++) {
+                status = dt_representation_to_timestamp(&representations[i], from, &t, NULL);
+                if (status == DT_OK) {
+                    status = dt_timestamp_to_representation(&t, to, &expected);
+                }
+                ASSERT_EQ(dt_convert_representation(&representations[i], from, to, &converted), status);
+                if (status != DT_OK) {
+                    continue;
+                }
+                ASSERT_EQ(converted.year, expected.year);
+                ASSERT_EQ(converted.month, expected.month);
+                ASSERT_EQ(converted.day, expected.day);
+                ASSERT_EQ(converted.hour, expected.hour);
+                ASSERT_EQ(converted.minute, expected.minute);
+                ASSERT_EQ(converted.second, expected.second);
+                ASSERT_EQ(converted.nano_second, expected.nano_second);
+                ASSERT_EQ(batch[i].year, expected.year);
+                ASSERT_EQ(batch[i].day, expected.day);
+                ASSERT_EQ(batch[i].hour, expected.hour);
+                ASSERT_EQ(batch[i].second, expected.second);
+            }
+        }
+    }
+    for (j = 0; j < zone_count; j++) {
+        EXPECT_EQ(dt_timezone_cleanup(&zones[j]), DT_OK);
+    }
+
+    EXPECT_EQ(dt_convert_representation(NULL, NULL, NULL, &converted), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_convert_representation(&r, NULL, NULL, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_convert_representations(representations, 0, NULL, NULL, NULL), DT_OK);
+    EXPECT_EQ(dt_convert_representations(NULL, count, NULL, NULL, batch), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, timezone_offset_at)
+{
+    const char *timezone_names[] = {BERLIN_TZ_NAME, MOSCOW_TZ_NAME, UTC_TZ_NAME, GMT_PLUS_5_TZ_NAME};
+    const size_t count = 1000;
+    dt_timezone_t tz = {0,};
+    dt_timezone_t tz_utc = {0,};
+    dt_timestamp_t timestamps[count];
+    long gmtoffs[count];
+    dt_bool_t is_dst[count];
+    const char *abbreviations[count];
+    dt_representation_t r = {0,};
+    dt_timestamp_t local = {0,};
+    dt_timestamp_t t = {0,};
+    long gmtoff = 0;
+    dt_bool_t dst = DT_FALSE;
+    const char *abbreviation = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz), DT_OK);
+    t.second = 1372672800L;
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, &dst, &abbreviation), DT_OK);
+    EXPECT_EQ(gmtoff, 7200);
+    EXPECT_EQ(dst, DT_TRUE);
+#ifndef _WIN32
+    EXPECT_STREQ(abbreviation, "CEST");
+#endif
+    t.second = 1356998400L;
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, &dst, NULL), DT_OK);
+    EXPECT_EQ(gmtoff, 3600);
+    EXPECT_EQ(dst, DT_FALSE);
+    EXPECT_EQ(dt_timezone_offset_at(&tz, NULL, &gmtoff, &dst, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, NULL, &dst, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+
+    // Offset is the difference between the representation and the timestamp
+    for (i = 0; i < count; i++) {
+        timestamps[i].second = -2208988800L + (long)(i * 6311390L) + (long)(i * 7919L % 86400);
+        timestamps[i].nano_second = 0;
+    }
+    EXPECT_EQ(dt_timezone_fixed(0, &tz_utc), DT_OK);
+    for (j = 0; j < sizeof(timezone_names) / sizeof(timezone_names[0]); j++) {
+        EXPECT_EQ(dt_timezone_lookup(timezone_names[j], &tz), DT_OK);
+        EXPECT_EQ(dt_timezone_offsets_at(&tz, timestamps, count, gmtoffs, is_dst, abbreviations), DT_OK);
+        for (i = 0; i < count; i++) {
+            EXPECT_EQ(dt_timezone_offset_at(&tz, &timestamps[i], &gmtoff, &dst, &abbreviation), DT_OK);
+            EXPECT_EQ(gmtoffs[i], gmtoff);
+            EXPECT_EQ(is_dst[i], dst);
+            EXPECT_TRUE(abbreviations[i] == abbreviation);
+            EXPECT_EQ(dt_timestamp_to_representation(&timestamps[i], &tz, &r), DT_OK);
+            EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_utc, &local, NULL), DT_OK);
+            EXPECT_EQ(local.second - timestamps[i].second, gmtoff);
+        }
+        EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+    }
+    EXPECT_EQ(dt_timezone_cleanup(&tz_utc), DT_OK);
+
+    // Fixed offset timezones are abbreviated as in the timezone database
+    EXPECT_EQ(dt_timezone_fixed(19800, &tz), DT_OK);
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, &dst, &abbreviation), DT_OK);
+    EXPECT_EQ(gmtoff, 19800);
+    EXPECT_EQ(dst, DT_FALSE);
+#ifndef _WIN32
+    EXPECT_STREQ(abbreviation, "+0530");
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("Etc/GMT+3", &tz), DT_OK);
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, NULL, &abbreviation), DT_OK);
+    EXPECT_EQ(gmtoff, -10800);
+    EXPECT_STREQ(abbreviation, "-03");
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(UTC_TZ_NAME, &tz), DT_OK);
+    EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, NULL, &abbreviation), DT_OK);
+    EXPECT_EQ(gmtoff, 0);
+    EXPECT_STREQ(abbreviation, "UTC");
+    // Names of zero offset keep their own abbreviation, as in the timezone database
+    const char *zero_offset_names[] = {"UTC", "Etc/UCT", "Zulu", "Universal", "Z", "GMT", "Etc/GMT", "GMT0",
+                                       "Greenwich", "GMT+0", "Etc/GMT-0"
+                                      };
+    for (size_t i = 0; i < sizeof(zero_offset_names) / sizeof(zero_offset_names[0]); i++) {
+        EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+        EXPECT_EQ(dt_timezone_lookup(zero_offset_names[i], &tz), DT_OK);
+        EXPECT_EQ(dt_timezone_offset_at(&tz, &t, &gmtoff, NULL, &abbreviation), DT_OK);
+        EXPECT_EQ(gmtoff, 0);
+        EXPECT_STREQ(abbreviation, i < 5 ? "UTC" : "GMT") << zero_offset_names[i];
+    }
+#endif
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+
+    EXPECT_EQ(dt_timezone_offsets_at(NULL, timestamps, 0, NULL, NULL, NULL), DT_OK);
+    EXPECT_EQ(dt_timezone_offsets_at(NULL, NULL, count, gmtoffs, NULL, NULL), DT_INVALID_ARGUMENT);
+}
+
+#ifndef _WIN32
+TEST_F(DtCase, timezone_transitions)
+{
+    dt_timezone_t tz = {0,};
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t from = {1356998400L, 0};
+    dt_timestamp_t to = {1388534400L, 0};
+    dt_transition_t transition = {{0,}};
+    dt_transition_iterator_t it;
+    long expected[] = {1364691600L, 1382835600L};
+    size_t i = 0;
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz), DT_OK);
+
+    t.second = 1372672800L;
+    EXPECT_EQ(dt_timezone_next_transition(&tz, &t, &transition), DT_OK);
+    EXPECT_EQ(transition.timestamp.second, 1382835600L);
+    EXPECT_EQ(transition.gmtoff_before, 7200);
+    EXPECT_EQ(transition.gmtoff_after, 3600);
+    EXPECT_EQ(transition.is_dst_before, DT_TRUE);
+    EXPECT_EQ(transition.is_dst_after, DT_FALSE);
+    EXPECT_EQ(dt_timezone_prev_transition(&tz, &t, &transition), DT_OK);
+    EXPECT_EQ(transition.timestamp.second, 1364691600L);
+    EXPECT_EQ(transition.gmtoff_before, 3600);
+    EXPECT_EQ(transition.gmtoff_after, 7200);
+
+    // Transition is in effect from its instant
+    t.second = 1382835600L;
+    EXPECT_EQ(dt_timezone_prev_transition(&tz, &t, &transition), DT_OK);
+    EXPECT_EQ(transition.timestamp.second, 1382835600L);
+    EXPECT_EQ(dt_timezone_next_transition(&tz, &t, &transition), DT_OK);
+    EXPECT_GT(transition.timestamp.second, 1382835600L);
+
+    // Transitions go on by the rule of the timezone far after the last one in the database
+    t.second = 13569465600L;
+    EXPECT_EQ(dt_timezone_next_transition(&tz, &t, &transition), DT_OK);
+    EXPECT_EQ(transition.timestamp.second, 13576813200L);
+    EXPECT_EQ(transition.gmtoff_after, 7200);
+
+    // Range is split by two transitions of 2013, the end of range is not included
+    EXPECT_EQ(dt_timezone_transitions(&tz, &from, &to, &it), DT_OK);
+    for (i = 0; dt_transition_iterate(&it, &transition) == DT_OK; i++) {
+        ASSERT_LT(i, sizeof(expected) / sizeof(expected[0]));
+        EXPECT_EQ(transition.timestamp.second, expected[i]);
+    }
+    EXPECT_EQ(i, 2U);
+    EXPECT_EQ(dt_transition_iterate(&it, &transition), DT_NO_MORE_ITEMS);
+    from.second = 1364691600L;
+    to.second = 1382835600L;
+    EXPECT_EQ(dt_timezone_transitions(&tz, &from, &to, &it), DT_OK);
+    EXPECT_EQ(dt_transition_iterate(&it, &transition), DT_OK);
+    EXPECT_EQ(transition.timestamp.second, 1364691600L);
+    EXPECT_EQ(dt_transition_iterate(&it, &transition), DT_NO_MORE_ITEMS);
+    EXPECT_EQ(dt_timezone_transitions(&tz, &to, &from, &it), DT_OK);
+    EXPECT_EQ(dt_transition_iterate(&it, &transition), DT_NO_MORE_ITEMS);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+
+    // Fixed offset timezone has no transitions
+    EXPECT_EQ(dt_timezone_fixed(3600, &tz), DT_OK);
+    EXPECT_EQ(dt_timezone_next_transition(&tz, &t, &transition), DT_NO_MORE_ITEMS);
+    EXPECT_EQ(dt_timezone_prev_transition(&tz, &t, &transition), DT_NO_MORE_ITEMS);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+
+    EXPECT_EQ(dt_timezone_next_transition(NULL, NULL, &transition), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_transitions(NULL, &from, NULL, &it), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_transition_iterate(NULL, &transition), DT_INVALID_ARGUMENT);
+}
+#endif
+
+#ifndef _WIN32
+TEST_F(DtCase, local_timezone_reload)
+{
+    const char *saved = getenv("TZ");
+    std::string saved_tz = saved != NULL ? saved : "";
+    dt_timezone_t tz_berlin = {0,};
+    dt_representation_t r = {0,};
+    dt_representation_t expected = {0,};
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t first = {0,};
+    dt_timestamp_t second = {0,};
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz_berlin), DT_OK);
+    EXPECT_EQ(setenv("TZ", BERLIN_TZ_NAME, 1), 0);
+    EXPECT_EQ(dt_local_timezone_reload(), DT_OK);
+
+    // Local timezone behaves as the named one, skipped and double times included
+    t.second = 1372672800L;
+    EXPECT_EQ(dt_timestamp_to_representation(&t, &tz_berlin, &expected), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, NULL, &r), DT_OK);
+    EXPECT_EQ(r.hour, expected.hour);
+    EXPECT_EQ(r.hour, 12);
+    EXPECT_EQ(dt_timestamps_to_representations(&t, 1, NULL, &r), DT_OK);
+    EXPECT_EQ(r.hour, 12);
+    EXPECT_EQ(dt_init_representation(2013, 10, 27, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, NULL, &first, &second), DT_OK);
+    EXPECT_EQ(first.second, 1382833800L);
+    EXPECT_EQ(second.second, 1382837400L);
+    EXPECT_EQ(dt_init_representation(2013, 3, 31, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, NULL, &first, &second), DT_INVALID_ARGUMENT);
+
+    // Empty TZ is UTC, conversions do not notice it till the reload, further reloads change nothing
+    EXPECT_EQ(setenv("TZ", "", 1), 0);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, NULL, &r), DT_OK);
+    EXPECT_EQ(r.hour, 12);
+    EXPECT_EQ(dt_local_timezone_reload(), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, NULL, &r), DT_OK);
+    EXPECT_EQ(r.hour, 10);
+    EXPECT_EQ(dt_local_timezone_reload(), DT_OK);
+    EXPECT_EQ(dt_local_timezone_reload(), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, NULL, &r), DT_OK);
+    EXPECT_EQ(r.hour, 10);
+
+    if (saved != NULL) {
+        setenv("TZ", saved_tz.c_str(), 1);
+    } else {
+        unsetenv("TZ");
+    }
+    EXPECT_EQ(dt_local_timezone_reload(), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_berlin), DT_OK);
+}
+#endif
+
+TEST_F(DtCase, fixed_offset_timezone)
+{
+    dt_timezone_t tz_fixed = {0,};
+    dt_timezone_t tz_named = {0,};
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t first = {0,};
+    dt_timestamp_t second = {0,};
+    dt_representation_t r = {0,};
+    dt_representation_t expected = {0,};
+    struct tm tm = {0,};
+    time_t posix_time = 0;
+    long i = 0;
+
+    // UTC handle gives the same as gmtime_r() far into the past and the future
+    EXPECT_EQ(dt_timezone_fixed(0, &tz_fixed), DT_OK);
+    for (i = -20000; i <= 20000; i++) {
+        t.second = i * 7919L * 13 + i % 86400;
+        t.nano_second = 17;
+        posix_time = t.second;
+        ASSERT_TRUE(gmtime_r(&posix_time, &tm) != NULL);
+        EXPECT_EQ(dt_timestamp_to_representation(&t, &tz_fixed, &r), DT_OK);
+        EXPECT_EQ(r.year, tm.tm_year + 1900);
+        EXPECT_EQ(r.month, tm.tm_mon + 1);
+        EXPECT_EQ(r.day, tm.tm_mday);
+        EXPECT_EQ(r.hour, tm.tm_hour);
+        EXPECT_EQ(r.minute, tm.tm_min);
+        EXPECT_EQ(r.second, tm.tm_sec);
+        EXPECT_EQ(r.nano_second, 17UL);
+        EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_fixed, &first, &second), DT_OK);
+        EXPECT_EQ(first.second, t.second);
+        EXPECT_EQ(second.second, t.second);
+    }
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+
+    // Names of fixed offset timezones
+    EXPECT_EQ(dt_timezone_lookup("+05:30", &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_init_representation(2013, 1, 1, 5, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_fixed, &t, NULL), DT_OK);
+    EXPECT_EQ(t.second, 1356998400L);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("Etc/GMT+3", &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_init_representation(2012, 12, 31, 21, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_fixed, &t, NULL), DT_OK);
+    EXPECT_EQ(t.second, 1356998400L);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("Z", &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("UTC-0800", &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("+5:30", &tz_fixed), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(dt_timezone_lookup("+24:00", &tz_fixed), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(dt_timezone_lookup("Etc/GMT+13", &tz_fixed), DT_TIMEZONE_NOT_FOUND);
+
+    // Fixed offset handle converts as timezone having the same offset for a long time
+#ifndef _WIN32
+    EXPECT_EQ(dt_timezone_fixed(19800, &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup("Asia/Calcutta", &tz_named), DT_OK);
+    for (i = 0; i < 10000; i++) {
+        t.second = 946684800L + i * 94693L;
+        EXPECT_EQ(dt_timestamp_to_representation(&t, &tz_named, &expected), DT_OK);
+        EXPECT_EQ(dt_timestamps_to_representations(&t, 1, &tz_fixed, &r), DT_OK);
+        EXPECT_EQ(r.year, expected.year);
+        EXPECT_EQ(r.month, expected.month);
+        EXPECT_EQ(r.day, expected.day);
+        EXPECT_EQ(r.hour, expected.hour);
+        EXPECT_EQ(r.minute, expected.minute);
+        EXPECT_EQ(r.second, expected.second);
+        EXPECT_EQ(dt_representation_to_timestamp(&expected, &tz_fixed, &first, NULL), DT_OK);
+        EXPECT_EQ(first.second, t.second);
+    }
+    EXPECT_EQ(dt_timezone_cleanup(&tz_named), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+#endif
+
+    // Representations out of range are normalized
+    EXPECT_EQ(dt_timezone_fixed(-3600, &tz_fixed), DT_OK);
+    EXPECT_EQ(dt_init_representation(2012, 12, 31, 23, 0, 0, 0, &r), DT_OK);
+    r.hour = 24;
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_fixed, &t, NULL), DT_OK);
+    EXPECT_EQ(t.second, 1357002000L);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_fixed), DT_OK);
+
+    EXPECT_EQ(dt_timezone_fixed(86400, &tz_fixed), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_fixed(-86400, &tz_fixed), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_timezone_fixed(0, NULL), DT_INVALID_ARGUMENT);
+}
+
+TEST_F(DtCase, rule_after_last_transition)
+{
+    dt_timezone_t tz = {0,};
+    dt_timestamp_t first = {0,};
+    dt_timestamp_t second = {0,};
+    dt_representation_t r = {0,};
+    dt_representation_t back = {0,};
+    long gmtoff = 0;
+    dt_bool_t is_dst = DT_FALSE;
+    int year = 0;
+
+    // Years long after the last transition of the database follow the rule of the timezone
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz), DT_OK);
+    for (year = 2030; year < 10000; year += 7) {
+        EXPECT_EQ(dt_init_representation(year, 7, 1, 12, 0, 0, 0, &r), DT_OK);
+        EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_OK);
+        EXPECT_EQ(first.second, second.second);
+        EXPECT_EQ(dt_timezone_offset_at(&tz, &first, &gmtoff, &is_dst, NULL), DT_OK);
+        EXPECT_EQ(gmtoff, 7200);
+        EXPECT_EQ(is_dst, DT_TRUE);
+        EXPECT_EQ(dt_timestamp_to_representation(&first, &tz, &back), DT_OK);
+        EXPECT_EQ(back.year, year);
+        EXPECT_EQ(back.month, 7);
+        EXPECT_EQ(back.hour, 12);
+
+        EXPECT_EQ(dt_init_representation(year, 1, 15, 12, 0, 0, 0, &r), DT_OK);
+        EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_OK);
+        EXPECT_EQ(dt_timezone_offset_at(&tz, &first, &gmtoff, &is_dst, NULL), DT_OK);
+        EXPECT_EQ(gmtoff, 3600);
+        EXPECT_EQ(is_dst, DT_FALSE);
+    }
+
+    // 9999-10-31 (last Sunday of October) has 02:30 twice
+    EXPECT_EQ(dt_init_representation(9999, 10, 31, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz, &first, &second), DT_OK);
+    EXPECT_EQ(second.second - first.second, 3600L);
+    EXPECT_EQ(dt_timezone_cleanup(&tz), DT_OK);
+}
+
 TEST_F(DtCase, edge_of_time_switch)
 {
     dt_representation_t r = {0,};
     dt_timestamp_t t = {0,};
     dt_representation_t result = {0,};
     dt_timezone_t tz_moscow = {0,};
+    dt_timezone_t tz_berlin = {0,};
     dt_timezone_t tz_utc = {0,};
     //Lookup timezones
     EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &tz_moscow), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz_berlin), DT_OK);
     EXPECT_EQ(dt_timezone_lookup(UTC_TZ_NAME, &tz_utc), DT_OK);
 
     // before switch time...
@@ -1084,4 +2345,141 @@ TEST_F(DtCase, edge_of_time_switch)
     EXPECT_EQ(result.minute, 30);
     EXPECT_EQ(result.day, 25);
 
+#ifndef _WIN32
+    // double time resolves to the earlier timestamp in historical years too
+    EXPECT_TRUE(dt_init_representation(1982, 9, 26, 2, 30, 0, 0, &r) == DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_berlin, &t, NULL), DT_OK);
+    EXPECT_EQ(dt_timestamp_to_representation(&t, &tz_utc, &result), DT_OK);
+    EXPECT_EQ(result.hour, 0);
+    EXPECT_EQ(result.minute, 30);
+    EXPECT_EQ(result.day, 26);
+#endif
+
+    EXPECT_EQ(dt_timezone_cleanup(&tz_moscow), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_berlin), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_utc), DT_OK);
+}
+
+TEST_F(DtCase, representation_add)
+{
+    dt_representation_t r = {0,};
+    dt_representation_t result = {0,};
+    dt_representation_t expected = {0,};
+    dt_timestamp_t t = {0,};
+    const dt_timestamp_t max_timestamp = {LONG_MAX - 5, 0};
+    const dt_timestamp_t min_timestamp = {LONG_MIN + 5, 0};
+    dt_timezone_t tz_berlin = {0,};
+    dt_timezone_t tz_utc = {0,};
+
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz_berlin), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(UTC_TZ_NAME, &tz_utc), DT_OK);
+
+    // Months and years clamp the day to the end of the month
+    EXPECT_EQ(dt_init_representation(2014, 1, 31, 10, 20, 30, 40, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_MONTH, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2014);
+    EXPECT_EQ(result.month, 2);
+    EXPECT_EQ(result.day, 28);
+    EXPECT_EQ(result.hour, 10);
+    EXPECT_EQ(result.minute, 20);
+    EXPECT_EQ(result.second, 30);
+    EXPECT_EQ(result.nano_second, 40UL);
+    EXPECT_EQ(dt_init_representation(2012, 1, 31, 0, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_MONTH, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.month, 2);
+    EXPECT_EQ(result.day, 29);
+    EXPECT_EQ(dt_init_representation(2012, 2, 29, 0, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_YEAR, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2013);
+    EXPECT_EQ(result.month, 2);
+    EXPECT_EQ(result.day, 28);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_YEAR, -4, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2008);
+    EXPECT_EQ(result.day, 29);
+    EXPECT_EQ(dt_init_representation(2014, 3, 31, 0, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_MONTH, -4, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2013);
+    EXPECT_EQ(result.month, 11);
+    EXPECT_EQ(result.day, 30);
+
+    // Weeks and days
+    EXPECT_EQ(dt_init_representation(2013, 12, 28, 12, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_WEEK, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2014);
+    EXPECT_EQ(result.month, 1);
+    EXPECT_EQ(result.day, 4);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, -365, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.year, 2012);
+    EXPECT_EQ(result.month, 12);
+    EXPECT_EQ(result.day, 28);
+
+    // Business days skip weekends, 2014-03-07 is Friday
+    EXPECT_EQ(dt_init_representation(2014, 3, 7, 9, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 10);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, -5, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.month, 2);
+    EXPECT_EQ(result.day, 28);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, 0, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 7);
+    r.day = 8;
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, 1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 10);
+    r.day = 9;
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, -1, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 7);
+    r.day = 5;
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_BUSINESS_DAY, 5, &tz_utc, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 12);
+
+    // A day keeps the local time although it lasts 23 hours, an hour is elapsed time
+    EXPECT_EQ(dt_init_representation(2014, 3, 29, 12, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_berlin, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 30);
+    EXPECT_EQ(result.hour, 12);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_HOUR, 24, &tz_berlin, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.day, 30);
+    EXPECT_EQ(result.hour, 13);
+    EXPECT_EQ(dt_init_representation(2014, 3, 30, 1, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_MINUTE, 60, &tz_berlin, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.hour, 3);
+    EXPECT_EQ(result.minute, 30);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_SECOND, -3600, &tz_berlin, DT_GAP_REJECT, &result), DT_OK);
+    EXPECT_EQ(result.hour, 0);
+    EXPECT_EQ(result.minute, 30);
+
+    // A result in the gap is resolved by the policy
+    EXPECT_EQ(dt_init_representation(2014, 3, 29, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_berlin, DT_GAP_REJECT, &result), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_berlin, DT_GAP_EARLIEST, &result), DT_OK);
+    EXPECT_EQ(result.day, 30);
+    EXPECT_EQ(result.hour, 1);
+    EXPECT_EQ(result.minute, 30);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_berlin, DT_GAP_LATEST, &result), DT_OK);
+    EXPECT_EQ(result.hour, 3);
+    EXPECT_EQ(result.minute, 30);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_berlin, DT_GAP_SHIFT_FORWARD, &result), DT_OK);
+    EXPECT_EQ(result.hour, 3);
+    EXPECT_EQ(result.minute, 0);
+
+    // Errors
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, LONG_MAX, &tz_utc, DT_GAP_REJECT, &result), DT_OVERFLOW);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_YEAR, LONG_MIN, &tz_utc, DT_GAP_REJECT, &result), DT_OVERFLOW);
+    EXPECT_EQ(dt_init_representation(2000, 1, 1, 0, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_berlin, &t, NULL), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_SECOND, LONG_MAX - t.second - 5, &tz_berlin, DT_GAP_REJECT, &result),
+              dt_timestamp_to_representation(&max_timestamp, &tz_berlin, &expected));
+    EXPECT_EQ(dt_init_representation(1900, 1, 1, 0, 0, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_to_timestamp(&r, &tz_berlin, &t, NULL), DT_OK);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_SECOND, LONG_MIN + 5 - t.second, &tz_berlin, DT_GAP_REJECT, &result),
+              dt_timestamp_to_representation(&min_timestamp, &tz_berlin, &expected));
+    EXPECT_EQ(dt_init_representation(2014, 3, 29, 2, 30, 0, 0, &r), DT_OK);
+    EXPECT_EQ(dt_representation_add(NULL, DT_UNIT_DAY, 1, &tz_utc, DT_GAP_REJECT, &result), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_utc, DT_GAP_REJECT, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(dt_representation_add(&r, (dt_unit_t) 100, 1, &tz_utc, DT_GAP_REJECT, &result), DT_INVALID_ARGUMENT);
+    r.month = 13;
+    EXPECT_EQ(dt_representation_add(&r, DT_UNIT_DAY, 1, &tz_utc, DT_GAP_REJECT, &result), DT_INVALID_ARGUMENT);
+
+    EXPECT_EQ(dt_timezone_cleanup(&tz_berlin), DT_OK);
+    EXPECT_EQ(dt_timezone_cleanup(&tz_utc), DT_OK);
 }
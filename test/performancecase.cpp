@@ -6,16 +6,21 @@
 #include <time.h>
 #include "libdt/dt_posix.h"
 #include <limits>
+#include <vector>
+#include <algorithm>
 #include <limits.h>
 #include <float.h>
 
 #define MOSCOW_WINDOWS_STANDARD_TZ_NAME "Russian Standard Time"
 #define MOSCOW_OLSEN_TZ_NAME  "Europe/Moscow"
+#define BERLIN_WINDOWS_STANDARD_TZ_NAME "W. Europe Standard Time"
+#define BERLIN_OLSEN_TZ_NAME  "Europe/Berlin"
 #define UNREAL_TIMEZONE_NAME "this time zone is unreal, you cannot find it anywhere, so good luck"
 
 #ifdef _WIN32
 
 #define MOSCOW_TZ_NAME MOSCOW_WINDOWS_STANDARD_TZ_NAME
+#define BERLIN_TZ_NAME BERLIN_WINDOWS_STANDARD_TZ_NAME
 
 #include <windows.h>
 #define sleep(x) Sleep(x*1000)
@@ -23,6 +28,7 @@
 #else
 
 #define MOSCOW_TZ_NAME MOSCOW_OLSEN_TZ_NAME
+#define BERLIN_TZ_NAME BERLIN_OLSEN_TZ_NAME
 
 #endif
 
@@ -32,7 +38,7 @@ PerformanceCase::PerformanceCase()
 {
 }
 
-TEST_F(PerformanceCase, DISABLED_performance_dt_representation_to_timestamp_test)
+TEST_F(PerformanceCase, performance_dt_representation_to_timestamp_test)
 {
     dt_representation_t r = {0,};
     dt_timestamp_t t = {0,};
@@ -95,6 +101,381 @@ TEST_F(PerformanceCase, performance_dt_timestamp_to_representation_test)
     dt_timezone_cleanup(&tz_moscow);
 }
 
+TEST_F(PerformanceCase, performance_dt_timestamp_to_representation_far_test)
+{
+    dt_timestamp_t t = {0,};
+    dt_representation_t result = {0,};
+    dt_timezone_t tz_berlin = {0,};
+    long checksum = 0;
+
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 100000;
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz_berlin), DT_OK);
+
+    // Years far after the last transition of the database, converted by the rule of the timezone
+    t.second = 16725225600L;
+    dt_now(&t_start);
+
+    for (int i = 0; i < operations_count; i++) {
+        dt_timestamp_to_representation(&t, &tz_berlin, &result);
+        checksum += result.hour;
+        t.second += 86400L * 37 + 3607;
+    }
+
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "duration=" << nanosec_per_operation << " checksum=" << checksum << std::endl;
+    EXPECT_GT(5, nanosec_per_operation / 1000);// < 5 microseconds
+
+    dt_timezone_cleanup(&tz_berlin);
+}
+
+TEST_F(PerformanceCase, performance_dt_local_timestamp_to_representation_test)
+{
+    dt_timestamp_t t = {0,};
+    dt_representation_t result = {0,};
+
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 100000;
+
+    dt_now(&t);
+    dt_now(&t_start);
+
+    // Local timezone is loaded once and not looked up again for each conversion
+    for (int i = 0; i < operations_count; i++) {
+        dt_timestamp_to_representation(&t, NULL, &result);
+        t.second += 61;
+    }
+
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(5, nanosec_per_operation / 1000);// < 5 microseconds
+}
+
+TEST_F(PerformanceCase, performance_dt_stream_converter_test)
+{
+    dt_timezone_t tz_moscow = {0,};
+    dt_stream_converter_t converter;
+    dt_timestamp_t t = {0,};
+    dt_representation_t result = {0,};
+
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 1000000;
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &tz_moscow), DT_OK);
+    EXPECT_EQ(dt_stream_converter_init(&tz_moscow, &converter), DT_OK);
+
+    // Log like stream of a few events a second
+    t.second = 1204329600L;
+    dt_now(&t_start);
+
+    for (int i = 0; i < operations_count; i++) {
+        dt_stream_converter_convert(&converter, &t, &result);
+        t.second += i % 3 == 0;
+        t.nano_second = (t.nano_second + 333333333UL) % 1000000000UL;
+    }
+
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(5, nanosec_per_operation / 1000);// < 5 microseconds
+
+    dt_timezone_cleanup(&tz_moscow);
+}
+
+TEST_F(PerformanceCase, performance_dt_timezone_offset_at_test)
+{
+    dt_timezone_t tz_moscow = {0,};
+    dt_timestamp_t t = {0,};
+    long gmtoff = 0;
+    long checksum = 0;
+
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 100000;
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &tz_moscow), DT_OK);
+
+    t.second = 1204329600L;
+    dt_now(&t_start);
+
+    for (int i = 0; i < operations_count; i++) {
+        dt_timezone_offset_at(&tz_moscow, &t, &gmtoff, NULL, NULL);
+        checksum += gmtoff;
+        t.second += 3607;
+    }
+
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "duration=" << nanosec_per_operation << " checksum=" << checksum << std::endl;
+    EXPECT_GT(5, nanosec_per_operation / 1000);// < 5 microseconds
+
+    dt_timezone_cleanup(&tz_moscow);
+}
+
+TEST_F(PerformanceCase, performance_dt_timestamps_to_representations_test)
+{
+    dt_timezone_t tz_moscow = {0,};
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long timestamps_count = 100000;
+    std::vector<dt_timestamp_t> timestamps(timestamps_count);
+    std::vector<dt_representation_t> representations(timestamps_count);
+
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &tz_moscow), DT_OK);
+    // A column of timestamps a minute apart
+    for (long i = 0; i < timestamps_count; i++) {
+        timestamps[i].second = 1199145600L + i * 60;
+        timestamps[i].nano_second = 0;
+    }
+
+    dt_now(&t_start);
+    for (long i = 0; i < timestamps_count; i++) {
+        dt_timestamp_to_representation(&timestamps[i], &tz_moscow, &representations[i]);
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= timestamps_count;
+    std::cout << "scalar duration=" << nanosec_per_operation << std::endl;
+
+    dt_now(&t_start);
+    EXPECT_EQ(dt_timestamps_to_representations(&timestamps[0], timestamps_count, &tz_moscow, &representations[0]), DT_OK);
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= timestamps_count;
+    std::cout << "batch duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(5, nanosec_per_operation / 1000);// < 5 microseconds
+
+    dt_timezone_cleanup(&tz_moscow);
+}
+
+TEST_F(PerformanceCase, performance_dt_timestamp_to_representations_multi_test)
+{
+    dt_timezone_t tz_moscow = {0,};
+    dt_timezone_t tz_berlin = {0,};
+    dt_timestamp_t t = {0,};
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 10000;
+    const size_t timezones_count = 200;
+    std::vector<dt_timezone_t> fixed(timezones_count);
+    std::vector<const dt_timezone_t *> timezones(timezones_count);
+    std::vector<dt_representation_t> representations(timezones_count);
+
+    EXPECT_EQ(dt_timezone_lookup(MOSCOW_TZ_NAME, &tz_moscow), DT_OK);
+    EXPECT_EQ(dt_timezone_lookup(BERLIN_TZ_NAME, &tz_berlin), DT_OK);
+    // A dashboard of named timezones and offsets from UTC-12:00 to UTC+14:00
+    for (size_t i = 0; i < timezones_count; i++) {
+        EXPECT_EQ(dt_timezone_fixed(((long) i % 105 - 48) * 900, &fixed[i]), DT_OK);
+        timezones[i] = (i % 3 == 0) ? &tz_moscow : (i % 3 == 1) ? &tz_berlin : &fixed[i];
+    }
+
+    t.second = 1388530800L;
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        for (size_t j = 0; j < timezones_count; j++) {
+            dt_timestamp_to_representation(&t, timezones[j], &representations[j]);
+        }
+        t.second += 61;
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "scalar duration=" << nanosec_per_operation << std::endl;
+
+    t.second = 1388530800L;
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        EXPECT_EQ(dt_timestamp_to_representations_multi(&t, &timezones[0], timezones_count, &representations[0]), DT_OK);
+        t.second += 61;
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "multi duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(200, nanosec_per_operation / 1000);// < 200 microseconds for all timezones
+
+    dt_timezone_cleanup(&tz_moscow);
+    dt_timezone_cleanup(&tz_berlin);
+}
+
+TEST_F(PerformanceCase, performance_dt_timestamps_apply_offset_test)
+{
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    dt_offset_t o = {0,};
+    const long operations_count = 100;
+    const size_t timestamps_count = 100000;
+    std::vector<dt_timestamp_t> timestamps(timestamps_count);
+    std::vector<dt_timestamp_t> results(timestamps_count);
+
+    for (size_t i = 0; i < timestamps_count; i++) {
+        timestamps[i].second = 1388530800L + (long) i;
+        timestamps[i].nano_second = (unsigned long) (i * 7919) % 1000000000UL;
+    }
+    o.duration.seconds = 3600;
+    o.duration.nano_seconds = 500000000UL;
+    o.is_forward = DT_TRUE;
+
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        for (size_t j = 0; j < timestamps_count; j++) {
+            dt_apply_offset(&timestamps[j], &o, &results[j]);
+        }
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count * timestamps_count;
+    std::cout << "scalar duration=" << nanosec_per_operation << std::endl;
+
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        EXPECT_EQ(dt_timestamps_apply_offset(&timestamps[0], timestamps_count, &o, &results[0]), DT_OK);
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count * timestamps_count;
+    std::cout << "array duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(100, nanosec_per_operation);// < 100 nanoseconds per timestamp
+}
+
+static bool timestamp_less(const dt_timestamp_t &lhs, const dt_timestamp_t &rhs)
+{
+    dt_compare_result_t result = DT_EQUALS;
+    dt_compare_timestamps(&lhs, &rhs, &result);
+    return result == DT_LESSER;
+}
+
+TEST_F(PerformanceCase, performance_dt_timestamps_sort_test)
+{
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const size_t timestamps_count = 1000000;
+    std::vector<dt_timestamp_t> timestamps(timestamps_count);
+    std::vector<dt_timestamp_t> sorted(timestamps_count);
+    std::vector<size_t> permutation(timestamps_count);
+    unsigned long long seed = 1;
+
+    // Events of a day in random order
+    for (size_t i = 0; i < timestamps_count; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        timestamps[i].second = 1388530800L + (long) ((seed >> 33) % 86400);
+        timestamps[i].nano_second = (unsigned long) ((seed >> 13) % 1000000000ULL);
+    }
+
+    sorted = timestamps;
+    dt_now(&t_start);
+    std::stable_sort(sorted.begin(), sorted.end(), timestamp_less);
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= timestamps_count;
+    std::cout << "comparator sort duration=" << nanosec_per_operation << std::endl;
+
+    sorted = timestamps;
+    dt_now(&t_start);
+    EXPECT_EQ(dt_timestamps_sort(&sorted[0], timestamps_count, &permutation[0]), DT_OK);
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= timestamps_count;
+    std::cout << "radix sort duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(1000, nanosec_per_operation);// < 1 microsecond per timestamp
+
+    dt_now(&t_start);
+    for (size_t i = 0; i < timestamps_count; i++) {
+        size_t lower = 0;
+        size_t upper = 0;
+        dt_timestamps_lower_bound(&sorted[0], timestamps_count, &timestamps[i], &lower);
+        dt_timestamps_upper_bound(&sorted[0], timestamps_count, &timestamps[i], &upper);
+        EXPECT_LT(lower, upper);
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= timestamps_count;
+    std::cout << "search duration=" << nanosec_per_operation << std::endl;
+    EXPECT_GT(10000, nanosec_per_operation);// < 10 microseconds per timestamp
+}
+
+#ifndef _WIN32
+
+extern "C" {
+#include "../src/unix/libtz/tz.h"
+}
+
+TEST_F(PerformanceCase, performance_transition_search_test)
+{
+    dt_timezone_t tz_new_york = {0,};
+    dt_timestamp_t t_start = {0,};
+    dt_timestamp_t t_stop = {0,};
+    dt_offset_t t_duration = {0,};
+    const long operations_count = 1000000;
+    const long timestamps_count = 4096;
+    time_t timestamps[timestamps_count];
+    unsigned long long seed = 12345;
+    long checksum_bsearch = 0;
+    long checksum_search = 0;
+
+    // America/New_York has a long history of transitions
+    EXPECT_EQ(dt_timezone_lookup("America/New_York", &tz_new_york), DT_OK);
+    for (long i = 0; i < timestamps_count; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        timestamps[i] = (time_t)((seed >> 16) % 8000000000ULL) - 3000000000L;
+        EXPECT_EQ(tz_transition_search(tz_new_york.state, timestamps[i]),
+                  tz_transition_bsearch(tz_new_york.state, timestamps[i]));
+    }
+
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        checksum_bsearch += tz_transition_bsearch(tz_new_york.state, timestamps[i % timestamps_count]);
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    double nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "binary search duration=" << nanosec_per_operation << std::endl;
+
+    dt_now(&t_start);
+    for (long i = 0; i < operations_count; i++) {
+        checksum_search += tz_transition_search(tz_new_york.state, timestamps[i % timestamps_count]);
+    }
+    dt_now(&t_stop);
+    dt_offset_between(&t_start, &t_stop, &t_duration);
+    nanosec_per_operation = ((t_duration.duration.seconds * 1000 * 1000 * 1000) + t_duration.duration.nano_seconds);
+    nanosec_per_operation /= operations_count;
+    std::cout << "transition search duration=" << nanosec_per_operation << std::endl;
+
+    EXPECT_EQ(checksum_bsearch, checksum_search);
+    dt_timezone_cleanup(&tz_new_york);
+}
+
+#endif
+
 TEST_F(PerformanceCase, performance_std_mktime_test)
 {
     dt_representation_t r = {0,};
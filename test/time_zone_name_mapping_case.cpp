@@ -49,8 +49,8 @@ TimeZoneNameMappingCase::TimeZoneNameMappingCase()
 
 TEST_F(TimeZoneNameMappingCase, errorHandling)
 {
-    tz_aliases_t *aliases = NULL;
-    tz_alias_t *alias = (tz_alias_t *)&aliases;
+    const tz_aliases_t *aliases = NULL;
+    const tz_alias_t *alias = (const tz_alias_t *)&aliases;
     tz_alias_iterator_t *iterator = (tz_alias_iterator_t *)&alias;
     EXPECT_EQ(tzmap_map(NULL, &aliases), DT_INVALID_ARGUMENT);
     EXPECT_EQ(tzmap_map(invalidTimeZone, NULL), DT_INVALID_ARGUMENT);
@@ -63,7 +63,7 @@ TEST_F(TimeZoneNameMappingCase, errorHandling)
     EXPECT_EQ(tzmap_free(NULL), DT_INVALID_ARGUMENT);
 
     EXPECT_EQ(tzmap_iterate(NULL, &iterator, &alias), DT_INVALID_ARGUMENT);
-    aliases = (tz_aliases_t *)&iterator;
+    aliases = (const tz_aliases_t *)&iterator;
     EXPECT_EQ(tzmap_iterate(aliases, NULL, &alias), DT_INVALID_ARGUMENT);
     EXPECT_EQ(tzmap_iterate(aliases, &iterator, NULL), DT_INVALID_ARGUMENT);
 
@@ -72,10 +72,10 @@ TEST_F(TimeZoneNameMappingCase, errorHandling)
 
 void testMappingWithHawaianData(const char *tzName)
 {
-    tz_aliases_t *aliases = NULL;
+    const tz_aliases_t *aliases = NULL;
     bool visitedWindowsStandardTimeAlias = false;
     dt_status_t  status = DT_UNKNOWN_ERROR;
-    tz_alias_t *alias = NULL;
+    const tz_alias_t *alias = NULL;
     tz_alias_iterator_t *iterator = TZMAP_BEGIN;
     size_t aliasesArrayLength = sizeof(aliasesOlsenForHawaian) / sizeof(char *);
     std::set<std::string> setOlsenForHawaian(aliasesOlsenForHawaian, aliasesOlsenForHawaian + aliasesArrayLength);
@@ -134,3 +134,72 @@ TEST_F(TimeZoneNameMappingCase, fromOlsenMapping)
 
 
 
+TEST_F(TimeZoneNameMappingCase, leadAliases)
+{
+    const tz_aliases_t *aliases = NULL;
+    const tz_alias_t *alias = NULL;
+    tz_alias_iterator_t *iterator = TZMAP_BEGIN;
+
+    // Windows standard time and it's "001" olsen name come first
+    EXPECT_EQ(tzmap_map(windowsStandardTimeHawaianName, &aliases), DT_OK);
+    EXPECT_EQ(tzmap_iterate(aliases, &iterator, &alias), DT_OK);
+    EXPECT_EQ(alias->kind, DT_TZMAP_WIN_STANDARD_TIME);
+    EXPECT_STREQ(alias->name, windowsStandardTimeHawaianName);
+    EXPECT_EQ(tzmap_iterate(aliases, &iterator, &alias), DT_OK);
+    EXPECT_EQ(alias->kind, DT_TZMAP_OLSEN_NAME);
+    EXPECT_STREQ(alias->name, olsenHawaianName);
+    EXPECT_EQ(tzmap_free(aliases), DT_OK);
+
+    // Olsen name maps to its windows standard time first, then to itself
+    iterator = TZMAP_BEGIN;
+    EXPECT_EQ(tzmap_map("Pacific/Tahiti", &aliases), DT_OK);
+    EXPECT_EQ(tzmap_iterate(aliases, &iterator, &alias), DT_OK);
+    EXPECT_STREQ(alias->name, windowsStandardTimeHawaianName);
+    EXPECT_EQ(tzmap_iterate(aliases, &iterator, &alias), DT_OK);
+    EXPECT_EQ(alias->kind, DT_TZMAP_OLSEN_NAME);
+    EXPECT_STREQ(alias->name, "Pacific/Tahiti");
+    EXPECT_EQ(tzmap_free(aliases), DT_OK);
+
+    // Names from the end of windowsZones.xml are mapped as well
+    iterator = TZMAP_BEGIN;
+    EXPECT_EQ(tzmap_map("Pacific/Apia", &aliases), DT_OK);
+    EXPECT_EQ(tzmap_iterate(aliases, &iterator, &alias), DT_OK);
+    EXPECT_STREQ(alias->name, "Samoa Standard Time");
+    EXPECT_EQ(tzmap_free(aliases), DT_OK);
+}
+
+TEST_F(TimeZoneNameMappingCase, fixedOffset)
+{
+    long offset = 1;
+    const char *abbreviation = NULL;
+
+    EXPECT_EQ(tzmap_fixed_offset("UTC", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, 0);
+    EXPECT_EQ(tzmap_fixed_offset("Etc/Zulu", &offset, &abbreviation), DT_OK);
+    EXPECT_EQ(offset, 0);
+    EXPECT_STREQ(abbreviation, "UTC");
+    EXPECT_EQ(tzmap_fixed_offset("Etc/GMT", &offset, &abbreviation), DT_OK);
+    EXPECT_EQ(offset, 0);
+    EXPECT_STREQ(abbreviation, "GMT");
+    EXPECT_EQ(tzmap_fixed_offset("Etc/GMT-5", &offset, &abbreviation), DT_OK);
+    EXPECT_EQ(offset, 18000);
+    EXPECT_TRUE(abbreviation == NULL);
+    EXPECT_EQ(tzmap_fixed_offset("Etc/GMT+10", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, -36000);
+    EXPECT_EQ(tzmap_fixed_offset("Etc/GMT-14", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, 50400);
+    EXPECT_EQ(tzmap_fixed_offset("+05:45", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, 20700);
+    EXPECT_EQ(tzmap_fixed_offset("-0330", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, -12600);
+    EXPECT_EQ(tzmap_fixed_offset("UTC+03", &offset, NULL), DT_OK);
+    EXPECT_EQ(offset, 10800);
+
+    EXPECT_EQ(tzmap_fixed_offset(windowsStandardTimeHawaianName, &offset, NULL), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(tzmap_fixed_offset("GMT+5", &offset, NULL), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(tzmap_fixed_offset("Etc/GMT+5:30", &offset, NULL), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(tzmap_fixed_offset("+05:3", &offset, NULL), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(tzmap_fixed_offset("+05:60", &offset, NULL), DT_TIMEZONE_NOT_FOUND);
+    EXPECT_EQ(tzmap_fixed_offset(NULL, &offset, NULL), DT_INVALID_ARGUMENT);
+    EXPECT_EQ(tzmap_fixed_offset("UTC", NULL, NULL), DT_INVALID_ARGUMENT);
+}